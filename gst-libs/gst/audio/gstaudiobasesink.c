@@ -33,6 +33,7 @@
  */
 
 #include <string.h>
+#include <math.h>
 
 #include <gst/audio/audio.h>
 #include "gstaudiobasesink.h"
@@ -71,6 +72,25 @@ struct _GstAudioBaseSinkPrivate
 
   /* number of nanoseconds to wait until creating a discontinuity */
   GstClockTime discont_wait;
+
+  /* state of the interpolating slave method. drift_ratio is the number of
+   * samples written for each input sample, steered by a PI controller with
+   * drift_integral as its integral term. drift_work holds drift_hist frames
+   * of filter history followed by the new input and drift_phase is the
+   * position of the next output frame in it. */
+  gdouble drift_ratio;
+  gdouble drift_integral;
+  gdouble drift_phase;
+  guint drift_hist;
+  gpointer drift_work;
+  gsize drift_work_size;
+  /* unpacked samples and the resampled output */
+  gpointer drift_tmp;
+  gsize drift_tmp_size;
+  gpointer drift_out;
+  gsize drift_out_size;
+  guint8 *drift_packed;
+  gsize drift_packed_size;
 };
 
 /* BaseAudioSink signals and args */
@@ -101,6 +121,22 @@ enum
  * fix itself, or is a permanent offset */
 #define DEFAULT_DISCONT_WAIT        (1 * GST_SECOND)
 
+/* windowed-sinc interpolator of the interpolating slave method, with
+ * DRIFT_TAPS taps and DRIFT_PHASES filter phases between two samples */
+#define DRIFT_HALF_TAPS   16
+#define DRIFT_TAPS        (2 * DRIFT_HALF_TAPS)
+#define DRIFT_PHASES      128
+#define DRIFT_CUTOFF      0.95
+
+/* gains of the PI controller, the error is the offset in seconds between
+ * where a sample should be played according to the master clock and where
+ * it ends up in the ringbuffer. They give a well damped loop that
+ * settles in about 10 seconds and never changes the pitch by more than
+ * DRIFT_MAX_CORRECTION */
+#define DRIFT_KP              0.3
+#define DRIFT_KI              0.04
+#define DRIFT_MAX_CORRECTION  0.005
+
 enum
 {
   PROP_0,
@@ -126,6 +162,8 @@ gst_audio_base_sink_slave_method_get_type (void)
         "resample"},
     {GST_AUDIO_BASE_SINK_SLAVE_SKEW, "GST_AUDIO_BASE_SINK_SLAVE_SKEW", "skew"},
     {GST_AUDIO_BASE_SINK_SLAVE_NONE, "GST_AUDIO_BASE_SINK_SLAVE_NONE", "none"},
+    {GST_AUDIO_BASE_SINK_SLAVE_INTERPOLATE,
+        "GST_AUDIO_BASE_SINK_SLAVE_INTERPOLATE", "interpolate"},
     {0, NULL, NULL},
   };
 
@@ -168,6 +206,9 @@ static GstClockTime gst_audio_base_sink_get_time (GstClock * clock,
     GstAudioBaseSink * sink);
 static void gst_audio_base_sink_callback (GstAudioRingBuffer * rbuf,
     guint8 * data, guint len, gpointer user_data);
+static void gst_audio_base_sink_drift_drain (GstAudioBaseSink * sink);
+static void gst_audio_base_sink_drift_reset (GstAudioBaseSink * sink,
+    gboolean controller);
 
 static GstFlowReturn gst_audio_base_sink_preroll (GstBaseSink * bsink,
     GstBuffer * buffer);
@@ -309,6 +350,8 @@ gst_audio_base_sink_init (GstAudioBaseSink * audiobasesink)
   audiobasesink->priv->drift_tolerance = DEFAULT_DRIFT_TOLERANCE;
   audiobasesink->priv->alignment_threshold = DEFAULT_ALIGNMENT_THRESHOLD;
   audiobasesink->priv->discont_wait = DEFAULT_DISCONT_WAIT;
+  audiobasesink->priv->drift_ratio = 1.0;
+  audiobasesink->priv->drift_phase = -1.0;
 
   audiobasesink->provided_clock = gst_audio_clock_new ("GstAudioSinkClock",
       (GstAudioClockGetTimeFunc) gst_audio_base_sink_get_time, audiobasesink,
@@ -343,6 +386,19 @@ gst_audio_base_sink_dispose (GObject * object)
     sink->ringbuffer = NULL;
   }
 
+  g_free (sink->priv->drift_work);
+  sink->priv->drift_work = NULL;
+  sink->priv->drift_work_size = 0;
+  g_free (sink->priv->drift_tmp);
+  sink->priv->drift_tmp = NULL;
+  sink->priv->drift_tmp_size = 0;
+  g_free (sink->priv->drift_out);
+  sink->priv->drift_out = NULL;
+  sink->priv->drift_out_size = 0;
+  g_free (sink->priv->drift_packed);
+  sink->priv->drift_packed = NULL;
+  sink->priv->drift_packed_size = 0;
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -886,6 +942,7 @@ gst_audio_base_sink_setcaps (GstBaseSink * bsink, GstCaps * caps)
 
   /* We need to resync since the ringbuffer restarted */
   sink->priv->avg_skew = -1;
+  gst_audio_base_sink_drift_reset (sink, TRUE);
   sink->next_sample = -1;
   sink->priv->eos_time = -1;
   sink->priv->discont_time = -1;
@@ -1052,7 +1109,9 @@ gst_audio_base_sink_wait_event (GstBaseSink * bsink, GstEvent * event)
       break;
     }
     case GST_EVENT_EOS:
-      /* now wait till we played everything */
+      /* write what the interpolating slave method still holds back and
+       * wait till we played everything */
+      gst_audio_base_sink_drift_drain (sink);
       gst_audio_base_sink_drain (sink);
       break;
     default:
@@ -1074,6 +1133,7 @@ gst_audio_base_sink_event (GstBaseSink * bsink, GstEvent * event)
     case GST_EVENT_FLUSH_STOP:
       /* always resync on sample after a flush */
       sink->priv->avg_skew = -1;
+      gst_audio_base_sink_drift_reset (sink, TRUE);
       sink->next_sample = -1;
       sink->priv->eos_time = -1;
       sink->priv->discont_time = -1;
@@ -1160,6 +1220,285 @@ clock_convert_external (GstClockTime external, GstClockTime cinternal,
   return external;
 }
 
+/* filter table of the interpolating slave method. Row p holds the taps for
+ * an output sample p / DRIFT_PHASES after the sample at tap
+ * DRIFT_HALF_TAPS - 1, there is one extra row so that the coefficients can
+ * be interpolated linearly between two rows. */
+static gfloat drift_table[(DRIFT_PHASES + 1) * DRIFT_TAPS];
+
+static gpointer
+drift_table_init (gpointer data)
+{
+  gint p, j;
+
+  for (p = 0; p <= DRIFT_PHASES; p++) {
+    gfloat *row = drift_table + p * DRIFT_TAPS;
+    gdouble frac = (gdouble) p / DRIFT_PHASES;
+    gdouble sum = 0.0;
+
+    for (j = 0; j < DRIFT_TAPS; j++) {
+      gdouble x = (j - DRIFT_HALF_TAPS + 1) - frac;
+      gdouble w, sinc;
+
+      /* blackman window over the width of the filter */
+      if (fabs (x) >= DRIFT_HALF_TAPS)
+        w = 0.0;
+      else
+        w = 0.42 + 0.5 * cos (G_PI * x / DRIFT_HALF_TAPS) +
+            0.08 * cos (2.0 * G_PI * x / DRIFT_HALF_TAPS);
+
+      if (x == 0.0)
+        sinc = DRIFT_CUTOFF;
+      else
+        sinc = sin (G_PI * DRIFT_CUTOFF * x) / (G_PI * x);
+
+      row[j] = sinc * w;
+      sum += row[j];
+    }
+    /* normalize for unity gain at DC */
+    for (j = 0; j < DRIFT_TAPS; j++)
+      row[j] /= sum;
+  }
+  return NULL;
+}
+
+/* forget the filter history, when @controller is TRUE the PI controller
+ * starts over as well. That is only needed after a flush or a clock or
+ * format change, the drift between the clocks survives a discontinuity. */
+static void
+gst_audio_base_sink_drift_reset (GstAudioBaseSink * sink, gboolean controller)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+
+  priv->drift_hist = 0;
+  priv->drift_phase = -1.0;
+
+  if (controller) {
+    priv->drift_ratio = 1.0;
+    priv->drift_integral = 0.0;
+  }
+}
+
+/* feed the offset @error in seconds between the position where the next
+ * sample should be played and where it will be written into the PI
+ * controller, @dt is the duration of the data since the last update */
+static void
+gst_audio_base_sink_drift_update (GstAudioBaseSink * sink, gdouble error,
+    gdouble dt)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+  gdouble ratio;
+
+  priv->drift_integral = CLAMP (priv->drift_integral + DRIFT_KI * error * dt,
+      -DRIFT_MAX_CORRECTION, DRIFT_MAX_CORRECTION);
+
+  ratio = 1.0 + DRIFT_KP * error + priv->drift_integral;
+  priv->drift_ratio = CLAMP (ratio, 1.0 - DRIFT_MAX_CORRECTION,
+      1.0 + DRIFT_MAX_CORRECTION);
+
+  GST_LOG_OBJECT (sink, "error %" G_GINT64_FORMAT " ns, ratio %.9f",
+      (gint64) (error * GST_SECOND), priv->drift_ratio);
+}
+
+static gpointer
+ensure_size (gpointer mem, gsize * size, gsize needed)
+{
+  if (needed > *size) {
+    mem = g_realloc (mem, needed);
+    *size = needed;
+  }
+  return mem;
+}
+
+/* interpolates output frames from the filter history in priv->drift_work,
+ * which holds samples of @type, into priv->drift_out */
+#define DRIFT_INTERPOLATE(type) G_STMT_START {                                \
+  const type *work = priv->drift_work;                                        \
+  type *dst = priv->drift_out;                                                \
+                                                                              \
+  while ((guint) phase + DRIFT_HALF_TAPS < len && produced < max_out) {       \
+    guint base = (guint) phase - DRIFT_HALF_TAPS + 1;                         \
+    gdouble fp = (phase - (guint) phase) * DRIFT_PHASES;                      \
+    guint p = (guint) fp;                                                     \
+    type t = fp - p;                                                          \
+    const gfloat *r0 = drift_table + p * DRIFT_TAPS;                          \
+    const gfloat *r1 = r0 + DRIFT_TAPS;                                       \
+    type coef[DRIFT_TAPS];                                                    \
+                                                                              \
+    /* interpolate the taps once for all channels */                          \
+    for (j = 0; j < DRIFT_TAPS; j++)                                          \
+      coef[j] = r0[j] + t * (r1[j] - r0[j]);                                  \
+                                                                              \
+    for (c = 0; c < channels; c++)                                            \
+      dst[c] = 0.0;                                                           \
+    for (j = 0; j < DRIFT_TAPS; j++) {                                        \
+      const type *w = work + (base + j) * channels;                           \
+      for (c = 0; c < channels; c++)                                          \
+        dst[c] += coef[j] * w[c];                                             \
+    }                                                                         \
+    dst += channels;                                                          \
+    produced++;                                                               \
+    phase += step;                                                            \
+  }                                                                           \
+} G_STMT_END
+
+/* resample @samples frames of @data with the current ratio, the output is
+ * returned in @out and has the format of the ringbuffer. Returns the number
+ * of frames in @out. The filter works on gfloat samples, or on gdouble
+ * samples for formats with more than 24 bits that gfloat can't hold. */
+static guint
+gst_audio_base_sink_drift_process (GstAudioBaseSink * sink,
+    const guint8 * data, guint samples, const guint8 ** out)
+{
+  static GOnce table_once = G_ONCE_INIT;
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+  GstAudioInfo *info = &sink->ringbuffer->spec.info;
+  const GstAudioFormatInfo *finfo = info->finfo;
+  gint channels = GST_AUDIO_INFO_CHANNELS (info);
+  gboolean is_double, work_double;
+  guint i, c, j, len, drop, max_out, produced;
+  gsize wsize;
+  gdouble step, phase;
+
+  g_once (&table_once, drift_table_init, NULL);
+
+  is_double = (GST_AUDIO_FORMAT_INFO_FORMAT (finfo->unpack_format) ==
+      GST_AUDIO_FORMAT_F64);
+  work_double = is_double || GST_AUDIO_FORMAT_INFO_DEPTH (finfo) > 24;
+  wsize = work_double ? sizeof (gdouble) : sizeof (gfloat);
+
+  /* start with DRIFT_HALF_TAPS - 1 frames of silence so that the first
+   * output frame is the first input frame */
+  if (priv->drift_phase < 0.0) {
+    priv->drift_hist = DRIFT_HALF_TAPS - 1;
+    priv->drift_phase = DRIFT_HALF_TAPS - 1;
+    priv->drift_work = ensure_size (priv->drift_work, &priv->drift_work_size,
+        priv->drift_hist * channels * wsize);
+    memset (priv->drift_work, 0, priv->drift_hist * channels * wsize);
+  }
+
+  len = priv->drift_hist + samples;
+  step = 1.0 / priv->drift_ratio;
+  max_out = ceil (samples * priv->drift_ratio) + 1;
+
+  priv->drift_work = ensure_size (priv->drift_work, &priv->drift_work_size,
+      len * channels * wsize);
+  priv->drift_tmp = ensure_size (priv->drift_tmp, &priv->drift_tmp_size,
+      MAX (samples, max_out) * channels * 8);
+  priv->drift_out = ensure_size (priv->drift_out, &priv->drift_out_size,
+      max_out * channels * wsize);
+  priv->drift_packed = ensure_size (priv->drift_packed,
+      &priv->drift_packed_size, max_out * GST_AUDIO_INFO_BPF (info));
+
+  /* append the input to the history */
+  finfo->unpack_func (finfo, 0, priv->drift_tmp, (gpointer) data,
+      samples * channels);
+  if (is_double) {
+    memcpy ((guint8 *) priv->drift_work + priv->drift_hist * channels * wsize,
+        priv->drift_tmp, samples * channels * wsize);
+  } else if (work_double) {
+    const gint32 *s = priv->drift_tmp;
+    gdouble *work = (gdouble *) priv->drift_work + priv->drift_hist * channels;
+    for (i = 0; i < samples * channels; i++)
+      work[i] = s[i] * (1.0 / 2147483648.0);
+  } else {
+    const gint32 *s = priv->drift_tmp;
+    gfloat *work = (gfloat *) priv->drift_work + priv->drift_hist * channels;
+    for (i = 0; i < samples * channels; i++)
+      work[i] = s[i] * (1.0 / 2147483648.0);
+  }
+
+  phase = priv->drift_phase;
+  produced = 0;
+  if (work_double)
+    DRIFT_INTERPOLATE (gdouble);
+  else
+    DRIFT_INTERPOLATE (gfloat);
+
+  /* keep the frames that the next output frame still needs */
+  drop = MIN ((guint) phase - DRIFT_HALF_TAPS + 1, len);
+  memmove (priv->drift_work, (guint8 *) priv->drift_work +
+      drop * channels * wsize, (len - drop) * channels * wsize);
+  priv->drift_hist = len - drop;
+  priv->drift_phase = phase - drop;
+
+  /* and convert the output to the format of the ringbuffer */
+  if (is_double) {
+    memcpy (priv->drift_tmp, priv->drift_out, produced * channels * wsize);
+  } else if (work_double) {
+    const gdouble *o = priv->drift_out;
+    gint32 *d = priv->drift_tmp;
+    for (i = 0; i < produced * channels; i++) {
+      gdouble v = floor (o[i] * 2147483648.0 + 0.5);
+      d[i] = CLAMP (v, -2147483648.0, 2147483647.0);
+    }
+  } else {
+    const gfloat *o = priv->drift_out;
+    gint32 *d = priv->drift_tmp;
+    for (i = 0; i < produced * channels; i++) {
+      gdouble v = o[i] * 2147483648.0;
+      d[i] = CLAMP (v, -2147483648.0, 2147483647.0);
+    }
+  }
+  finfo->pack_func (finfo, 0, priv->drift_tmp, priv->drift_packed,
+      produced * channels);
+
+  *out = priv->drift_packed;
+
+  return produced;
+}
+
+#undef DRIFT_INTERPOLATE
+
+/* at EOS the last input frames are still in the filter history, push them
+ * out with silence and write them after the previous samples */
+static void
+gst_audio_base_sink_drift_drain (GstAudioBaseSink * sink)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+  GstAudioRingBuffer *ringbuf = sink->ringbuffer;
+  GstAudioInfo *info;
+  const guint8 *data;
+  guint8 *silence;
+  guint64 sample_offset;
+  guint samples, pending;
+  gint accum = 0;
+  gint bpf;
+
+  if (priv->drift_phase < 0.0 || sink->next_sample == -1 || ringbuf == NULL
+      || !gst_audio_ring_buffer_is_acquired (ringbuf))
+    return;
+
+  info = &ringbuf->spec.info;
+  bpf = GST_AUDIO_INFO_BPF (info);
+
+  /* output frames that are still centered on an input frame, the last
+   * input frame is the last frame of the history */
+  if (priv->drift_hist == 0 || priv->drift_phase > priv->drift_hist - 1) {
+    gst_audio_base_sink_drift_reset (sink, FALSE);
+    return;
+  }
+  pending = floor ((priv->drift_hist - 1 - priv->drift_phase) *
+      priv->drift_ratio) + 1;
+
+  silence = g_malloc (DRIFT_TAPS * bpf);
+  gst_audio_format_fill_silence (info->finfo, silence, DRIFT_TAPS * bpf);
+  samples = gst_audio_base_sink_drift_process (sink, silence, DRIFT_TAPS,
+      &data);
+  g_free (silence);
+  samples = MIN (samples, pending);
+
+  GST_DEBUG_OBJECT (sink, "draining %u frames of the interpolation filter",
+      samples);
+
+  sample_offset = sink->next_sample;
+  gst_audio_ring_buffer_commit (ringbuf, &sample_offset, (guint8 *) data,
+      samples, samples, &accum);
+  sink->next_sample = sample_offset;
+
+  gst_audio_base_sink_drift_reset (sink, FALSE);
+}
+
 /* algorithm to calculate sample positions that will result in resampling to
  * match the clock rate of the master */
 static void
@@ -1214,22 +1553,14 @@ gst_audio_base_sink_resample_slaving (GstAudioBaseSink * sink,
   *srender_stop = render_stop;
 }
 
-/* algorithm to calculate sample positions that will result in changing the
- * playout pointer to match the clock rate of the master */
+/* samples the master and the internal clock and updates the running
+ * average of the skew between them */
 static void
-gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
-    GstClockTime render_start, GstClockTime render_stop,
-    GstClockTime * srender_start, GstClockTime * srender_stop)
+gst_audio_base_sink_update_skew (GstAudioBaseSink * sink,
+    GstClockTime cinternal, GstClockTime cexternal)
 {
-  GstClockTime cinternal, cexternal, crate_num, crate_denom;
   GstClockTime etime, itime;
-  GstClockTimeDiff skew, mdrift, mdrift2;
-  gint driftsamples;
-  gint64 last_align;
-
-  /* get calibration parameters to compensate for offsets */
-  gst_clock_get_calibration (sink->provided_clock, &cinternal, &cexternal,
-      &crate_num, &crate_denom);
+  GstClockTimeDiff skew;
 
   /* sample clocks and figure out clock skew */
   etime = gst_clock_get_time (GST_ELEMENT_CLOCK (sink));
@@ -1261,6 +1592,25 @@ gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
   GST_DEBUG_OBJECT (sink, "internal %" GST_TIME_FORMAT " external %"
       GST_TIME_FORMAT " skew %" G_GINT64_FORMAT " avg %" G_GINT64_FORMAT,
       GST_TIME_ARGS (itime), GST_TIME_ARGS (etime), skew, sink->priv->avg_skew);
+}
+
+/* algorithm to calculate sample positions that will result in changing the
+ * playout pointer to match the clock rate of the master */
+static void
+gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
+    GstClockTime render_start, GstClockTime render_stop,
+    GstClockTime * srender_start, GstClockTime * srender_stop)
+{
+  GstClockTime cinternal, cexternal, crate_num, crate_denom;
+  GstClockTimeDiff mdrift, mdrift2;
+  gint driftsamples;
+  gint64 last_align;
+
+  /* get calibration parameters to compensate for offsets */
+  gst_clock_get_calibration (sink->provided_clock, &cinternal, &cexternal,
+      &crate_num, &crate_denom);
+
+  gst_audio_base_sink_update_skew (sink, cinternal, cexternal);
 
   /* the max drift we allow */
   mdrift = sink->priv->drift_tolerance * 1000;
@@ -1323,6 +1673,43 @@ gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
   *srender_stop = render_stop;
 }
 
+/* algorithm to calculate the sample positions where the samples should be
+ * played according to the master clock. The render function then resamples
+ * the data so that the playout pointer converges to these positions. */
+static void
+gst_audio_base_sink_interpolate_slaving (GstAudioBaseSink * sink,
+    GstClockTime render_start, GstClockTime render_stop,
+    GstClockTime * srender_start, GstClockTime * srender_stop)
+{
+  GstClockTime cinternal, cexternal, crate_num, crate_denom;
+  GstClockTimeDiff skew;
+
+  /* get calibration parameters to compensate for offsets */
+  gst_clock_get_calibration (sink->provided_clock, &cinternal, &cexternal,
+      &crate_num, &crate_denom);
+
+  gst_audio_base_sink_update_skew (sink, cinternal, cexternal);
+  skew = sink->priv->avg_skew;
+
+  /* convert, ignoring speed */
+  render_start = clock_convert_external (render_start, cinternal, cexternal,
+      crate_num, crate_denom);
+  render_stop = clock_convert_external (render_stop, cinternal, cexternal,
+      crate_num, crate_denom);
+
+  /* and move to the internal time at which the master clock reaches them */
+  if (skew < 0) {
+    render_start = render_start > -skew ? render_start + skew : 0;
+    render_stop = render_stop > -skew ? render_stop + skew : 0;
+  } else {
+    render_start += skew;
+    render_stop += skew;
+  }
+
+  *srender_start = render_start;
+  *srender_stop = render_stop;
+}
+
 /* apply the clock offset but do no slaving otherwise */
 static void
 gst_audio_base_sink_none_slaving (GstAudioBaseSink * sink,
@@ -1364,6 +1751,10 @@ gst_audio_base_sink_handle_slaving (GstAudioBaseSink * sink,
       gst_audio_base_sink_none_slaving (sink, render_start, render_stop,
           srender_start, srender_stop);
       break;
+    case GST_AUDIO_BASE_SINK_SLAVE_INTERPOLATE:
+      gst_audio_base_sink_interpolate_slaving (sink, render_start,
+          render_stop, srender_start, srender_stop);
+      break;
     default:
       g_warning ("unknown slaving method %d", sink->priv->slave_method);
       break;
@@ -1476,11 +1867,13 @@ gst_audio_base_sink_sync_latency (GstBaseSink * bsink, GstMiniObject * obj)
       break;
     case GST_AUDIO_BASE_SINK_SLAVE_SKEW:
     case GST_AUDIO_BASE_SINK_SLAVE_NONE:
+    case GST_AUDIO_BASE_SINK_SLAVE_INTERPOLATE:
     default:
       break;
   }
 
   sink->priv->avg_skew = -1;
+  gst_audio_base_sink_drift_reset (sink, TRUE);
   sink->next_sample = -1;
   sink->priv->eos_time = -1;
   sink->priv->discont_time = -1;
@@ -1604,7 +1997,9 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   gint out_samples;
   GstClockTime base_time, render_delay, latency;
   GstClock *clock;
-  gboolean sync, slaved, align_next;
+  gboolean sync, slaved, align_next, interpolate = FALSE;
+  gdouble drift_target = 0.0;
+  const guint8 *data;
   GstFlowReturn ret;
   GstSegment clip_seg;
   gint64 time_offset;
@@ -1801,6 +2196,13 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
         &render_start, &render_stop);
   }
 
+  /* the interpolating slave method resamples the data, only possible for
+   * raw samples without rate conversion */
+  interpolate = slaved
+      && sink->priv->slave_method == GST_AUDIO_BASE_SINK_SLAVE_INTERPOLATE
+      && bsink->segment.rate == 1.0
+      && ringbuf->spec.type == GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW;
+
   GST_DEBUG_OBJECT (sink,
       "final timestamps: start %" GST_TIME_FORMAT " - stop %" GST_TIME_FORMAT,
       GST_TIME_ARGS (render_start), GST_TIME_ARGS (render_stop));
@@ -1828,6 +2230,10 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   if (G_UNLIKELY (render_start == 0 && render_stop == 0))
     goto too_late;
 
+  /* keep the fractional position for the interpolating slave method */
+  if (G_UNLIKELY (interpolate))
+    drift_target = gst_guint64_to_gdouble (render_start) * rate / GST_SECOND;
+
   /* and bring the time to the rate corrected offset in the buffer */
   render_start = gst_util_uint64_scale_int (render_start, rate, GST_SECOND);
   render_stop = gst_util_uint64_scale_int (render_stop, rate, GST_SECOND);
@@ -1848,6 +2254,7 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   /* always resync after a discont */
   if (G_UNLIKELY (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_DISCONT))) {
     GST_DEBUG_OBJECT (sink, "resync after discont");
+    gst_audio_base_sink_drift_reset (sink, FALSE);
     goto no_align;
   }
 
@@ -1855,12 +2262,37 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   if (G_UNLIKELY (sink->next_sample == -1)) {
     GST_DEBUG_OBJECT (sink,
         "no align possible: no previous sample position known");
+    gst_audio_base_sink_drift_reset (sink, FALSE);
     goto no_align;
   }
 
   align = gst_audio_base_sink_get_alignment (sink, sample_offset);
   sink->priv->last_align = align;
 
+  if (G_UNLIKELY (interpolate)) {
+    gdouble error, pos = 0.0;
+
+    /* the timestamps jumped, start over at the new position */
+    if (align == 0 && sample_offset != sink->next_sample) {
+      gst_audio_base_sink_drift_reset (sink, FALSE);
+      goto no_align;
+    }
+
+    /* position of the next output sample relative to the first sample of
+     * this buffer, it still has to come out of the filter history */
+    if (sink->priv->drift_phase >= 0.0)
+      pos = sink->priv->drift_phase - sink->priv->drift_hist;
+
+    /* always write after the previous sample and steer the ratio with the
+     * offset to where the master clock wants the sample */
+    error = drift_target + pos - sink->next_sample;
+    gst_audio_base_sink_drift_update (sink, error / rate,
+        (gdouble) samples / rate);
+
+    render_start = sink->next_sample;
+    goto no_align;
+  }
+
   /* apply alignment */
   render_start += align;
 
@@ -1873,6 +2305,16 @@ gst_audio_base_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   render_stop += align;
 
 no_align:
+  gst_buffer_map (buf, &info, GST_MAP_READ);
+  data = info.data + offset;
+
+  /* resample, this gives us the final number of samples to write */
+  if (G_UNLIKELY (interpolate)) {
+    samples = gst_audio_base_sink_drift_process (sink, data, samples,
+        &data);
+    render_stop = render_start + samples;
+  }
+
   /* number of target samples is difference between start and stop */
   out_samples = render_stop - render_start;
 
@@ -1888,11 +2330,10 @@ no_align:
   /* we need to accumulate over different runs for when we get interrupted */
   accum = 0;
   align_next = TRUE;
-  gst_buffer_map (buf, &info, GST_MAP_READ);
   do {
     written =
         gst_audio_ring_buffer_commit (ringbuf, &sample_offset,
-        info.data + offset, samples, out_samples, &accum);
+        (guint8 *) data, samples, out_samples, &accum);
 
     GST_DEBUG_OBJECT (sink, "wrote %u of %u", written, samples);
     /* if we wrote all, we're done */
@@ -1916,7 +2357,7 @@ no_align:
       break;
 
     samples -= written;
-    offset += written * bpf;
+    data += written * bpf;
   } while (TRUE);
   gst_buffer_unmap (buf, &info);
 
@@ -40,6 +40,7 @@
 
 #include <gst/audio/audio.h>
 #include "gstaudiobasesrc.h"
+#include "gstaudiothreadprivate.h"
 
 #include "gst/gst-i18n-plugin.h"
 
@@ -1213,8 +1214,7 @@ gst_audio_base_src_post_message (GstElement * element, GstMessage * message)
      * flow error message */
     ret = GST_ELEMENT_CLASS (parent_class)->post_message (element, message);
 
-    g_atomic_int_set (&ringbuffer->state, GST_AUDIO_RING_BUFFER_STATE_ERROR);
-    GST_AUDIO_RING_BUFFER_SIGNAL (ringbuffer);
+    __gst_audio_ring_buffer_set_error (ringbuffer);
     gst_object_unref (ringbuffer);
   } else {
     ret = GST_ELEMENT_CLASS (parent_class)->post_message (element, message);
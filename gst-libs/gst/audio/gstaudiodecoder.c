@@ -117,6 +117,14 @@
  * In non-live pipelines, baseclass can also (configurably) arrange for
  * output buffer aggregation which may help to redue large(r) numbers of
  * small(er) buffers being pushed and processed downstream.
+ * Subclasses decoding small frames can avoid allocating and copying each of
+ * them by decoding into gst_audio_decoder_get_output_region() and finishing
+ * with gst_audio_decoder_finish_frame_region(), the aggregated output is then
+ * allocated only once.
+ * Subclasses whose frames decode independently of each other can declare
+ * so with gst_audio_decoder_set_independent_frames(), in non-live
+ * pipelines frames are then decoded on several threads in batches
+ * (see #GstAudioDecoder:n-threads) while output is still pushed in order.
  *
  * On the other hand, it should be noted that baseclass only provides limited
  * seeking support (upon explicit subclass request), as full-fledged support
@@ -170,7 +178,8 @@ enum
   PROP_0,
   PROP_LATENCY,
   PROP_TOLERANCE,
-  PROP_PLC
+  PROP_PLC,
+  PROP_N_THREADS
 };
 
 #define DEFAULT_LATENCY    0
@@ -178,6 +187,11 @@ enum
 #define DEFAULT_PLC        FALSE
 #define DEFAULT_DRAINABLE  TRUE
 #define DEFAULT_NEEDS_FORMAT  FALSE
+#define DEFAULT_N_THREADS  0
+
+/* frames collected per thread before a batch of independent frames is
+ * decoded */
+#define GST_AUDIO_DECODER_BATCH_FRAMES  4
 
 typedef struct _GstAudioDecoderContext
 {
@@ -207,6 +221,26 @@ typedef struct _GstAudioDecoderContext
   GstAllocationParams params;
 } GstAudioDecoderContext;
 
+/* a frame decoded on one of the threads of a batch, its output is kept
+ * until all frames of the batch are decoded and then finished in order */
+typedef struct _GstAudioDecoderJob
+{
+  GstAudioDecoder *dec;
+  GstBuffer *frame;
+  GstFlowReturn ret;
+
+  /* decoded output, if any, once the subclass finished the frame */
+  gboolean finished;
+  GstBuffer *out;
+
+  /* region handed out by gst_audio_decoder_get_output_region() */
+  GstBuffer *region;
+  GstMapInfo region_map;
+} GstAudioDecoderJob;
+
+/* job of the frame the current thread is decoding, if any */
+static GPrivate current_job;
+
 struct _GstAudioDecoderPrivate
 {
   /* activation status */
@@ -228,6 +262,13 @@ struct _GstAudioDecoderPrivate
   GstAdapter *adapter_out;
   /* ts and duration for output data collected above */
   GstClockTime out_ts, out_dur;
+  /* output aggregate subclasses decode into, holding out_agg_fill bytes
+   * of pending output and mapped while a region is handed out */
+  GstBuffer *out_agg;
+  gsize out_agg_fill;
+  GstMapInfo out_agg_map;
+  gboolean out_agg_mapped;
+  GstClockTime out_agg_ts, out_agg_dur;
   /* mark outgoing discont */
   gboolean discont;
 
@@ -274,6 +315,19 @@ struct _GstAudioDecoderPrivate
 
   /* pending serialized sink events, will be sent from finish_frame() */
   GList *pending_events;
+
+  /* decoding independent frames in parallel */
+  gboolean independent;
+  guint n_threads;
+  GThreadPool *batch_pool;
+  GMutex batch_lock;
+  GCond batch_cond;
+  guint batch_workers;
+  gint batch_next;
+  /* frames collected for the next batch, in decoding order */
+  GstAudioDecoderJob *jobs;
+  guint n_jobs;
+  guint max_jobs;
 };
 
 
@@ -284,6 +338,13 @@ static void gst_audio_decoder_get_property (GObject * object,
     guint prop_id, GValue * value, GParamSpec * pspec);
 
 static void gst_audio_decoder_clear_queues (GstAudioDecoder * dec);
+static void gst_audio_decoder_clear_aggregate (GstAudioDecoder * dec);
+static GstAudioDecoderJob *gst_audio_decoder_current_job (GstAudioDecoder *
+    dec);
+static void gst_audio_decoder_clear_batch (GstAudioDecoder * dec);
+static GstFlowReturn gst_audio_decoder_decode_batch (GstAudioDecoder * dec);
+static GstFlowReturn gst_audio_decoder_finish_frame_full (GstAudioDecoder *
+    dec, GstBuffer * buf, gsize region, gint frames);
 static GstFlowReturn gst_audio_decoder_chain_reverse (GstAudioDecoder *
     dec, GstBuffer * buf);
 
@@ -389,6 +450,23 @@ gst_audio_decoder_class_init (GstAudioDecoderClass * klass)
           "Perform packet loss concealment (if supported)",
           DEFAULT_PLC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioDecoder:n-threads
+   *
+   * Number of threads used to decode frames when the subclass declared
+   * them independent with gst_audio_decoder_set_independent_frames(),
+   * 0 uses one thread per processor. Frames are then collected in batches
+   * that are decoded in parallel, which is only done in non-live pipelines
+   * as it adds latency.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads used to decode independent frames "
+          "(0 = one per processor)", 0, 64, DEFAULT_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   audiodecoder_class->sink_event =
       GST_DEBUG_FUNCPTR (gst_audio_decoder_sink_eventfunc);
   audiodecoder_class->src_event =
@@ -451,6 +529,10 @@ gst_audio_decoder_init (GstAudioDecoder * dec, GstAudioDecoderClass * klass)
   dec->priv->plc = DEFAULT_PLC;
   dec->priv->drainable = DEFAULT_DRAINABLE;
   dec->priv->needs_format = DEFAULT_NEEDS_FORMAT;
+  dec->priv->n_threads = DEFAULT_N_THREADS;
+
+  g_mutex_init (&dec->priv->batch_lock);
+  g_cond_init (&dec->priv->batch_cond);
 
   /* init state */
   gst_audio_decoder_reset (dec, TRUE);
@@ -496,12 +578,14 @@ gst_audio_decoder_reset (GstAudioDecoder * dec, gboolean full)
     gst_caps_replace (&dec->priv->ctx.input_caps, NULL);
   }
 
+  gst_audio_decoder_clear_batch (dec);
   g_queue_foreach (&dec->priv->frames, (GFunc) gst_buffer_unref, NULL);
   g_queue_clear (&dec->priv->frames);
   gst_adapter_clear (dec->priv->adapter);
   gst_adapter_clear (dec->priv->adapter_out);
   dec->priv->out_ts = GST_CLOCK_TIME_NONE;
   dec->priv->out_dur = 0;
+  gst_audio_decoder_clear_aggregate (dec);
   dec->priv->prev_ts = GST_CLOCK_TIME_NONE;
   dec->priv->prev_distance = 0;
   dec->priv->drained = TRUE;
@@ -527,6 +611,14 @@ gst_audio_decoder_finalize (GObject * object)
   if (dec->priv->adapter_out) {
     g_object_unref (dec->priv->adapter_out);
   }
+  gst_audio_decoder_clear_aggregate (dec);
+
+  gst_audio_decoder_clear_batch (dec);
+  if (dec->priv->batch_pool)
+    g_thread_pool_free (dec->priv->batch_pool, FALSE, TRUE);
+  g_free (dec->priv->jobs);
+  g_mutex_clear (&dec->priv->batch_lock);
+  g_cond_clear (&dec->priv->batch_cond);
 
   g_rec_mutex_clear (&dec->stream_lock);
 
@@ -876,6 +968,71 @@ exit:
   return ret;
 }
 
+static void
+gst_audio_decoder_clear_aggregate (GstAudioDecoder * dec)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+
+  if (priv->out_agg) {
+    if (priv->out_agg_mapped)
+      gst_buffer_unmap (priv->out_agg, &priv->out_agg_map);
+    gst_buffer_unref (priv->out_agg);
+    priv->out_agg = NULL;
+  }
+  priv->out_agg_mapped = FALSE;
+  priv->out_agg_fill = 0;
+  priv->out_agg_ts = GST_CLOCK_TIME_NONE;
+  priv->out_agg_dur = 0;
+}
+
+static GstFlowReturn
+gst_audio_decoder_push_output (GstAudioDecoder * dec, GstBuffer * buf)
+{
+  GstFlowReturn ret;
+
+  if (dec->output_segment.rate > 0.0) {
+    ret = gst_audio_decoder_push_forward (dec, buf);
+    GST_LOG_OBJECT (dec, "buffer pushed: %s", gst_flow_get_name (ret));
+  } else {
+    ret = GST_FLOW_OK;
+    dec->priv->queued = g_list_prepend (dec->priv->queued, buf);
+    GST_LOG_OBJECT (dec, "buffer queued");
+  }
+
+  return ret;
+}
+
+/* sends the data subclasses decoded into the output aggregate so far */
+static GstFlowReturn
+gst_audio_decoder_push_aggregate (GstAudioDecoder * dec)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  GstBuffer *buf;
+
+  if (!priv->out_agg_fill)
+    return GST_FLOW_OK;
+
+  if (priv->out_agg_mapped) {
+    gst_buffer_unmap (priv->out_agg, &priv->out_agg_map);
+    priv->out_agg_mapped = FALSE;
+  }
+
+  GST_LOG_OBJECT (dec, "pushing aggregate of %" G_GSIZE_FORMAT " bytes",
+      priv->out_agg_fill);
+
+  buf = priv->out_agg;
+  gst_buffer_resize (buf, 0, priv->out_agg_fill);
+  GST_BUFFER_TIMESTAMP (buf) = priv->out_agg_ts;
+  GST_BUFFER_DURATION (buf) = priv->out_agg_dur;
+
+  priv->out_agg = NULL;
+  priv->out_agg_fill = 0;
+  priv->out_agg_ts = GST_CLOCK_TIME_NONE;
+  priv->out_agg_dur = 0;
+
+  return gst_audio_decoder_push_output (dec, buf);
+}
+
 /* mini aggregator combining output buffers into fewer larger ones,
  * if so allowed/configured */
 static GstFlowReturn
@@ -890,6 +1047,16 @@ gst_audio_decoder_output (GstAudioDecoder * dec, GstBuffer * buf)
   if (G_UNLIKELY (priv->agg < 0))
     gst_audio_decoder_setup (dec);
 
+  /* data decoded in place goes first */
+  if (G_UNLIKELY (priv->out_agg_fill)) {
+    ret = gst_audio_decoder_push_aggregate (dec);
+    if (ret != GST_FLOW_OK) {
+      if (buf)
+        gst_buffer_unref (buf);
+      return ret;
+    }
+  }
+
   if (G_LIKELY (buf)) {
     GST_LOG_OBJECT (dec,
         "output buffer of size %" G_GSIZE_FORMAT " with ts %" GST_TIME_FORMAT
@@ -945,14 +1112,7 @@ again:
   }
 
   if (G_LIKELY (buf)) {
-    if (dec->output_segment.rate > 0.0) {
-      ret = gst_audio_decoder_push_forward (dec, buf);
-      GST_LOG_OBJECT (dec, "buffer pushed: %s", gst_flow_get_name (ret));
-    } else {
-      ret = GST_FLOW_OK;
-      priv->queued = g_list_prepend (priv->queued, buf);
-      GST_LOG_OBJECT (dec, "buffer queued");
-    }
+    ret = gst_audio_decoder_push_output (dec, buf);
 
     if (inbuf) {
       buf = inbuf;
@@ -978,6 +1138,73 @@ send_pending_events (GstAudioDecoder * dec)
   g_list_free (pending_events);
 }
 
+/* the subclass decoded @size bytes into the output aggregate, which are
+ * appended to it and sent once the aggregate is complete */
+static GstFlowReturn
+gst_audio_decoder_output_region (GstAudioDecoder * dec, gsize size,
+    GstClockTime ts, GstClockTime dur)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  GstFlowReturn ret = GST_FLOW_OK;
+  const GstClockTimeDiff tol = 10 * GST_MSECOND;
+
+  GST_LOG_OBJECT (dec,
+      "output region of size %" G_GSIZE_FORMAT " with ts %" GST_TIME_FORMAT
+      ", duration %" GST_TIME_FORMAT, size, GST_TIME_ARGS (ts),
+      GST_TIME_ARGS (dur));
+
+  /* data collected from regular buffers goes first, there is no pending
+   * data in the aggregate then */
+  if (G_UNLIKELY (gst_adapter_available (priv->adapter_out)))
+    ret = gst_audio_decoder_output (dec, NULL);
+
+  /* a gap in the timestamps ends the aggregate, the new data then moves to
+   * the next one */
+  if (priv->out_agg_fill && (!GST_CLOCK_TIME_IS_VALID (ts) ||
+          !GST_CLOCK_TIME_IS_VALID (priv->out_agg_ts) ||
+          ABS (GST_CLOCK_DIFF (ts, priv->out_agg_ts + priv->out_agg_dur)) >
+          tol)) {
+    GstBuffer *next;
+
+    GST_LOG_OBJECT (dec, "region apart from current aggregate");
+    next = gst_audio_decoder_allocate_output_buffer (dec,
+        gst_buffer_get_size (priv->out_agg));
+    gst_buffer_fill (next, 0, priv->out_agg_map.data + priv->out_agg_fill,
+        size);
+    ret = gst_audio_decoder_push_aggregate (dec);
+    priv->out_agg = next;
+  } else if (priv->out_agg_mapped) {
+    gst_buffer_unmap (priv->out_agg, &priv->out_agg_map);
+    priv->out_agg_mapped = FALSE;
+  }
+
+  if (!priv->out_agg_fill)
+    priv->out_agg_ts = ts;
+  priv->out_agg_fill += size;
+  priv->out_agg_dur += dur;
+
+  /* send unless aggregating and there is room for a region like this one */
+  if (priv->agg <= 0 || priv->latency == 0 ||
+      priv->out_agg_dur > priv->latency || dec->output_segment.rate < 0.0 ||
+      priv->out_agg_fill + size > gst_buffer_get_size (priv->out_agg)) {
+    GstFlowReturn res = gst_audio_decoder_push_aggregate (dec);
+
+    if (ret == GST_FLOW_OK)
+      ret = res;
+  }
+
+  return ret;
+}
+
+/* output of a frame decoded as part of a batch is kept with its job */
+static void
+gst_audio_decoder_job_finish (GstAudioDecoderJob * job, GstBuffer * buf)
+{
+  if (buf)
+    job->out = job->out ? gst_buffer_append (job->out, buf) : buf;
+  job->finished = TRUE;
+}
+
 /**
  * gst_audio_decoder_finish_frame:
  * @dec: a #GstAudioDecoder
@@ -1001,12 +1228,7 @@ GstFlowReturn
 gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
     gint frames)
 {
-  GstAudioDecoderPrivate *priv;
-  GstAudioDecoderContext *ctx;
-  gint samples = 0;
-  GstClockTime ts, next_ts;
-  gsize size;
-  GstFlowReturn ret = GST_FLOW_OK;
+  GstAudioDecoderJob *job;
 
   /* subclass should not hand us no data */
   g_return_val_if_fail (buf == NULL || gst_buffer_get_size (buf) > 0,
@@ -1014,22 +1236,216 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
   /* no dummy calls please */
   g_return_val_if_fail (frames != 0, GST_FLOW_ERROR);
 
+  job = gst_audio_decoder_current_job (dec);
+  if (job) {
+    gst_audio_decoder_job_finish (job, buf);
+    return GST_FLOW_OK;
+  }
+
+  return gst_audio_decoder_finish_frame_full (dec, buf, 0, frames);
+}
+
+/**
+ * gst_audio_decoder_get_output_region:
+ * @dec: a #GstAudioDecoder
+ * @size: number of bytes the subclass will decode
+ *
+ * Lets subclasses decode directly into the output of @dec instead of
+ * allocating a buffer per frame. The returned memory is part of a larger
+ * buffer that is allocated once for all data that is aggregated according
+ * to #GstAudioDecoder:min-latency, so no copies are needed to combine
+ * small frames.
+ *
+ * The memory stays valid until the decoded data is handed to
+ * gst_audio_decoder_finish_frame_region(), which must be called before
+ * any other output is finished. Source pad caps must be set before
+ * calling this function.
+ *
+ * Returns: (transfer none): @size writable bytes, or NULL on failure
+ *
+ * Since: 1.2
+ */
+guint8 *
+gst_audio_decoder_get_output_region (GstAudioDecoder * dec, gsize size)
+{
+  GstAudioDecoderPrivate *priv;
+  GstAudioDecoderContext *ctx;
+  GstAudioDecoderJob *job;
+  guint8 *data = NULL;
+
+  g_return_val_if_fail (GST_IS_AUDIO_DECODER (dec), NULL);
+  g_return_val_if_fail (size > 0, NULL);
+
   priv = dec->priv;
   ctx = &dec->priv->ctx;
-  size = buf ? gst_buffer_get_size (buf) : 0;
+
+  g_return_val_if_fail (GST_AUDIO_INFO_IS_VALID (&ctx->info), NULL);
+
+  /* frames of a batch are decoded into a buffer of their own */
+  job = gst_audio_decoder_current_job (dec);
+  if (job) {
+    if (job->region) {
+      gst_buffer_unmap (job->region, &job->region_map);
+      gst_buffer_unref (job->region);
+    }
+    job->region = gst_audio_decoder_allocate_output_buffer (dec, size);
+    if (!gst_buffer_map (job->region, &job->region_map, GST_MAP_WRITE)) {
+      GST_WARNING_OBJECT (dec, "could not map output region");
+      gst_buffer_unref (job->region);
+      job->region = NULL;
+      return NULL;
+    }
+    return job->region_map.data;
+  }
+
+  GST_AUDIO_DECODER_STREAM_LOCK (dec);
+
+  if (G_UNLIKELY (priv->agg < 0))
+    gst_audio_decoder_setup (dec);
+
+  /* a region that was never finished is simply overwritten */
+  if (priv->out_agg_mapped) {
+    gst_buffer_unmap (priv->out_agg, &priv->out_agg_map);
+    priv->out_agg_mapped = FALSE;
+  }
+
+  if (!priv->out_agg ||
+      priv->out_agg_fill + size > gst_buffer_get_size (priv->out_agg)) {
+    GstBuffer *buf;
+    gsize alloc = priv->out_agg_fill + size;
+
+    /* room for a complete aggregate, it is sent as soon as it exceeds the
+     * latency so one more region of this size is enough slack */
+    if (priv->agg > 0 && priv->latency > 0) {
+      alloc = MAX (alloc, gst_util_uint64_scale_int_ceil (priv->latency,
+              ctx->info.rate, GST_SECOND) * ctx->info.bpf + size);
+    }
+
+    GST_LOG_OBJECT (dec, "allocating aggregate of %" G_GSIZE_FORMAT " bytes",
+        alloc);
+    buf = gst_audio_decoder_allocate_output_buffer (dec, alloc);
+
+    /* only when a region was larger than expected, keep what we have */
+    if (priv->out_agg) {
+      GstMapInfo map;
+
+      if (priv->out_agg_fill) {
+        gst_buffer_map (priv->out_agg, &map, GST_MAP_READ);
+        gst_buffer_fill (buf, 0, map.data, priv->out_agg_fill);
+        gst_buffer_unmap (priv->out_agg, &map);
+      }
+      gst_buffer_unref (priv->out_agg);
+    }
+    priv->out_agg = buf;
+  }
+
+  if (gst_buffer_map (priv->out_agg, &priv->out_agg_map, GST_MAP_WRITE)) {
+    priv->out_agg_mapped = TRUE;
+    data = priv->out_agg_map.data + priv->out_agg_fill;
+  } else {
+    GST_WARNING_OBJECT (dec, "could not map output aggregate");
+  }
+
+  GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+
+  return data;
+}
+
+/**
+ * gst_audio_decoder_finish_frame_region:
+ * @dec: a #GstAudioDecoder
+ * @size: number of bytes decoded into the region
+ * @frames: number of decoded frames represented by decoded data
+ *
+ * Like gst_audio_decoder_finish_frame(), but for data that was decoded
+ * into the memory returned by gst_audio_decoder_get_output_region(). @size
+ * may be smaller than the size of the region, when it is 0 the indicated
+ * number of frames are discarded.
+ *
+ * Returns: a #GstFlowReturn that should be escalated to caller (of caller)
+ *
+ * Since: 1.2
+ */
+GstFlowReturn
+gst_audio_decoder_finish_frame_region (GstAudioDecoder * dec, gsize size,
+    gint frames)
+{
+  GstAudioDecoderPrivate *priv;
+  GstAudioDecoderJob *job;
+
+  g_return_val_if_fail (GST_IS_AUDIO_DECODER (dec), GST_FLOW_ERROR);
+  /* no dummy calls please */
+  g_return_val_if_fail (frames != 0, GST_FLOW_ERROR);
+
+  priv = dec->priv;
+
+  job = gst_audio_decoder_current_job (dec);
+  if (job) {
+    GstBuffer *buf = job->region;
+
+    g_return_val_if_fail (size == 0 || (buf && size <= job->region_map.size),
+        GST_FLOW_ERROR);
+
+    if (buf) {
+      gst_buffer_unmap (buf, &job->region_map);
+      job->region = NULL;
+      if (size > 0) {
+        gst_buffer_resize (buf, 0, size);
+      } else {
+        gst_buffer_unref (buf);
+        buf = NULL;
+      }
+    }
+    gst_audio_decoder_job_finish (job, buf);
+    return GST_FLOW_OK;
+  }
+
+  GST_AUDIO_DECODER_STREAM_LOCK (dec);
+  if (G_UNLIKELY (size > 0 && (!priv->out_agg_mapped ||
+              priv->out_agg_fill + size > priv->out_agg_map.size))) {
+    GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+    g_return_val_if_reached (GST_FLOW_ERROR);
+  }
+  if (size == 0 && priv->out_agg_mapped) {
+    gst_buffer_unmap (priv->out_agg, &priv->out_agg_map);
+    priv->out_agg_mapped = FALSE;
+  }
+  GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+
+  return gst_audio_decoder_finish_frame_full (dec, NULL, size, frames);
+}
+
+/* decoded data is either in @buf or, when @region is not 0, in the next
+ * @region bytes of the output aggregate */
+static GstFlowReturn
+gst_audio_decoder_finish_frame_full (GstAudioDecoder * dec, GstBuffer * buf,
+    gsize region, gint frames)
+{
+  GstAudioDecoderPrivate *priv;
+  GstAudioDecoderContext *ctx;
+  gint samples = 0;
+  GstClockTime ts, next_ts, out_ts, out_dur;
+  gsize size;
+  gboolean has_data;
+  GstFlowReturn ret = GST_FLOW_OK;
+
+  priv = dec->priv;
+  ctx = &dec->priv->ctx;
+  size = buf ? gst_buffer_get_size (buf) : region;
+  has_data = size > 0;
 
   /* must know the output format by now */
-  g_return_val_if_fail (buf == NULL || GST_AUDIO_INFO_IS_VALID (&ctx->info),
+  g_return_val_if_fail (!has_data || GST_AUDIO_INFO_IS_VALID (&ctx->info),
       GST_FLOW_ERROR);
 
   GST_LOG_OBJECT (dec,
       "accepting %" G_GSIZE_FORMAT " bytes == %" G_GSIZE_FORMAT
-      " samples for %d frames", buf ? size : -1,
-      buf ? size / ctx->info.bpf : -1, frames);
+      " samples for %d frames", has_data ? size : -1,
+      has_data ? size / ctx->info.bpf : -1, frames);
 
   GST_AUDIO_DECODER_STREAM_LOCK (dec);
 
-  if (buf && G_UNLIKELY (ctx->output_format_changed ||
+  if (has_data && G_UNLIKELY (ctx->output_format_changed ||
           (GST_AUDIO_INFO_IS_VALID (&ctx->info)
               && gst_pad_check_reconfigure (dec->srcpad)))) {
     if (!gst_audio_decoder_negotiate (dec)) {
@@ -1041,12 +1457,12 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
     }
   }
 
-  if (buf && priv->pending_events) {
+  if (has_data && priv->pending_events) {
     send_pending_events (dec);
   }
 
   /* output shoud be whole number of sample frames */
-  if (G_LIKELY (buf && ctx->info.bpf)) {
+  if (G_LIKELY (has_data && ctx->info.bpf)) {
     if (size % ctx->info.bpf)
       goto wrong_buffer;
     /* per channel least */
@@ -1081,7 +1497,7 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
     frames--;
   }
 
-  if (G_UNLIKELY (!buf))
+  if (G_UNLIKELY (!has_data))
     goto exit;
 
   /* lock on */
@@ -1129,18 +1545,15 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
     priv->taglist_changed = FALSE;
   }
 
-  buf = gst_buffer_make_writable (buf);
   if (G_LIKELY (GST_CLOCK_TIME_IS_VALID (priv->base_ts))) {
-    GST_BUFFER_TIMESTAMP (buf) =
-        priv->base_ts +
+    out_ts = priv->base_ts +
         GST_FRAMES_TO_CLOCK_TIME (priv->samples, ctx->info.rate);
-    GST_BUFFER_DURATION (buf) = priv->base_ts +
+    out_dur = priv->base_ts +
         GST_FRAMES_TO_CLOCK_TIME (priv->samples + samples, ctx->info.rate) -
-        GST_BUFFER_TIMESTAMP (buf);
+        out_ts;
   } else {
-    GST_BUFFER_TIMESTAMP (buf) = GST_CLOCK_TIME_NONE;
-    GST_BUFFER_DURATION (buf) =
-        GST_FRAMES_TO_CLOCK_TIME (samples, ctx->info.rate);
+    out_ts = GST_CLOCK_TIME_NONE;
+    out_dur = GST_FRAMES_TO_CLOCK_TIME (samples, ctx->info.rate);
   }
   priv->samples += samples;
   priv->samples_out += samples;
@@ -1149,7 +1562,14 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
   if (G_UNLIKELY (dec->priv->error_count))
     dec->priv->error_count = 0;
 
-  ret = gst_audio_decoder_output (dec, buf);
+  if (buf) {
+    buf = gst_buffer_make_writable (buf);
+    GST_BUFFER_TIMESTAMP (buf) = out_ts;
+    GST_BUFFER_DURATION (buf) = out_dur;
+    ret = gst_audio_decoder_output (dec, buf);
+  } else {
+    ret = gst_audio_decoder_output_region (dec, size, out_ts, out_dur);
+  }
 
 exit:
 
@@ -1163,7 +1583,8 @@ wrong_buffer:
     GST_ELEMENT_ERROR (dec, STREAM, ENCODE, (NULL),
         ("buffer size %" G_GSIZE_FORMAT " not a multiple of %d", size,
             ctx->info.bpf));
-    gst_buffer_unref (buf);
+    if (buf)
+      gst_buffer_unref (buf);
     ret = GST_FLOW_ERROR;
     goto exit;
   }
@@ -1179,10 +1600,197 @@ overflow:
   }
 }
 
+static GstAudioDecoderJob *
+gst_audio_decoder_current_job (GstAudioDecoder * dec)
+{
+  GstAudioDecoderJob *job = g_private_get (&current_job);
+
+  return job && job->dec == dec ? job : NULL;
+}
+
+/* number of threads to decode frames with, batching only pays off if the
+ * subclass can decode frames independently and adds latency, so it is not
+ * done in live pipelines */
+static guint
+gst_audio_decoder_parallel_threads (GstAudioDecoder * dec)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  guint n_threads;
+
+  GST_OBJECT_LOCK (dec);
+  n_threads = priv->independent ? priv->n_threads : 1;
+  GST_OBJECT_UNLOCK (dec);
+
+  if (n_threads == 1)
+    return 1;
+
+  if (G_UNLIKELY (priv->agg < 0))
+    gst_audio_decoder_setup (dec);
+  if (!priv->agg)
+    return 1;
+
+#if GLIB_CHECK_VERSION(2,36,0)
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+#endif
+
+  return MAX (n_threads, 1);
+}
+
+static void
+gst_audio_decoder_clear_batch (GstAudioDecoder * dec)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  guint i;
+
+  for (i = 0; i < priv->n_jobs; i++) {
+    GstAudioDecoderJob *job = &priv->jobs[i];
+
+    if (job->out)
+      gst_buffer_unref (job->out);
+    if (job->region) {
+      gst_buffer_unmap (job->region, &job->region_map);
+      gst_buffer_unref (job->region);
+    }
+  }
+  priv->n_jobs = 0;
+}
+
+static void
+gst_audio_decoder_decode_jobs (GstAudioDecoder * dec)
+{
+  GstAudioDecoderClass *klass = GST_AUDIO_DECODER_GET_CLASS (dec);
+  GstAudioDecoderPrivate *priv = dec->priv;
+  guint i;
+
+  while ((i = g_atomic_int_add (&priv->batch_next, 1)) < priv->n_jobs) {
+    GstAudioDecoderJob *job = &priv->jobs[i];
+
+    g_private_set (&current_job, job);
+    job->ret = klass->handle_frame (dec, job->frame);
+    g_private_set (&current_job, NULL);
+
+    /* a region that was never finished is discarded */
+    if (job->region) {
+      gst_buffer_unmap (job->region, &job->region_map);
+      gst_buffer_unref (job->region);
+      job->region = NULL;
+    }
+  }
+}
+
+static void
+gst_audio_decoder_batch_func (gpointer data, gpointer user_data)
+{
+  GstAudioDecoder *dec = data;
+  GstAudioDecoderPrivate *priv = dec->priv;
+
+  gst_audio_decoder_decode_jobs (dec);
+
+  g_mutex_lock (&priv->batch_lock);
+  if (--priv->batch_workers == 0)
+    g_cond_signal (&priv->batch_cond);
+  g_mutex_unlock (&priv->batch_lock);
+}
+
+/* Decodes all collected frames, the streaming thread takes part and the
+ * other threads come from a pool. Called with the stream lock, which the
+ * streaming thread keeps while the pool threads call the subclass, output
+ * is only finished in order afterwards. */
+static GstFlowReturn
+gst_audio_decoder_decode_batch (GstAudioDecoder * dec)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i, n_workers;
+
+  if (G_LIKELY (priv->n_jobs == 0))
+    return GST_FLOW_OK;
+
+  n_workers = MIN (gst_audio_decoder_parallel_threads (dec), priv->n_jobs) - 1;
+
+  GST_LOG_OBJECT (dec, "decoding batch of %u frames on %u threads",
+      priv->n_jobs, n_workers + 1);
+
+  priv->batch_next = 0;
+  if (n_workers > 0) {
+    if (priv->batch_pool == NULL) {
+      priv->batch_pool = g_thread_pool_new (gst_audio_decoder_batch_func,
+          NULL, n_workers, FALSE, NULL);
+    } else if (g_thread_pool_get_max_threads (priv->batch_pool) != n_workers) {
+      g_thread_pool_set_max_threads (priv->batch_pool, n_workers, NULL);
+    }
+
+    priv->batch_workers = n_workers;
+    for (i = 0; i < n_workers; i++)
+      g_thread_pool_push (priv->batch_pool, dec, NULL);
+  }
+
+  gst_audio_decoder_decode_jobs (dec);
+
+  if (n_workers > 0) {
+    g_mutex_lock (&priv->batch_lock);
+    while (priv->batch_workers > 0)
+      g_cond_wait (&priv->batch_cond, &priv->batch_lock);
+    g_mutex_unlock (&priv->batch_lock);
+  }
+
+  /* every job is one frame, after an error the remaining ones are
+   * dropped */
+  for (i = 0; i < priv->n_jobs; i++) {
+    GstAudioDecoderJob *job = &priv->jobs[i];
+    GstBuffer *out = job->out;
+
+    job->out = NULL;
+    if (ret == GST_FLOW_OK)
+      ret = job->ret;
+
+    if (ret == GST_FLOW_OK) {
+      if (G_UNLIKELY (!job->finished))
+        GST_WARNING_OBJECT (dec, "independent frame was not finished");
+      ret = gst_audio_decoder_finish_frame_full (dec, out, 0, 1);
+    } else {
+      if (out)
+        gst_buffer_unref (out);
+      gst_audio_decoder_finish_frame_full (dec, NULL, 0, 1);
+    }
+  }
+  priv->n_jobs = 0;
+
+  return ret;
+}
+
+static GstFlowReturn
+gst_audio_decoder_batch_frame (GstAudioDecoder * dec, GstBuffer * buffer,
+    guint n_threads)
+{
+  GstAudioDecoderPrivate *priv = dec->priv;
+  GstAudioDecoderJob *job;
+  guint batch = n_threads * GST_AUDIO_DECODER_BATCH_FRAMES;
+
+  if (priv->max_jobs < batch) {
+    priv->jobs = g_renew (GstAudioDecoderJob, priv->jobs, batch);
+    priv->max_jobs = batch;
+  }
+
+  job = &priv->jobs[priv->n_jobs++];
+  memset (job, 0, sizeof (GstAudioDecoderJob));
+  job->dec = dec;
+  job->frame = buffer;
+
+  if (priv->n_jobs < batch)
+    return GST_FLOW_OK;
+
+  return gst_audio_decoder_decode_batch (dec);
+}
+
 static GstFlowReturn
 gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     GstAudioDecoderClass * klass, GstBuffer * buffer)
 {
+  GstFlowReturn ret;
+  guint n_threads = 1;
+
   if (G_LIKELY (buffer)) {
     gsize size = gst_buffer_get_size (buffer);
     /* keep around for admin */
@@ -1192,10 +1800,21 @@ gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     g_queue_push_tail (&dec->priv->frames, buffer);
     dec->priv->ctx.delay = dec->priv->frames.length;
     dec->priv->bytes_in += size;
+    /* concealment is always done in order */
+    if (size > 0)
+      n_threads = gst_audio_decoder_parallel_threads (dec);
   } else {
     GST_LOG_OBJECT (dec, "providing subclass with NULL frame");
   }
 
+  if (n_threads > 1)
+    return gst_audio_decoder_batch_frame (dec, buffer, n_threads);
+
+  /* frames of a pending batch go first */
+  ret = gst_audio_decoder_decode_batch (dec);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
   return klass->handle_frame (dec, buffer);
 }
 
@@ -1306,6 +1925,10 @@ gst_audio_decoder_push_buffers (GstAudioDecoder * dec, gboolean force)
     g_assert (av >= 0);
   }
 
+  /* draining, so no more frames will join the batch */
+  if (force && ret == GST_FLOW_OK)
+    ret = gst_audio_decoder_decode_batch (dec);
+
   GST_LOG_OBJECT (dec, "done pushing to subclass");
   return ret;
 
@@ -1335,6 +1958,7 @@ gst_audio_decoder_drain (GstAudioDecoder * dec)
     /* ensure all output sent */
     ret = gst_audio_decoder_output (dec, NULL);
     /* everything should be away now */
+    gst_audio_decoder_clear_batch (dec);
     if (dec->priv->frames.length) {
       /* not fatal/impossible though if subclass/codec eats stuff */
       GST_WARNING_OBJECT (dec, "still %d frames left after draining",
@@ -1622,6 +2246,16 @@ gst_audio_decoder_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   if (G_UNLIKELY (dec->priv->do_caps)) {
     GstCaps *caps = gst_pad_get_current_caps (dec->sinkpad);
     if (caps) {
+      /* frames of a pending batch are still in the old format, the caps are
+       * set again with the next buffer if they could not be output */
+      GST_AUDIO_DECODER_STREAM_LOCK (dec);
+      ret = gst_audio_decoder_decode_batch (dec);
+      GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+      if (ret != GST_FLOW_OK) {
+        gst_caps_unref (caps);
+        gst_buffer_unref (buffer);
+        return ret;
+      }
       if (!gst_audio_decoder_sink_setcaps (dec, caps)) {
         gst_caps_unref (caps);
         goto not_negotiated;
@@ -1695,6 +2329,7 @@ gst_audio_decoder_do_byte (GstAudioDecoder * dec)
 static gboolean
 gst_audio_decoder_sink_eventfunc (GstAudioDecoder * dec, GstEvent * event)
 {
+  GstFlowReturn flow;
   gboolean ret;
 
   switch (GST_EVENT_TYPE (event)) {
@@ -1799,6 +2434,16 @@ gst_audio_decoder_sink_eventfunc (GstAudioDecoder * dec, GstEvent * event)
       } else {
         /* FIXME: sub-class doesn't know how to handle empty buffers,
          * so just try sending GAP downstream */
+        GST_AUDIO_DECODER_STREAM_LOCK (dec);
+        flow = gst_audio_decoder_decode_batch (dec);
+        GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+        if (flow != GST_FLOW_OK) {
+          GST_DEBUG_OBJECT (dec, "dropping gap event, batch returned %s",
+              gst_flow_get_name (flow));
+          gst_event_unref (event);
+          ret = FALSE;
+          break;
+        }
         send_pending_events (dec);
         ret = gst_audio_decoder_push_event (dec, event);
       }
@@ -1863,10 +2508,19 @@ gst_audio_decoder_sink_eventfunc (GstAudioDecoder * dec, GstEvent * event)
         GST_DEBUG_OBJECT (dec, "Enqueuing event %d, %s", GST_EVENT_TYPE (event),
             GST_EVENT_TYPE_NAME (event));
         GST_AUDIO_DECODER_STREAM_LOCK (dec);
-        dec->priv->pending_events =
-            g_list_append (dec->priv->pending_events, event);
+        /* keep the event after the output of frames received before it */
+        flow = gst_audio_decoder_decode_batch (dec);
+        if (flow == GST_FLOW_OK) {
+          dec->priv->pending_events =
+              g_list_append (dec->priv->pending_events, event);
+          ret = TRUE;
+        } else {
+          GST_DEBUG_OBJECT (dec, "dropping event, batch returned %s",
+              gst_flow_get_name (flow));
+          gst_event_unref (event);
+          ret = FALSE;
+        }
         GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
-        ret = TRUE;
       }
       break;
   }
@@ -2398,6 +3052,11 @@ gst_audio_decoder_get_property (GObject * object, guint prop_id,
     case PROP_PLC:
       g_value_set_boolean (value, dec->priv->plc);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (dec);
+      g_value_set_uint (value, dec->priv->n_threads);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2422,6 +3081,11 @@ gst_audio_decoder_set_property (GObject * object, guint prop_id,
     case PROP_PLC:
       dec->priv->plc = g_value_get_boolean (value);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (dec);
+      dec->priv->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2505,13 +3169,22 @@ _gst_audio_decoder_error (GstAudioDecoder * dec, gint weight,
     GQuark domain, gint code, gchar * txt, gchar * dbg, const gchar * file,
     const gchar * function, gint line)
 {
+  gboolean fatal;
+  gboolean in_batch = gst_audio_decoder_current_job (dec) != NULL;
+
   if (txt)
     GST_WARNING_OBJECT (dec, "error: %s", txt);
   if (dbg)
     GST_WARNING_OBJECT (dec, "error: %s", dbg);
+  /* frames of a batch may fail concurrently */
+  if (in_batch)
+    g_mutex_lock (&dec->priv->batch_lock);
   dec->priv->error_count += weight;
   dec->priv->discont = TRUE;
-  if (dec->priv->ctx.max_errors < dec->priv->error_count) {
+  fatal = dec->priv->ctx.max_errors < dec->priv->error_count;
+  if (in_batch)
+    g_mutex_unlock (&dec->priv->batch_lock);
+  if (fatal) {
     gst_element_message_full (GST_ELEMENT (dec), GST_MESSAGE_ERROR,
         domain, code, txt, dbg, file, function, line);
     return GST_FLOW_ERROR;
@@ -2928,6 +3601,61 @@ gst_audio_decoder_get_needs_format (GstAudioDecoder * dec)
   return result;
 }
 
+/**
+ * gst_audio_decoder_set_independent_frames:
+ * @dec: a #GstAudioDecoder
+ * @enabled: new state
+ *
+ * Declares that every frame can be decoded without the ones before it,
+ * so that @handle_frame may be called for several frames concurrently, see
+ * #GstAudioDecoder:n-threads. The subclass must then finish each frame
+ * before returning from @handle_frame, with one call to
+ * gst_audio_decoder_finish_frame() or
+ * gst_audio_decoder_finish_frame_region() for exactly that frame, and may
+ * not keep state across frames or change the output format while decoding
+ * them. Output is still pushed in order.
+ *
+ * MT safe.
+ *
+ * Since: 1.2
+ */
+void
+gst_audio_decoder_set_independent_frames (GstAudioDecoder * dec,
+    gboolean enabled)
+{
+  g_return_if_fail (GST_IS_AUDIO_DECODER (dec));
+
+  GST_OBJECT_LOCK (dec);
+  dec->priv->independent = enabled;
+  GST_OBJECT_UNLOCK (dec);
+}
+
+/**
+ * gst_audio_decoder_get_independent_frames:
+ * @dec: a #GstAudioDecoder
+ *
+ * Queries whether frames are declared independent.
+ *
+ * Returns: TRUE if frames may be decoded concurrently.
+ *
+ * MT safe.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_audio_decoder_get_independent_frames (GstAudioDecoder * dec)
+{
+  gboolean result;
+
+  g_return_val_if_fail (GST_IS_AUDIO_DECODER (dec), FALSE);
+
+  GST_OBJECT_LOCK (dec);
+  result = dec->priv->independent;
+  GST_OBJECT_UNLOCK (dec);
+
+  return result;
+}
+
 /**
  * gst_audio_decoder_merge_tags:
  * @dec: a #GstAudioDecoder
@@ -2983,6 +3711,16 @@ gst_audio_decoder_allocate_output_buffer (GstAudioDecoder * dec, gsize size)
 
   GST_DEBUG ("alloc src buffer");
 
+  /* the streaming thread holds the stream lock while a batch is decoded,
+   * the format is only negotiated once its output is finished */
+  if (gst_audio_decoder_current_job (dec)) {
+    buffer = gst_buffer_new_allocate (dec->priv->ctx.allocator, size,
+        &dec->priv->ctx.params);
+    if (!buffer)
+      buffer = gst_buffer_new_allocate (NULL, size, NULL);
+    return buffer;
+  }
+
   GST_AUDIO_DECODER_STREAM_LOCK (dec);
 
   if (G_UNLIKELY (dec->priv->ctx.output_format_changed ||
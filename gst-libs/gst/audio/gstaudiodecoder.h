@@ -291,6 +291,13 @@ GstFlowReturn     gst_audio_decoder_finish_frame (GstAudioDecoder * dec,
 GstBuffer *       gst_audio_decoder_allocate_output_buffer (GstAudioDecoder * dec,
                                                             gsize              size);
 
+guint8 *          gst_audio_decoder_get_output_region (GstAudioDecoder * dec,
+                                                       gsize             size);
+
+GstFlowReturn     gst_audio_decoder_finish_frame_region (GstAudioDecoder * dec,
+                                                         gsize             size,
+                                                         gint              frames);
+
 /* context parameters */
 GstAudioInfo    * gst_audio_decoder_get_audio_info (GstAudioDecoder * dec);
 
@@ -350,6 +357,11 @@ void              gst_audio_decoder_set_needs_format (GstAudioDecoder * dec,
 
 gboolean          gst_audio_decoder_get_needs_format (GstAudioDecoder * dec);
 
+void              gst_audio_decoder_set_independent_frames (GstAudioDecoder * dec,
+                                                            gboolean enabled);
+
+gboolean          gst_audio_decoder_get_independent_frames (GstAudioDecoder * dec);
+
 void              gst_audio_decoder_get_allocator (GstAudioDecoder * dec,
                                                    GstAllocator ** allocator,
                                                    GstAllocationParams * params);
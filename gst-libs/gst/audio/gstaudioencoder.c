@@ -59,6 +59,9 @@
  *     <listitem><para>
  *       Base class gathers input sample data (as directed by the context's
  *       frame_samples and frame_max) and provides this to subclass' @handle_frame.
+ *       Subclasses that encode several frames per call more efficiently can
+ *       request a fixed number of frames with
+ *       gst_audio_encoder_set_frame_batch().
  *     </para></listitem>
  *     <listitem><para>
  *       If codec processing results in encoded data, subclass should call
@@ -196,6 +199,7 @@ typedef struct _GstAudioEncoderContext
   gboolean output_caps_changed;
   gint frame_samples_min, frame_samples_max;
   gint frame_max;
+  gint frame_batch;
   gint lookahead;
   /* MT-protected (with LOCK) */
   GstClockTime min_latency;
@@ -578,6 +582,21 @@ gst_audio_encoder_push_event (GstAudioEncoder * enc, GstEvent * event)
   return gst_pad_push_event (enc->srcpad, event);
 }
 
+/* samples (w.r.t. base_ts) up to which output has been produced, which
+ * lags the input by the lookahead of the encoder. Output produced before
+ * the lookahead was filled starts at base_ts. */
+static guint64
+gst_audio_encoder_out_samples (GstAudioEncoder * enc)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+
+  if (G_UNLIKELY (priv->ctx.lookahead > 0 &&
+          priv->samples < (guint64) priv->ctx.lookahead))
+    return 0;
+
+  return priv->samples - priv->ctx.lookahead;
+}
+
 /**
  * gst_audio_encoder_finish_frame:
  * @enc: a #GstAudioEncoder
@@ -795,14 +814,14 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
        * (particularly if not in perfect mode) */
       /* mind sample rounding and produce perfect output */
       GST_BUFFER_TIMESTAMP (buf) = priv->base_ts +
-          gst_util_uint64_scale (priv->samples - ctx->lookahead, GST_SECOND,
-          ctx->info.rate);
+          gst_util_uint64_scale (gst_audio_encoder_out_samples (enc),
+          GST_SECOND, ctx->info.rate);
       GST_DEBUG_OBJECT (enc, "out samples %d", samples);
       if (G_LIKELY (samples > 0)) {
         priv->samples += samples;
         GST_BUFFER_DURATION (buf) = priv->base_ts +
-            gst_util_uint64_scale (priv->samples - ctx->lookahead, GST_SECOND,
-            ctx->info.rate) - GST_BUFFER_TIMESTAMP (buf);
+            gst_util_uint64_scale (gst_audio_encoder_out_samples (enc),
+            GST_SECOND, ctx->info.rate) - GST_BUFFER_TIMESTAMP (buf);
         priv->last_duration = GST_BUFFER_DURATION (buf);
       } else {
         /* duration forecast in case of handling remainder;
@@ -813,8 +832,8 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
         /* pamper oggmux */
         /* FIXME: in longer run, muxer should take care of this ... */
         /* offset_end = granulepos for ogg muxer */
-        GST_BUFFER_OFFSET_END (buf) = priv->base_gp + priv->samples -
-            enc->priv->ctx.lookahead;
+        GST_BUFFER_OFFSET_END (buf) = priv->base_gp +
+            gst_audio_encoder_out_samples (enc);
         /* offset = timestamp corresponding to granulepos for ogg muxer */
         GST_BUFFER_OFFSET (buf) =
             GST_FRAMES_TO_CLOCK_TIME (GST_BUFFER_OFFSET_END (buf),
@@ -916,6 +935,10 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
     need =
         ctx->frame_samples_min >
         0 ? ctx->frame_samples_min * ctx->info.bpf : av;
+    /* wait for a complete batch of frames, unless draining */
+    if (ctx->frame_batch > 1
+        && ctx->frame_samples_min == ctx->frame_samples_max)
+      need *= ctx->frame_batch;
     GST_LOG_OBJECT (enc, "available: %d, needed: %d, force: %d", av, need,
         force);
 
@@ -938,7 +961,9 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
        * provide for integer multiple of frames to allow for better granularity
        * of processing */
       if (ctx->frame_samples_min > 0 && need) {
-        if (ctx->frame_max > 1)
+        if (ctx->frame_batch > 1)
+          need = need * MIN ((av / need), ctx->frame_batch);
+        else if (ctx->frame_max > 1)
           need = need * MIN ((av / need), ctx->frame_max);
         else if (ctx->frame_max == 0)
           need = need * (av / need);
@@ -1270,6 +1295,7 @@ gst_audio_encoder_sink_setcaps (GstAudioEncoder * enc, GstCaps * caps)
   enc->priv->ctx.frame_samples_min = 0;
   enc->priv->ctx.frame_samples_max = 0;
   enc->priv->ctx.frame_max = 0;
+  enc->priv->ctx.frame_batch = 0;
   enc->priv->ctx.lookahead = 0;
 
   /* element might report latency */
@@ -2119,6 +2145,50 @@ gst_audio_encoder_get_frame_max (GstAudioEncoder * enc)
   return enc->priv->ctx.frame_max;
 }
 
+/**
+ * gst_audio_encoder_set_frame_batch:
+ * @enc: a #GstAudioEncoder
+ * @num: number of frames
+ *
+ * Sets the number of frames handed to @handle_frame at once, so that
+ * subclasses can spread the cost of a call, or process frames together,
+ * over @num frames. Unlike with gst_audio_encoder_set_frame_max(), base
+ * class waits until @num frames are available rather than passing what
+ * happens to be collected, only fewer frames are passed when draining.
+ * Requires @frame_samples_min and @frame_samples_max to be equal, the
+ * batch is ignored otherwise.
+ *
+ * Subclass should call gst_audio_encoder_finish_frame() for each encoded
+ * frame, so that every output buffer is timestamped according to its own
+ * position in the input (taking the lookahead into account).
+ *
+ * Since: 1.2
+ */
+void
+gst_audio_encoder_set_frame_batch (GstAudioEncoder * enc, gint num)
+{
+  g_return_if_fail (GST_IS_AUDIO_ENCODER (enc));
+
+  enc->priv->ctx.frame_batch = num;
+  GST_LOG_OBJECT (enc, "set to %d", num);
+}
+
+/**
+ * gst_audio_encoder_get_frame_batch:
+ * @enc: a #GstAudioEncoder
+ *
+ * Returns: currently configured number of frames handled at once
+ *
+ * Since: 1.2
+ */
+gint
+gst_audio_encoder_get_frame_batch (GstAudioEncoder * enc)
+{
+  g_return_val_if_fail (GST_IS_AUDIO_ENCODER (enc), 0);
+
+  return enc->priv->ctx.frame_batch;
+}
+
 /**
  * gst_audio_encoder_set_lookahead:
  * @enc: a #GstAudioEncoder
@@ -252,6 +252,10 @@ gint            gst_audio_encoder_get_frame_max (GstAudioEncoder * enc);
 
 void            gst_audio_encoder_set_frame_max (GstAudioEncoder * enc, gint num);
 
+gint            gst_audio_encoder_get_frame_batch (GstAudioEncoder * enc);
+
+void            gst_audio_encoder_set_frame_batch (GstAudioEncoder * enc, gint num);
+
 gint            gst_audio_encoder_get_lookahead (GstAudioEncoder * enc);
 
 void            gst_audio_encoder_set_lookahead (GstAudioEncoder * enc, gint num);
@@ -34,15 +34,34 @@
  * abstraction for DMA based ringbuffers as well as a pure software
  * implementations.
  * </para>
+ * <para>
+ * A writer that finds the ringbuffer full, or a reader that finds it empty,
+ * waits on a condition variable that is signalled with the object lock held.
+ * In lock-free mode, see gst_audio_ring_buffer_set_lock_free(), the waiting
+ * side sleeps on a futex instead and the device thread never takes the lock
+ * when it advances the ringbuffer.
+ * </para>
  * </refsect2>
  *
  * Last reviewed on 2006-02-02 (0.10.4)
  */
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
 #include <string.h>
 
+#if defined (HAVE_LINUX_FUTEX_H) && defined (HAVE_SYS_SYSCALL_H)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HAVE_FUTEX 1
+#endif
+
 #include <gst/audio/audio.h>
 #include "gstaudioringbuffer.h"
+#include "gstaudiothreadprivate.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_audio_ring_buffer_debug);
 #define GST_CAT_DEFAULT gst_audio_ring_buffer_debug
@@ -51,6 +70,7 @@ static void gst_audio_ring_buffer_dispose (GObject * object);
 static void gst_audio_ring_buffer_finalize (GObject * object);
 
 static gboolean gst_audio_ring_buffer_pause_unlocked (GstAudioRingBuffer * buf);
+static void wake_lock_free (GstAudioRingBuffer * buf);
 static void default_clear_all (GstAudioRingBuffer * buf);
 static guint default_commit (GstAudioRingBuffer * buf, guint64 * sample,
     guint8 * data, gint in_samples, gint out_samples, gint * accum);
@@ -680,6 +700,7 @@ gst_audio_ring_buffer_release (GstAudioRingBuffer * buf)
   /* signal any waiters */
   GST_DEBUG_OBJECT (buf, "signal waiter");
   GST_AUDIO_RING_BUFFER_SIGNAL (buf);
+  wake_lock_free (buf);
 
   if (G_UNLIKELY (!res))
     goto release_failed;
@@ -844,7 +865,7 @@ gst_audio_ring_buffer_set_flushing (GstAudioRingBuffer * buf, gboolean flushing)
   g_return_if_fail (GST_IS_AUDIO_RING_BUFFER (buf));
 
   GST_OBJECT_LOCK (buf);
-  buf->flushing = flushing;
+  g_atomic_int_set (&buf->flushing, flushing);
 
   if (flushing) {
     gst_audio_ring_buffer_pause_unlocked (buf);
@@ -878,6 +899,58 @@ gst_audio_ring_buffer_is_flushing (GstAudioRingBuffer * buf)
   return res;
 }
 
+/**
+ * gst_audio_ring_buffer_set_lock_free:
+ * @buf: the #GstAudioRingBuffer
+ * @lock_free: the new mode
+ *
+ * Make the writer or reader wait for free or filled segments without
+ * taking the object lock. The device thread then only uses atomic
+ * operations in gst_audio_ring_buffer_prepare_read() and
+ * gst_audio_ring_buffer_advance() and wakes up a waiter directly, which
+ * avoids priority inversion when it runs with a higher priority than the
+ * streaming thread.
+ *
+ * This requires exactly one thread committing or reading samples and one
+ * device thread advancing the ringbuffer. The mode is only available on
+ * systems with futexes, elsewhere the ringbuffer keeps using the lock.
+ *
+ * This function should be called before the ringbuffer is started.
+ *
+ * Since: 1.2
+ */
+void
+gst_audio_ring_buffer_set_lock_free (GstAudioRingBuffer * buf,
+    gboolean lock_free)
+{
+  g_return_if_fail (GST_IS_AUDIO_RING_BUFFER (buf));
+
+#ifdef HAVE_FUTEX
+  GST_DEBUG_OBJECT (buf, "lock-free mode %d", lock_free);
+  g_atomic_int_set (&buf->ABI.abi.lock_free, lock_free);
+#else
+  GST_DEBUG_OBJECT (buf, "lock-free mode not supported");
+#endif
+}
+
+/**
+ * gst_audio_ring_buffer_is_lock_free:
+ * @buf: the #GstAudioRingBuffer
+ *
+ * Check if @buf waits for segments without taking the object lock.
+ *
+ * Returns: TRUE if the ringbuffer is in lock-free mode.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_audio_ring_buffer_is_lock_free (GstAudioRingBuffer * buf)
+{
+  g_return_val_if_fail (GST_IS_AUDIO_RING_BUFFER (buf), FALSE);
+
+  return g_atomic_int_get (&buf->ABI.abi.lock_free);
+}
+
 /**
  * gst_audio_ring_buffer_start:
  * @buf: the #GstAudioRingBuffer to start
@@ -988,6 +1061,7 @@ gst_audio_ring_buffer_pause_unlocked (GstAudioRingBuffer * buf)
   /* signal any waiters */
   GST_DEBUG_OBJECT (buf, "signal waiter");
   GST_AUDIO_RING_BUFFER_SIGNAL (buf);
+  wake_lock_free (buf);
 
   rclass = GST_AUDIO_RING_BUFFER_GET_CLASS (buf);
   if (G_LIKELY (rclass->pause))
@@ -1097,6 +1171,7 @@ gst_audio_ring_buffer_stop (GstAudioRingBuffer * buf)
   /* signal any waiters */
   GST_DEBUG_OBJECT (buf, "signal waiter");
   GST_AUDIO_RING_BUFFER_SIGNAL (buf);
+  wake_lock_free (buf);
 
   rclass = GST_AUDIO_RING_BUFFER_GET_CLASS (buf);
   if (G_LIKELY (rclass->stop))
@@ -1263,8 +1338,100 @@ gst_audio_ring_buffer_clear_all (GstAudioRingBuffer * buf)
 }
 
 
+#ifdef HAVE_FUTEX
+static void
+futex_wait (gint * addr, gint val)
+{
+  syscall (SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+static void
+futex_wake (gint * addr)
+{
+  syscall (SYS_futex, addr, FUTEX_WAKE_PRIVATE, G_MAXINT, NULL, NULL, 0);
+}
+#endif
+
+/* wake up a waiter in lock-free mode, called by the device thread after
+ * advancing and by everything that stops the ringbuffer */
+static void
+wake_lock_free (GstAudioRingBuffer * buf)
+{
+#ifdef HAVE_FUTEX
+  if (!g_atomic_int_get (&buf->ABI.abi.lock_free))
+    return;
+
+  g_atomic_int_inc (&buf->ABI.abi.wakeup_seq);
+  futex_wake (&buf->ABI.abi.wakeup_seq);
+#endif
+}
+
+/* called by the base classes when the subclass posted an error, wakes up
+ * the waiter in both locked and lock-free mode */
+void
+__gst_audio_ring_buffer_set_error (GstAudioRingBuffer * buf)
+{
+  g_atomic_int_set (&buf->state, GST_AUDIO_RING_BUFFER_STATE_ERROR);
+  GST_AUDIO_RING_BUFFER_SIGNAL (buf);
+  wake_lock_free (buf);
+}
+
+/* In lock-free mode the waiter takes a snapshot of the wakeup sequence
+ * number before it checks its conditions for the last time, a wakeup after
+ * that point changes the number and makes the futex wait return at once. */
+static gboolean
+wait_segment_lock_free (GstAudioRingBuffer * buf, gint segdone)
+{
+#ifdef HAVE_FUTEX
+  gint seq;
+
+  seq = g_atomic_int_get (&buf->ABI.abi.wakeup_seq);
+  g_atomic_int_set (&buf->waiting, 1);
+
+  if (G_UNLIKELY (g_atomic_int_get (&buf->flushing)))
+    goto flushing;
+
+  if (G_UNLIKELY (g_atomic_int_get (&buf->state) !=
+          GST_AUDIO_RING_BUFFER_STATE_STARTED))
+    goto not_started;
+
+  /* don't sleep when the device advanced before it could see our flag */
+  if (g_atomic_int_get (&buf->segdone) == segdone) {
+    GST_LOG_OBJECT (buf, "waiting..");
+    futex_wait (&buf->ABI.abi.wakeup_seq, seq);
+  }
+  g_atomic_int_set (&buf->waiting, 0);
+
+  if (G_UNLIKELY (g_atomic_int_get (&buf->flushing)))
+    goto flushing;
+
+  if (G_UNLIKELY (g_atomic_int_get (&buf->state) !=
+          GST_AUDIO_RING_BUFFER_STATE_STARTED))
+    goto not_started;
+
+  return TRUE;
+
+  /* ERROR */
+not_started:
+  {
+    g_atomic_int_set (&buf->waiting, 0);
+    GST_DEBUG_OBJECT (buf, "stopped processing");
+    return FALSE;
+  }
+flushing:
+  {
+    g_atomic_int_set (&buf->waiting, 0);
+    GST_DEBUG_OBJECT (buf, "flushing");
+    return FALSE;
+  }
+#else
+  g_assert_not_reached ();
+  return FALSE;
+#endif
+}
+
 static gboolean
-wait_segment (GstAudioRingBuffer * buf)
+wait_segment (GstAudioRingBuffer * buf, gint segdone)
 {
   gint segments;
   gboolean wait = TRUE;
@@ -1286,6 +1453,12 @@ wait_segment (GstAudioRingBuffer * buf)
       wait = FALSE;
   }
 
+  if (g_atomic_int_get (&buf->ABI.abi.lock_free)) {
+    if (!wait)
+      return TRUE;
+    return wait_segment_lock_free (buf, segdone);
+  }
+
   /* take lock first, then update our waiting flag */
   GST_OBJECT_LOCK (buf);
   if (G_UNLIKELY (buf->flushing))
@@ -1514,6 +1687,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       if (G_UNLIKELY (diff < 0)) {
         /* we need to drop one segment at a time, pretend we wrote a segment. */
         skip = TRUE;
+        g_atomic_int_inc (&buf->ABI.abi.xruns);
         break;
       }
 
@@ -1525,7 +1699,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       }
 
       /* else we need to wait for the segment to become writable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
@@ -1732,6 +1906,7 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
         /* pretend we read an empty segment. */
         sampleslen = MIN (sps, to_read);
         memcpy (data, buf->empty_seg, sampleslen * bpf);
+        g_atomic_int_inc (&buf->ABI.abi.xruns);
         goto next;
       }
 
@@ -1741,7 +1916,7 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
         break;
 
       /* else we need to wait for the segment to become readable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
@@ -1863,6 +2038,13 @@ gst_audio_ring_buffer_advance (GstAudioRingBuffer * buf, guint advance)
   /* update counter */
   g_atomic_int_add (&buf->segdone, advance);
 
+  if (g_atomic_int_get (&buf->ABI.abi.lock_free)) {
+    /* no lock involved, the waiter rechecks segdone after setting the flag */
+    if (g_atomic_int_compare_and_exchange (&buf->waiting, 1, 0))
+      wake_lock_free (buf);
+    return;
+  }
+
   /* the lock is already taken when the waiting flag is set,
    * we grab the lock as well to make sure the waiter is actually
    * waiting for the signal */
@@ -70,6 +70,24 @@ typedef enum {
   GST_AUDIO_RING_BUFFER_STATE_ERROR
 } GstAudioRingBufferState;
 
+/**
+ * GstAudioRingBufferThreadPolicy:
+ * @GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL: default scheduling
+ * @GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO: realtime first-in first-out
+ *     scheduling
+ * @GST_AUDIO_RING_BUFFER_THREAD_POLICY_RR: realtime round-robin scheduling
+ *
+ * The scheduling policy of the thread that transfers the ringbuffer
+ * segments to or from the device.
+ *
+ * Since: 1.2
+ */
+typedef enum {
+  GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL,
+  GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO,
+  GST_AUDIO_RING_BUFFER_THREAD_POLICY_RR
+} GstAudioRingBufferThreadPolicy;
+
 /**
  * GstAudioRingBufferFormatType:
  * @GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW: samples in linear or float
@@ -205,7 +223,16 @@ struct _GstAudioRingBuffer {
   gboolean                    active;
 
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING];
+  union {
+    struct {
+      /* ATOMIC */
+      gint                    lock_free;
+      gint                    wakeup_seq;
+      /* segments the writer or reader was too late for */
+      gint                    xruns;
+    } abi;
+    gpointer _gst_reserved[GST_PADDING];
+  } ABI;
 };
 
 /**
@@ -294,6 +321,10 @@ gboolean        gst_audio_ring_buffer_is_active       (GstAudioRingBuffer *buf);
 void            gst_audio_ring_buffer_set_flushing    (GstAudioRingBuffer *buf, gboolean flushing);
 gboolean        gst_audio_ring_buffer_is_flushing     (GstAudioRingBuffer *buf);
 
+/* lock-free segment waiting */
+void            gst_audio_ring_buffer_set_lock_free   (GstAudioRingBuffer *buf, gboolean lock_free);
+gboolean        gst_audio_ring_buffer_is_lock_free    (GstAudioRingBuffer *buf);
+
 /* playback/pause */
 gboolean        gst_audio_ring_buffer_start           (GstAudioRingBuffer *buf);
 gboolean        gst_audio_ring_buffer_pause           (GstAudioRingBuffer *buf);
@@ -71,6 +71,7 @@
 
 #include <gst/audio/audio.h>
 #include "gstaudiosink.h"
+#include "gstaudiothreadprivate.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_audio_sink_debug);
 #define GST_CAT_DEFAULT gst_audio_sink_debug
@@ -104,6 +105,7 @@ struct _GstAudioSinkRingBuffer
 
   gboolean running;
   gint queuedseg;
+  gboolean memory_locked;
 
   GCond cond;
 };
@@ -113,6 +115,20 @@ struct _GstAudioSinkRingBufferClass
   GstAudioRingBufferClass parent_class;
 };
 
+#define GST_AUDIO_SINK_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_SINK, GstAudioSinkPrivate))
+
+struct _GstAudioSinkPrivate
+{
+  /* with LOCK, applied when the device thread starts */
+  GstAudioRingBufferThreadPolicy thread_policy;
+  gint thread_priority;
+  guint64 thread_affinity;
+  /* atomic, read with the ringbuffer lock where the element lock can't be
+   * taken */
+  gint lock_memory;
+};
+
 static void gst_audio_sink_ring_buffer_class_init (GstAudioSinkRingBufferClass *
     klass);
 static void gst_audio_sink_ring_buffer_init (GstAudioSinkRingBuffer *
@@ -222,6 +238,12 @@ audioringbuffer_thread_func (GstAudioRingBuffer * buf)
 
   GST_DEBUG_OBJECT (sink, "enter thread");
 
+  GST_OBJECT_LOCK (sink);
+  __gst_audio_thread_set_scheduling (GST_OBJECT_CAST (sink),
+      sink->priv->thread_policy, sink->priv->thread_priority,
+      sink->priv->thread_affinity);
+  GST_OBJECT_UNLOCK (sink);
+
   GST_OBJECT_LOCK (abuf);
   GST_DEBUG_OBJECT (sink, "signal wait");
   GST_AUDIO_SINK_RING_BUFFER_SIGNAL (buf);
@@ -326,6 +348,10 @@ gst_audio_sink_ring_buffer_init (GstAudioSinkRingBuffer * ringbuffer,
   ringbuffer->queuedseg = 0;
 
   g_cond_init (&ringbuffer->cond);
+
+  /* our thread is the only one advancing the ringbuffer */
+  gst_audio_ring_buffer_set_lock_free (GST_AUDIO_RING_BUFFER_CAST (ringbuffer),
+      TRUE);
 }
 
 static void
@@ -400,6 +426,7 @@ gst_audio_sink_ring_buffer_acquire (GstAudioRingBuffer * buf,
 {
   GstAudioSink *sink;
   GstAudioSinkClass *csink;
+  GstAudioSinkRingBuffer *abuf;
   gboolean result = FALSE;
 
   sink = GST_AUDIO_SINK (GST_OBJECT_PARENT (buf));
@@ -416,6 +443,12 @@ gst_audio_sink_ring_buffer_acquire (GstAudioRingBuffer * buf,
   buf->size = spec->segtotal * spec->segsize;
   buf->memory = g_malloc0 (buf->size);
 
+  abuf = GST_AUDIO_SINK_RING_BUFFER_CAST (buf);
+  /* called with the ringbuffer lock, don't take the element lock here */
+  abuf->memory_locked = g_atomic_int_get (&sink->priv->lock_memory);
+  if (abuf->memory_locked)
+    __gst_audio_ring_buffer_lock_memory (buf, TRUE);
+
   return TRUE;
 
   /* ERRORS */
@@ -482,12 +515,18 @@ gst_audio_sink_ring_buffer_release (GstAudioRingBuffer * buf)
 {
   GstAudioSink *sink;
   GstAudioSinkClass *csink;
+  GstAudioSinkRingBuffer *abuf;
   gboolean result = FALSE;
 
   sink = GST_AUDIO_SINK (GST_OBJECT_PARENT (buf));
   csink = GST_AUDIO_SINK_GET_CLASS (sink);
 
   /* free the buffer */
+  abuf = GST_AUDIO_SINK_RING_BUFFER_CAST (buf);
+  if (abuf->memory_locked) {
+    __gst_audio_ring_buffer_lock_memory (buf, FALSE);
+    abuf->memory_locked = FALSE;
+  }
   g_free (buf->memory);
   buf->memory = NULL;
 
@@ -591,7 +630,12 @@ enum
 
 enum
 {
-  ARG_0,
+  PROP_0,
+  PROP_THREAD_POLICY,
+  PROP_THREAD_PRIORITY,
+  PROP_THREAD_AFFINITY,
+  PROP_LOCK_MEMORY,
+  PROP_UNDERRUNS
 };
 
 #define _do_init \
@@ -602,14 +646,92 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioSink, gst_audio_sink,
 
 static GstAudioRingBuffer *gst_audio_sink_create_ringbuffer (GstAudioBaseSink *
     sink);
+static void gst_audio_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_audio_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static void
 gst_audio_sink_class_init (GstAudioSinkClass * klass)
 {
+  GObjectClass *gobject_class;
   GstAudioBaseSinkClass *gstaudiobasesink_class;
 
+  gobject_class = (GObjectClass *) klass;
   gstaudiobasesink_class = (GstAudioBaseSinkClass *) klass;
 
+  g_type_class_add_private (klass, sizeof (GstAudioSinkPrivate));
+
+  gobject_class->set_property = gst_audio_sink_set_property;
+  gobject_class->get_property = gst_audio_sink_get_property;
+
+  /**
+   * GstAudioSink:thread-policy:
+   *
+   * Scheduling policy of the thread that transfers the samples to the
+   * device. When the realtime policies are not permitted the thread keeps
+   * the normal scheduling.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_POLICY,
+      g_param_spec_enum ("thread-policy", "Thread policy",
+          "Scheduling policy of the device thread",
+          GST_TYPE_AUDIO_RING_BUFFER_THREAD_POLICY, DEFAULT_THREAD_POLICY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSink:thread-priority:
+   *
+   * Priority of the device thread with the realtime scheduling policies.
+   * It is clamped to the range the system supports.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_PRIORITY,
+      g_param_spec_int ("thread-priority", "Thread priority",
+          "Realtime priority of the device thread", 1, 99,
+          DEFAULT_THREAD_PRIORITY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSink:thread-affinity:
+   *
+   * Bitmask of the CPUs the device thread may run on, 0 lets it run on
+   * all of them.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_AFFINITY,
+      g_param_spec_uint64 ("thread-affinity", "Thread affinity",
+          "Bitmask of the CPUs the device thread may run on (0 = any)", 0,
+          G_MAXUINT64, DEFAULT_THREAD_AFFINITY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSink:lock-memory:
+   *
+   * Lock the ringbuffer memory so that it can't be paged out.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_LOCK_MEMORY,
+      g_param_spec_boolean ("lock-memory", "Lock memory",
+          "Lock the ringbuffer memory in RAM", DEFAULT_LOCK_MEMORY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSink:underruns:
+   *
+   * Number of segments the device played before they were written, since
+   * the device was opened.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_UNDERRUNS,
+      g_param_spec_uint ("underruns", "Underruns",
+          "Number of segments played before they were written", 0,
+          G_MAXUINT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstaudiobasesink_class->create_ringbuffer =
       GST_DEBUG_FUNCPTR (gst_audio_sink_create_ringbuffer);
 
@@ -619,6 +741,85 @@ gst_audio_sink_class_init (GstAudioSinkClass * klass)
 static void
 gst_audio_sink_init (GstAudioSink * audiosink)
 {
+  audiosink->priv = GST_AUDIO_SINK_GET_PRIVATE (audiosink);
+
+  audiosink->priv->thread_policy = DEFAULT_THREAD_POLICY;
+  audiosink->priv->thread_priority = DEFAULT_THREAD_PRIORITY;
+  audiosink->priv->thread_affinity = DEFAULT_THREAD_AFFINITY;
+  audiosink->priv->lock_memory = DEFAULT_LOCK_MEMORY;
+}
+
+static void
+gst_audio_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstAudioSink *sink = GST_AUDIO_SINK (object);
+
+  switch (prop_id) {
+    case PROP_THREAD_POLICY:
+      GST_OBJECT_LOCK (sink);
+      sink->priv->thread_policy = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_THREAD_PRIORITY:
+      GST_OBJECT_LOCK (sink);
+      sink->priv->thread_priority = g_value_get_int (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_THREAD_AFFINITY:
+      GST_OBJECT_LOCK (sink);
+      sink->priv->thread_affinity = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_LOCK_MEMORY:
+      g_atomic_int_set (&sink->priv->lock_memory,
+          g_value_get_boolean (value));
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_audio_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstAudioSink *sink = GST_AUDIO_SINK (object);
+
+  switch (prop_id) {
+    case PROP_THREAD_POLICY:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_enum (value, sink->priv->thread_policy);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_THREAD_PRIORITY:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_int (value, sink->priv->thread_priority);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_THREAD_AFFINITY:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_uint64 (value, sink->priv->thread_affinity);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_LOCK_MEMORY:
+      g_value_set_boolean (value, g_atomic_int_get (&sink->priv->lock_memory));
+      break;
+    case PROP_UNDERRUNS:{
+      GstAudioRingBuffer *ringbuffer;
+
+      GST_OBJECT_LOCK (sink);
+      ringbuffer = GST_AUDIO_BASE_SINK (sink)->ringbuffer;
+      g_value_set_uint (value,
+          ringbuffer ? g_atomic_int_get (&ringbuffer->ABI.abi.xruns) : 0);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    }
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
 }
 
 static GstAudioRingBuffer *
@@ -37,6 +37,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstAudioSink GstAudioSink;
 typedef struct _GstAudioSinkClass GstAudioSinkClass;
+typedef struct _GstAudioSinkPrivate GstAudioSinkPrivate;
 
 /**
  * GstAudioSink:
@@ -50,7 +51,9 @@ struct _GstAudioSink {
   GThread   *thread;
 
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING];
+  GstAudioSinkPrivate *priv;
+
+  gpointer _gst_reserved[GST_PADDING - 1];
 };
 
 /**
@@ -71,6 +71,7 @@
 
 #include <gst/audio/audio.h>
 #include "gstaudiosrc.h"
+#include "gstaudiothreadprivate.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_audio_src_debug);
 #define GST_CAT_DEFAULT gst_audio_src_debug
@@ -102,6 +103,7 @@ struct _GstAudioSrcRingBuffer
 
   gboolean running;
   gint queuedseg;
+  gboolean memory_locked;
 
   GCond cond;
 };
@@ -111,6 +113,20 @@ struct _GstAudioSrcRingBufferClass
   GstAudioRingBufferClass parent_class;
 };
 
+#define GST_AUDIO_SRC_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_SRC, GstAudioSrcPrivate))
+
+struct _GstAudioSrcPrivate
+{
+  /* with LOCK, applied when the device thread starts */
+  GstAudioRingBufferThreadPolicy thread_policy;
+  gint thread_priority;
+  guint64 thread_affinity;
+  /* atomic, read with the ringbuffer lock where the element lock can't be
+   * taken */
+  gint lock_memory;
+};
+
 static void gst_audio_src_ring_buffer_class_init (GstAudioSrcRingBufferClass *
     klass);
 static void gst_audio_src_ring_buffer_init (GstAudioSrcRingBuffer * ringbuffer,
@@ -214,6 +230,12 @@ audioringbuffer_thread_func (GstAudioRingBuffer * buf)
 
   GST_DEBUG_OBJECT (src, "enter thread");
 
+  GST_OBJECT_LOCK (src);
+  __gst_audio_thread_set_scheduling (GST_OBJECT_CAST (src),
+      src->priv->thread_policy, src->priv->thread_priority,
+      src->priv->thread_affinity);
+  GST_OBJECT_UNLOCK (src);
+
   if ((readfunc = csrc->read) == NULL)
     goto no_function;
 
@@ -310,6 +332,10 @@ gst_audio_src_ring_buffer_init (GstAudioSrcRingBuffer * ringbuffer,
   ringbuffer->queuedseg = 0;
 
   g_cond_init (&ringbuffer->cond);
+
+  /* our thread is the only one advancing the ringbuffer */
+  gst_audio_ring_buffer_set_lock_free (GST_AUDIO_RING_BUFFER_CAST (ringbuffer),
+      TRUE);
 }
 
 static void
@@ -398,6 +424,12 @@ gst_audio_src_ring_buffer_acquire (GstAudioRingBuffer * buf,
   buf->memory = g_malloc0 (buf->size);
 
   abuf = GST_AUDIO_SRC_RING_BUFFER (buf);
+
+  /* called with the ringbuffer lock, don't take the element lock here */
+  abuf->memory_locked = g_atomic_int_get (&src->priv->lock_memory);
+  if (abuf->memory_locked)
+    __gst_audio_ring_buffer_lock_memory (buf, TRUE);
+
   abuf->running = TRUE;
 
   /* FIXME: handle thread creation failure */
@@ -437,6 +469,10 @@ gst_audio_src_ring_buffer_release (GstAudioRingBuffer * buf)
   GST_OBJECT_LOCK (buf);
 
   /* free the buffer */
+  if (abuf->memory_locked) {
+    __gst_audio_ring_buffer_lock_memory (buf, FALSE);
+    abuf->memory_locked = FALSE;
+  }
   g_free (buf->memory);
   buf->memory = NULL;
 
@@ -504,7 +540,12 @@ enum
 
 enum
 {
-  ARG_0,
+  PROP_0,
+  PROP_THREAD_POLICY,
+  PROP_THREAD_PRIORITY,
+  PROP_THREAD_AFFINITY,
+  PROP_LOCK_MEMORY,
+  PROP_OVERRUNS
 };
 
 #define _do_init \
@@ -515,14 +556,92 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioSrc, gst_audio_src,
 
 static GstAudioRingBuffer *gst_audio_src_create_ringbuffer (GstAudioBaseSrc *
     src);
+static void gst_audio_src_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_audio_src_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static void
 gst_audio_src_class_init (GstAudioSrcClass * klass)
 {
+  GObjectClass *gobject_class;
   GstAudioBaseSrcClass *gstaudiobasesrc_class;
 
+  gobject_class = (GObjectClass *) klass;
   gstaudiobasesrc_class = (GstAudioBaseSrcClass *) klass;
 
+  g_type_class_add_private (klass, sizeof (GstAudioSrcPrivate));
+
+  gobject_class->set_property = gst_audio_src_set_property;
+  gobject_class->get_property = gst_audio_src_get_property;
+
+  /**
+   * GstAudioSrc:thread-policy:
+   *
+   * Scheduling policy of the thread that transfers the samples from the
+   * device. When the realtime policies are not permitted the thread keeps
+   * the normal scheduling.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_POLICY,
+      g_param_spec_enum ("thread-policy", "Thread policy",
+          "Scheduling policy of the device thread",
+          GST_TYPE_AUDIO_RING_BUFFER_THREAD_POLICY, DEFAULT_THREAD_POLICY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSrc:thread-priority:
+   *
+   * Priority of the device thread with the realtime scheduling policies.
+   * It is clamped to the range the system supports.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_PRIORITY,
+      g_param_spec_int ("thread-priority", "Thread priority",
+          "Realtime priority of the device thread", 1, 99,
+          DEFAULT_THREAD_PRIORITY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSrc:thread-affinity:
+   *
+   * Bitmask of the CPUs the device thread may run on, 0 lets it run on
+   * all of them.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_THREAD_AFFINITY,
+      g_param_spec_uint64 ("thread-affinity", "Thread affinity",
+          "Bitmask of the CPUs the device thread may run on (0 = any)", 0,
+          G_MAXUINT64, DEFAULT_THREAD_AFFINITY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSrc:lock-memory:
+   *
+   * Lock the ringbuffer memory so that it can't be paged out.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_LOCK_MEMORY,
+      g_param_spec_boolean ("lock-memory", "Lock memory",
+          "Lock the ringbuffer memory in RAM", DEFAULT_LOCK_MEMORY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioSrc:overruns:
+   *
+   * Number of segments the device overwrote before they were read, since
+   * the device was opened.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_OVERRUNS,
+      g_param_spec_uint ("overruns", "Overruns",
+          "Number of segments overwritten before they were read", 0,
+          G_MAXUINT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstaudiobasesrc_class->create_ringbuffer =
       GST_DEBUG_FUNCPTR (gst_audio_src_create_ringbuffer);
 
@@ -532,6 +651,85 @@ gst_audio_src_class_init (GstAudioSrcClass * klass)
 static void
 gst_audio_src_init (GstAudioSrc * audiosrc)
 {
+  audiosrc->priv = GST_AUDIO_SRC_GET_PRIVATE (audiosrc);
+
+  audiosrc->priv->thread_policy = DEFAULT_THREAD_POLICY;
+  audiosrc->priv->thread_priority = DEFAULT_THREAD_PRIORITY;
+  audiosrc->priv->thread_affinity = DEFAULT_THREAD_AFFINITY;
+  audiosrc->priv->lock_memory = DEFAULT_LOCK_MEMORY;
+}
+
+static void
+gst_audio_src_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstAudioSrc *src = GST_AUDIO_SRC (object);
+
+  switch (prop_id) {
+    case PROP_THREAD_POLICY:
+      GST_OBJECT_LOCK (src);
+      src->priv->thread_policy = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_THREAD_PRIORITY:
+      GST_OBJECT_LOCK (src);
+      src->priv->thread_priority = g_value_get_int (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_THREAD_AFFINITY:
+      GST_OBJECT_LOCK (src);
+      src->priv->thread_affinity = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_LOCK_MEMORY:
+      g_atomic_int_set (&src->priv->lock_memory,
+          g_value_get_boolean (value));
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_audio_src_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstAudioSrc *src = GST_AUDIO_SRC (object);
+
+  switch (prop_id) {
+    case PROP_THREAD_POLICY:
+      GST_OBJECT_LOCK (src);
+      g_value_set_enum (value, src->priv->thread_policy);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_THREAD_PRIORITY:
+      GST_OBJECT_LOCK (src);
+      g_value_set_int (value, src->priv->thread_priority);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_THREAD_AFFINITY:
+      GST_OBJECT_LOCK (src);
+      g_value_set_uint64 (value, src->priv->thread_affinity);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_LOCK_MEMORY:
+      g_value_set_boolean (value, g_atomic_int_get (&src->priv->lock_memory));
+      break;
+    case PROP_OVERRUNS:{
+      GstAudioRingBuffer *ringbuffer;
+
+      GST_OBJECT_LOCK (src);
+      ringbuffer = GST_AUDIO_BASE_SRC (src)->ringbuffer;
+      g_value_set_uint (value,
+          ringbuffer ? g_atomic_int_get (&ringbuffer->ABI.abi.xruns) : 0);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    }
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
 }
 
 static GstAudioRingBuffer *
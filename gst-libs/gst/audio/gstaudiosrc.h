@@ -37,6 +37,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstAudioSrc GstAudioSrc;
 typedef struct _GstAudioSrcClass GstAudioSrcClass;
+typedef struct _GstAudioSrcPrivate GstAudioSrcPrivate;
 
 /**
  * GstAudioSrc:
@@ -50,7 +51,9 @@ struct _GstAudioSrc {
   GThread   *thread;
 
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING];
+  GstAudioSrcPrivate *priv;
+
+  gpointer _gst_reserved[GST_PADDING - 1];
 };
 
 /**
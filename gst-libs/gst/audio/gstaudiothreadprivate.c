@@ -0,0 +1,146 @@
+/* GStreamer
+ *
+ * gstaudiothreadprivate.c: scheduling of the audio device threads
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* for the CPU_SET macros and pthread_setaffinity_np() */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include <errno.h>
+
+#include "gstaudiothreadprivate.h"
+
+GST_DEBUG_CATEGORY_STATIC (audio_thread_debug);
+#define GST_CAT_DEFAULT audio_thread_debug
+
+static void
+init_debug (void)
+{
+  static gsize initialized = 0;
+
+  if (g_once_init_enter (&initialized)) {
+    GST_DEBUG_CATEGORY_INIT (audio_thread_debug, "audiothread", 0,
+        "audio device thread scheduling");
+    g_once_init_leave (&initialized, 1);
+  }
+}
+
+/* Called from the device thread itself before it starts processing. Failing
+ * to get the requested scheduling is not fatal, usually the process lacks
+ * the permissions, and the thread then keeps running with the defaults. */
+void
+__gst_audio_thread_set_scheduling (GstObject * obj,
+    GstAudioRingBufferThreadPolicy policy, gint priority, guint64 affinity)
+{
+  init_debug ();
+
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_SCHED_H)
+  if (policy != GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL) {
+    struct sched_param param = { 0, };
+    gint sched_policy, res;
+
+    if (policy == GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO)
+      sched_policy = SCHED_FIFO;
+    else
+      sched_policy = SCHED_RR;
+
+    param.sched_priority = CLAMP (priority,
+        sched_get_priority_min (sched_policy),
+        sched_get_priority_max (sched_policy));
+
+    res = pthread_setschedparam (pthread_self (), sched_policy, &param);
+    if (res != 0) {
+      GST_WARNING_OBJECT (obj, "could not set realtime scheduling with "
+          "priority %d: %s, using normal scheduling", param.sched_priority,
+          g_strerror (res));
+    } else {
+      GST_INFO_OBJECT (obj, "realtime scheduling with priority %d",
+          param.sched_priority);
+    }
+  }
+#ifdef HAVE_PTHREAD_SETAFFINITY_NP
+  if (affinity != 0) {
+    cpu_set_t set;
+    gint i, res;
+
+    CPU_ZERO (&set);
+    for (i = 0; i < 64; i++) {
+      if (affinity & (G_GUINT64_CONSTANT (1) << i))
+        CPU_SET (i, &set);
+    }
+
+    res = pthread_setaffinity_np (pthread_self (), sizeof (set), &set);
+    if (res != 0) {
+      GST_WARNING_OBJECT (obj, "could not set CPU affinity 0x%"
+          G_GINT64_MODIFIER "x: %s", affinity, g_strerror (res));
+    } else {
+      GST_INFO_OBJECT (obj, "CPU affinity 0x%" G_GINT64_MODIFIER "x",
+          affinity);
+    }
+  }
+#else
+  if (affinity != 0)
+    GST_WARNING_OBJECT (obj, "CPU affinity is not supported");
+#endif
+#else
+  if (policy != GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL || affinity != 0)
+    GST_WARNING_OBJECT (obj, "thread scheduling is not supported");
+#endif
+}
+
+/* keeps the ringbuffer memory from being paged out, must be unlocked before
+ * it is freed */
+void
+__gst_audio_ring_buffer_lock_memory (GstAudioRingBuffer * buf, gboolean lock)
+{
+  init_debug ();
+
+  if (buf->memory == NULL)
+    return;
+
+#ifdef HAVE_SYS_MMAN_H
+  if (lock) {
+    if (mlock (buf->memory, buf->size) != 0) {
+      GST_WARNING_OBJECT (buf, "could not lock %" G_GSIZE_FORMAT " bytes: %s",
+          buf->size, g_strerror (errno));
+    } else {
+      GST_DEBUG_OBJECT (buf, "locked %" G_GSIZE_FORMAT " bytes", buf->size);
+    }
+  } else {
+    munlock (buf->memory, buf->size);
+  }
+#else
+  if (lock)
+    GST_WARNING_OBJECT (buf, "memory locking is not supported");
+#endif
+}
@@ -0,0 +1,45 @@
+/* GStreamer
+ *
+ * gstaudiothreadprivate.h: scheduling of the audio device threads
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_AUDIO_THREAD_PRIVATE_H__
+#define __GST_AUDIO_THREAD_PRIVATE_H__
+
+#include <gst/gst.h>
+#include <gst/audio/gstaudioringbuffer.h>
+
+G_BEGIN_DECLS
+
+#define DEFAULT_THREAD_POLICY    GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL
+#define DEFAULT_THREAD_PRIORITY  50
+#define DEFAULT_THREAD_AFFINITY  0
+#define DEFAULT_LOCK_MEMORY      FALSE
+
+void     __gst_audio_thread_set_scheduling (GstObject * obj,
+                                            GstAudioRingBufferThreadPolicy policy,
+                                            gint priority, guint64 affinity);
+
+void     __gst_audio_ring_buffer_lock_memory (GstAudioRingBuffer * buf,
+                                              gboolean lock);
+
+void     __gst_audio_ring_buffer_set_error (GstAudioRingBuffer * buf);
+
+G_END_DECLS
+
+#endif /* __GST_AUDIO_THREAD_PRIVATE_H__ */
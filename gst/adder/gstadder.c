@@ -46,7 +46,7 @@
 
 #include "gstadder.h"
 #include <gst/audio/audio.h>
-#include <string.h>             /* strcmp */
+#include <string.h>             /* strcmp, memcpy, memcmp */
 #include "gstadderorc.h"
 
 #define GST_CAT_DEFAULT gst_adder_debug
@@ -72,7 +72,9 @@ enum
 {
   PROP_PAD_0,
   PROP_PAD_VOLUME,
-  PROP_PAD_MUTE
+  PROP_PAD_MUTE,
+  PROP_PAD_MISSED_DEADLINES,
+  PROP_PAD_LATE_BUFFERS
 };
 
 G_DEFINE_TYPE (GstAdderPad, gst_adder_pad, GST_TYPE_PAD);
@@ -90,6 +92,16 @@ gst_adder_pad_get_property (GObject * object, guint prop_id,
     case PROP_PAD_MUTE:
       g_value_set_boolean (value, pad->mute);
       break;
+    case PROP_PAD_MISSED_DEADLINES:
+      GST_OBJECT_LOCK (pad);
+      g_value_set_uint64 (value, pad->missed);
+      GST_OBJECT_UNLOCK (pad);
+      break;
+    case PROP_PAD_LATE_BUFFERS:
+      GST_OBJECT_LOCK (pad);
+      g_value_set_uint64 (value, pad->late);
+      GST_OBJECT_UNLOCK (pad);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -138,6 +150,15 @@ gst_adder_pad_class_init (GstAdderPadClass * klass)
       g_param_spec_boolean ("mute", "Mute", "Mute this pad",
           DEFAULT_PAD_MUTE,
           G_PARAM_READWRITE | GST_PARAM_CONTROLLABLE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_PAD_MISSED_DEADLINES,
+      g_param_spec_uint64 ("missed-deadlines", "Missed deadlines",
+          "Number of times this pad had no data when the latency expired",
+          0, G_MAXUINT64, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_PAD_LATE_BUFFERS,
+      g_param_spec_uint64 ("late-buffers", "Late buffers",
+          "Number of buffers that were (partially) dropped because they "
+          "arrived after their samples were mixed", 0, G_MAXUINT64, 0,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -147,10 +168,17 @@ gst_adder_pad_init (GstAdderPad * pad)
   pad->mute = DEFAULT_PAD_MUTE;
 }
 
+#define DEFAULT_FLOAT_ACCUMULATOR FALSE
+#define DEFAULT_LATENCY 0
+
 enum
 {
   PROP_0,
-  PROP_FILTER_CAPS
+  PROP_FILTER_CAPS,
+  PROP_FLOAT_ACCUMULATOR,
+  PROP_SKIPPED_BUFFERS,
+  PROP_PASSTHROUGH_BUFFERS,
+  PROP_LATENCY
 };
 
 /* elementfactory information */
@@ -212,6 +240,8 @@ static GstStateChangeReturn gst_adder_change_state (GstElement * element,
 static GstFlowReturn gst_adder_do_clip (GstCollectPads * pads,
     GstCollectData * data, GstBuffer * buffer, GstBuffer ** out,
     gpointer user_data);
+static GstBuffer *gst_adder_clip_planar (GstAdder * adder, GstBuffer * buffer,
+    GstSegment * segment);
 static GstFlowReturn gst_adder_collected (GstCollectPads * pads,
     gpointer user_data);
 
@@ -528,6 +558,16 @@ gst_adder_query_latency (GstAdder * adder, GstQuery * query)
   gst_iterator_free (it);
 
   if (res) {
+    GstClockTime latency;
+
+    /* we wait this much longer for late inputs */
+    GST_OBJECT_LOCK (adder);
+    latency = adder->latency;
+    GST_OBJECT_UNLOCK (adder);
+    min += latency;
+    if (max != GST_CLOCK_TIME_NONE)
+      max += latency;
+
     /* store the results */
     GST_DEBUG_OBJECT (adder, "Calculated total latency: live %s, min %"
         GST_TIME_FORMAT ", max %" GST_TIME_FORMAT,
@@ -811,6 +851,213 @@ done:
   return result;
 }
 
+/* Live timeout mode: when the latency property is set, a clock callback
+ * is scheduled for the end of the first data that is waiting to be mixed
+ * plus the latency. If not all pads have data by then, the callback sets the
+ * empty pads to non-waiting so that collectpads calls gst_adder_collected()
+ * with the data that is there. Collecting restores the waiting state.
+ *
+ * The callback runs on the clock thread, which is shared with the callbacks
+ * of other elements, so it never blocks on the collectpads stream lock. When
+ * that is taken, it tries again after TIMEOUT_RETRY unless the data was
+ * collected in the meantime. */
+#define TIMEOUT_RETRY (GST_MSECOND)
+
+static void
+gst_adder_cancel_timeout (GstAdder * adder)
+{
+  GstClockID id;
+
+  GST_OBJECT_LOCK (adder);
+  id = adder->timeout_id;
+  adder->timeout_id = NULL;
+  GST_OBJECT_UNLOCK (adder);
+
+  if (id) {
+    gst_clock_id_unschedule (id);
+    gst_clock_id_unref (id);
+  }
+}
+
+static gboolean
+gst_adder_timeout (GstClock * clock, GstClockTime time, GstClockID id,
+    gpointer user_data)
+{
+  GstAdder *adder = GST_ADDER (user_data);
+  GRecMutex *stream_lock = GST_COLLECT_PADS_GET_STREAM_LOCK (adder->collect);
+  GSList *collected;
+  gboolean current;
+
+  if (!g_rec_mutex_trylock (stream_lock)) {
+    GST_OBJECT_LOCK (adder);
+    if (adder->timeout_id == id) {
+      GST_LOG_OBJECT (adder, "streaming thread busy, retrying the deadline");
+      gst_clock_id_unref (adder->timeout_id);
+      adder->timeout_id = gst_clock_new_single_shot_id (clock,
+          gst_clock_get_time (clock) + TIMEOUT_RETRY);
+      gst_clock_id_wait_async (adder->timeout_id, gst_adder_timeout,
+          gst_object_ref (adder), (GDestroyNotify) gst_object_unref);
+    }
+    GST_OBJECT_UNLOCK (adder);
+    return TRUE;
+  }
+
+  GST_OBJECT_LOCK (adder);
+  /* the data might have been collected before we got the lock */
+  current = (adder->timeout_id == id);
+  if (current) {
+    gst_clock_id_unref (adder->timeout_id);
+    adder->timeout_id = NULL;
+  }
+  GST_OBJECT_UNLOCK (adder);
+
+  if (current) {
+    for (collected = adder->collect->data; collected;
+        collected = g_slist_next (collected)) {
+      GstCollectData *data = (GstCollectData *) collected->data;
+      GstAdderPad *pad = GST_ADDER_PAD (data->pad);
+
+      if (data->buffer != NULL
+          || GST_COLLECT_PADS_STATE_IS_SET (data, GST_COLLECT_PADS_STATE_EOS))
+        continue;
+
+      GST_DEBUG_OBJECT (pad, "no data at deadline %" GST_TIME_FORMAT
+          ", mixing without it", GST_TIME_ARGS (time));
+      GST_OBJECT_LOCK (pad);
+      pad->missed++;
+      GST_OBJECT_UNLOCK (pad);
+      gst_collect_pads_set_waiting (adder->collect, data, FALSE);
+    }
+  }
+  GST_COLLECT_PADS_STREAM_UNLOCK (adder->collect);
+
+  return TRUE;
+}
+
+/* schedules the timeout for data that ends at @running_time, unless one is
+ * already pending. Must be called with the collectpads stream lock. */
+static void
+gst_adder_schedule_timeout (GstAdder * adder, GstClockTime running_time)
+{
+  GstClock *clock;
+
+  if (!GST_CLOCK_TIME_IS_VALID (running_time))
+    return;
+
+  GST_OBJECT_LOCK (adder);
+  clock = GST_ELEMENT_CLOCK (adder);
+  if (adder->latency == 0 || adder->timeout_id != NULL || clock == NULL
+      || GST_STATE (adder) != GST_STATE_PLAYING) {
+    GST_OBJECT_UNLOCK (adder);
+    return;
+  }
+
+  adder->timeout_id = gst_clock_new_single_shot_id (clock,
+      GST_ELEMENT_CAST (adder)->base_time + running_time + adder->latency);
+  GST_LOG_OBJECT (adder, "waiting for other pads until %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (running_time + adder->latency));
+  gst_clock_id_wait_async (adder->timeout_id, gst_adder_timeout,
+      gst_object_ref (adder), (GDestroyNotify) gst_object_unref);
+  GST_OBJECT_UNLOCK (adder);
+}
+
+/* running time of the end of @buffer, or GST_CLOCK_TIME_NONE */
+static GstClockTime
+gst_adder_running_time_end (GstAdder * adder, GstCollectData * data,
+    GstBuffer * buffer)
+{
+  GstClockTime end;
+  gint rate, bpf;
+
+  if (data->segment.format != GST_FORMAT_TIME || data->segment.rate < 0.0
+      || !GST_BUFFER_TIMESTAMP_IS_VALID (buffer))
+    return GST_CLOCK_TIME_NONE;
+
+  rate = GST_AUDIO_INFO_RATE (&adder->info);
+  bpf = GST_AUDIO_INFO_BPF (&adder->info);
+  end = GST_BUFFER_TIMESTAMP (buffer) +
+      gst_util_uint64_scale_int (gst_buffer_get_size (buffer) / bpf,
+      GST_SECOND, rate);
+
+  return gst_segment_to_running_time (&data->segment, GST_FORMAT_TIME, end);
+}
+
+/* Drops the samples of @buffer that were already mixed without this pad
+ * because they missed the deadline. */
+static GstBuffer *
+gst_adder_drop_late (GstAdder * adder, GstCollectData * data,
+    GstBuffer * buffer)
+{
+  GstAdderPad *pad = GST_ADDER_PAD (data->pad);
+  GstClockTime mixed;
+  GstSegment segment;
+  gsize size;
+  gint rate, bpf;
+
+  GST_OBJECT_LOCK (adder);
+  mixed = adder->mixed_running_time;
+  GST_OBJECT_UNLOCK (adder);
+
+  if (!GST_CLOCK_TIME_IS_VALID (mixed)
+      || data->segment.format != GST_FORMAT_TIME || data->segment.rate < 0.0
+      || mixed <= data->segment.base)
+    return buffer;
+
+  /* clip against the segment from the first sample that was not mixed */
+  segment = data->segment;
+  segment.start += (mixed - segment.base) * ABS (segment.rate);
+  if (GST_CLOCK_TIME_IS_VALID (segment.stop) && segment.start > segment.stop)
+    segment.start = segment.stop;
+
+  size = gst_buffer_get_size (buffer);
+  rate = GST_AUDIO_INFO_RATE (&adder->info);
+  bpf = GST_AUDIO_INFO_BPF (&adder->info);
+
+  if (GST_AUDIO_INFO_LAYOUT (&adder->info) == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+    buffer = gst_adder_clip_planar (adder, buffer, &segment);
+  else
+    buffer = gst_audio_buffer_clip (buffer, &segment, rate, bpf);
+
+  if (buffer == NULL || gst_buffer_get_size (buffer) != size) {
+    GST_DEBUG_OBJECT (pad, "dropped %s buffer, already mixed up to %"
+        GST_TIME_FORMAT, buffer ? "part of late" : "late",
+        GST_TIME_ARGS (mixed));
+    GST_OBJECT_LOCK (pad);
+    pad->late++;
+    GST_OBJECT_UNLOCK (pad);
+  }
+
+  return buffer;
+}
+
+/* Like gst_collect_pads_available() but skips pads that were set to
+ * non-waiting because they missed the deadline. */
+static guint
+gst_adder_available (GstAdder * adder, GstCollectPads * pads)
+{
+  GSList *collected;
+  guint available = G_MAXUINT;
+
+  for (collected = pads->data; collected; collected = g_slist_next (collected)) {
+    GstCollectData *data = (GstCollectData *) collected->data;
+    guint size;
+
+    if (GST_COLLECT_PADS_STATE_IS_SET (data, GST_COLLECT_PADS_STATE_EOS))
+      continue;
+
+    if (data->buffer == NULL) {
+      if (GST_COLLECT_PADS_STATE_IS_SET (data, GST_COLLECT_PADS_STATE_WAITING))
+        return 0;
+      continue;
+    }
+
+    size = gst_buffer_get_size (data->buffer) - data->pos;
+    available = MIN (available, size);
+  }
+
+  return available == G_MAXUINT ? 0 : available;
+}
+
 static gboolean
 gst_adder_sink_event (GstCollectPads * pads, GstCollectData * pad,
     GstEvent * event, gpointer user_data)
@@ -855,6 +1102,10 @@ gst_adder_sink_event (GstCollectPads * pads, GstCollectData * pad,
         discard = TRUE;
         GST_DEBUG_OBJECT (pad->pad, "eating flush stop");
       }
+      gst_adder_cancel_timeout (adder);
+      GST_OBJECT_LOCK (adder);
+      adder->mixed_running_time = GST_CLOCK_TIME_NONE;
+      GST_OBJECT_UNLOCK (adder);
       GST_COLLECT_PADS_STREAM_UNLOCK (adder->collect);
       /* Clear pending tags */
       if (adder->pending_events) {
@@ -909,6 +1160,68 @@ gst_adder_class_init (GstAdderClass * klass)
           "object.", GST_TYPE_CAPS,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAdder:float-accumulator:
+   *
+   * Mix 16 and 32 bit signed integer samples in a floating point buffer and
+   * only clip the final sum, instead of clipping after each added stream.
+   * The result then no longer depends on the order of the sink pads when
+   * intermediate sums exceed the sample range. Other formats are not
+   * affected.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_FLOAT_ACCUMULATOR,
+      g_param_spec_boolean ("float-accumulator", "Float accumulator",
+          "Mix signed 16 and 32 bit integer samples in a floating point "
+          "buffer and clip only once", DEFAULT_FLOAT_ACCUMULATOR,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdder:skipped-buffers:
+   *
+   * Number of input buffers that were not mixed because they had the GAP
+   * flag set or only contained silence.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_SKIPPED_BUFFERS,
+      g_param_spec_uint64 ("skipped-buffers", "Skipped buffers",
+          "Number of GAP or silent input buffers that were not mixed", 0,
+          G_MAXUINT64, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdder:passthrough-buffers:
+   *
+   * Number of output buffers that were pushed without mixing, because at
+   * most one input had sound at unity volume.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_PASSTHROUGH_BUFFERS,
+      g_param_spec_uint64 ("passthrough-buffers", "Passthrough buffers",
+          "Number of output buffers that were pushed without mixing", 0,
+          G_MAXUINT64, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdder:latency:
+   *
+   * How long to wait for late inputs, in nanoseconds. When this is not 0
+   * and the pipeline is running, adder stops waiting for pads that have
+   * no data once the end of the data on the other pads plus this latency
+   * has passed on the clock. It then mixes what has arrived and treats the
+   * missing pads as silence, so that one late live source does not stall
+   * the output. Data that arrives after its samples were mixed is dropped.
+   * The latency is added to the latency reported downstream.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_LATENCY,
+      g_param_spec_uint64 ("latency", "Latency",
+          "Time to wait for late inputs before mixing without them "
+          "(0 = wait for all inputs)", 0, G_MAXUINT64, DEFAULT_LATENCY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_adder_src_template));
   gst_element_class_add_pad_template (gstelement_class,
@@ -945,6 +1258,14 @@ gst_adder_init (GstAdder * adder)
   adder->padcount = 0;
 
   adder->filter_caps = NULL;
+  adder->float_accumulator = DEFAULT_FLOAT_ACCUMULATOR;
+  adder->accumulator = NULL;
+  adder->accumulator_size = 0;
+  adder->skipped = 0;
+  adder->passthrough = 0;
+  adder->latency = DEFAULT_LATENCY;
+  adder->timeout_id = NULL;
+  adder->mixed_running_time = GST_CLOCK_TIME_NONE;
 
   /* keep track of the sinkpads requested */
   adder->collect = gst_collect_pads_new ();
@@ -976,6 +1297,10 @@ gst_adder_dispose (GObject * object)
     adder->pending_events = NULL;
   }
 
+  g_free (adder->accumulator);
+  adder->accumulator = NULL;
+  adder->accumulator_size = 0;
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -1007,6 +1332,18 @@ gst_adder_set_property (GObject * object, guint prop_id,
       GST_DEBUG_OBJECT (adder, "set new caps %" GST_PTR_FORMAT, new_caps);
       break;
     }
+    case PROP_FLOAT_ACCUMULATOR:
+      GST_OBJECT_LOCK (adder);
+      adder->float_accumulator = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (adder);
+      break;
+    case PROP_LATENCY:
+      GST_OBJECT_LOCK (adder);
+      adder->latency = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (adder);
+      gst_element_post_message (GST_ELEMENT_CAST (adder),
+          gst_message_new_latency (GST_OBJECT_CAST (adder)));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1025,6 +1362,26 @@ gst_adder_get_property (GObject * object, guint prop_id, GValue * value,
       gst_value_set_caps (value, adder->filter_caps);
       GST_OBJECT_UNLOCK (adder);
       break;
+    case PROP_FLOAT_ACCUMULATOR:
+      GST_OBJECT_LOCK (adder);
+      g_value_set_boolean (value, adder->float_accumulator);
+      GST_OBJECT_UNLOCK (adder);
+      break;
+    case PROP_SKIPPED_BUFFERS:
+      GST_OBJECT_LOCK (adder);
+      g_value_set_uint64 (value, adder->skipped);
+      GST_OBJECT_UNLOCK (adder);
+      break;
+    case PROP_PASSTHROUGH_BUFFERS:
+      GST_OBJECT_LOCK (adder);
+      g_value_set_uint64 (value, adder->passthrough);
+      GST_OBJECT_UNLOCK (adder);
+      break;
+    case PROP_LATENCY:
+      GST_OBJECT_LOCK (adder);
+      g_value_set_uint64 (value, adder->latency);
+      GST_OBJECT_UNLOCK (adder);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1055,8 +1412,10 @@ gst_adder_request_new_pad (GstElement * element, GstPadTemplate * templ,
   GST_DEBUG_OBJECT (adder, "request new pad %s", name);
   g_free (name);
 
+  /* don't lock the waiting state, pads that miss the deadline of the latency
+   * property are set to non-waiting until the next collection */
   gst_collect_pads_add_pad (adder->collect, newpad, sizeof (GstCollectData),
-      NULL, TRUE);
+      NULL, FALSE);
 
   /* takes ownership of the pad */
   if (!gst_element_add_pad (GST_ELEMENT (adder), newpad))
@@ -1098,6 +1457,137 @@ gst_adder_release_pad (GstElement * element, GstPad * pad)
   gst_element_remove_pad (element, pad);
 }
 
+/* Non-interleaved audio stores every channel in its own plane, one after
+ * the other. Returns a new buffer with @n_frames frames starting at frame
+ * @offset of every plane of @buffer. */
+static GstBuffer *
+gst_adder_planar_region (GstAdder * adder, GstBuffer * buffer, gsize offset,
+    gsize n_frames)
+{
+  GstBuffer *res;
+  GstMapInfo inmap, outmap;
+  gint rate, bps, channels, c;
+  gsize in_frames;
+
+  rate = GST_AUDIO_INFO_RATE (&adder->info);
+  bps = GST_AUDIO_INFO_BPS (&adder->info);
+  channels = GST_AUDIO_INFO_CHANNELS (&adder->info);
+
+  in_frames = gst_buffer_get_size (buffer) / (bps * channels);
+
+  res = gst_buffer_new_allocate (NULL, n_frames * bps * channels, NULL);
+  gst_buffer_copy_into (res, buffer,
+      GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+
+  gst_buffer_map (buffer, &inmap, GST_MAP_READ);
+  gst_buffer_map (res, &outmap, GST_MAP_WRITE);
+  for (c = 0; c < channels; c++)
+    memcpy (outmap.data + c * n_frames * bps,
+        inmap.data + (c * in_frames + offset) * bps, n_frames * bps);
+  gst_buffer_unmap (res, &outmap);
+  gst_buffer_unmap (buffer, &inmap);
+
+  if (GST_BUFFER_TIMESTAMP_IS_VALID (res))
+    GST_BUFFER_TIMESTAMP (res) +=
+        gst_util_uint64_scale_int (offset, GST_SECOND, rate);
+  if (GST_BUFFER_DURATION_IS_VALID (res))
+    GST_BUFFER_DURATION (res) =
+        gst_util_uint64_scale_int (n_frames, GST_SECOND, rate);
+  if (GST_BUFFER_OFFSET_IS_VALID (res)) {
+    GST_BUFFER_OFFSET (res) += offset;
+    if (GST_BUFFER_OFFSET_END_IS_VALID (res))
+      GST_BUFFER_OFFSET_END (res) = GST_BUFFER_OFFSET (res) + n_frames;
+  }
+
+  return res;
+}
+
+/* gst_audio_buffer_clip() trims bytes at the start and end of the buffer,
+ * for non-interleaved audio the frames are removed from every plane */
+static GstBuffer *
+gst_adder_clip_planar (GstAdder * adder, GstBuffer * buffer,
+    GstSegment * segment)
+{
+  GstBuffer *res;
+  guint64 start, stop, cstart, cstop;
+  gsize n_frames, front, back;
+  gint rate, bpf;
+
+  /* only time segments are clipped, like the timestamps we sync on */
+  if (segment->format != GST_FORMAT_TIME
+      || !GST_BUFFER_TIMESTAMP_IS_VALID (buffer))
+    return buffer;
+
+  rate = GST_AUDIO_INFO_RATE (&adder->info);
+  bpf = GST_AUDIO_INFO_BPF (&adder->info);
+
+  n_frames = gst_buffer_get_size (buffer) / bpf;
+  if (n_frames == 0)
+    return buffer;
+
+  start = GST_BUFFER_TIMESTAMP (buffer);
+  stop = start + gst_util_uint64_scale_int (n_frames, GST_SECOND, rate);
+
+  if (!gst_segment_clip (segment, GST_FORMAT_TIME, start, stop, &cstart,
+          &cstop)) {
+    gst_buffer_unref (buffer);
+    return NULL;
+  }
+
+  front = gst_util_uint64_scale_int (cstart - start, rate, GST_SECOND);
+  back = gst_util_uint64_scale_int (stop - cstop, rate, GST_SECOND);
+  if (front == 0 && back == 0)
+    return buffer;
+
+  if (front + back >= n_frames) {
+    gst_buffer_unref (buffer);
+    return NULL;
+  }
+
+  res = gst_adder_planar_region (adder, buffer, front,
+      n_frames - front - back);
+  gst_buffer_unref (buffer);
+
+  return res;
+}
+
+/* gst_collect_pads_take_buffer() hands out byte ranges of the queued
+ * buffers. For non-interleaved audio we take the frames from every plane
+ * and keep the position of the collect data in bytes of frames. */
+static GstBuffer *
+gst_adder_take_buffer (GstAdder * adder, GstCollectPads * pads,
+    GstCollectData * data, guint size)
+{
+  GstBuffer *buffer, *res;
+  gsize in_frames, offset, n_frames;
+  gint bpf;
+
+  if (GST_AUDIO_INFO_LAYOUT (&adder->info) != GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+    return gst_collect_pads_take_buffer (pads, data, size);
+
+  buffer = gst_collect_pads_peek (pads, data);
+  if (buffer == NULL)
+    return NULL;
+
+  bpf = GST_AUDIO_INFO_BPF (&adder->info);
+
+  in_frames = gst_buffer_get_size (buffer) / bpf;
+  offset = data->pos / bpf;
+  n_frames = MIN (size / bpf, in_frames - offset);
+
+  if (n_frames == 0)
+    res = NULL;
+  else if (offset == 0 && n_frames == in_frames)
+    res = gst_buffer_ref (buffer);
+  else
+    res = gst_adder_planar_region (adder, buffer, offset, n_frames);
+  gst_buffer_unref (buffer);
+
+  gst_collect_pads_flush (pads, data, n_frames * bpf);
+
+  return res;
+}
+
 static GstFlowReturn
 gst_adder_do_clip (GstCollectPads * pads, GstCollectData * data,
     GstBuffer * buffer, GstBuffer ** out, gpointer user_data)
@@ -1108,12 +1598,228 @@ gst_adder_do_clip (GstCollectPads * pads, GstCollectData * data,
   rate = GST_AUDIO_INFO_RATE (&adder->info);
   bpf = GST_AUDIO_INFO_BPF (&adder->info);
 
-  buffer = gst_audio_buffer_clip (buffer, &data->segment, rate, bpf);
+  if (GST_AUDIO_INFO_LAYOUT (&adder->info) == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+    buffer = gst_adder_clip_planar (adder, buffer, &data->segment);
+  else
+    buffer = gst_audio_buffer_clip (buffer, &data->segment, rate, bpf);
+
+  if (buffer) {
+    buffer = gst_adder_drop_late (adder, data, buffer);
+    if (buffer)
+      gst_adder_schedule_timeout (adder, gst_adder_running_time_end (adder,
+              data, buffer));
+  }
 
   *out = buffer;
   return GST_FLOW_OK;
 }
 
+/* a mapped non-GAP input buffer and the volume of its pad at the time it
+ * was collected */
+typedef struct
+{
+  GstBuffer *buffer;
+  GstMapInfo map;
+  gdouble volume;
+  gint volume_i32;
+  gint volume_i16;
+  gint volume_i8;
+} GstAdderInput;
+
+#define MIX_INPUTS(format,vol) G_STMT_START {                              \
+  for (i = 0; i + 4 <= n_inputs; i += 4) {                                  \
+    adder_orc_add_volume4_##format ((gpointer) outmap->data,                \
+        (gpointer) inputs[i].map.data, (gpointer) inputs[i + 1].map.data,   \
+        (gpointer) inputs[i + 2].map.data,                                  \
+        (gpointer) inputs[i + 3].map.data, inputs[i].vol,                   \
+        inputs[i + 1].vol, inputs[i + 2].vol, inputs[i + 3].vol,            \
+        n_samples);                                                         \
+  }                                                                         \
+  for (; i < n_inputs; i++) {                                               \
+    if (inputs[i].volume == 1.0)                                            \
+      adder_orc_add_##format ((gpointer) outmap->data,                      \
+          (gpointer) inputs[i].map.data, n_samples);                        \
+    else                                                                    \
+      adder_orc_add_volume_##format ((gpointer) outmap->data,               \
+          (gpointer) inputs[i].map.data, inputs[i].vol, n_samples);         \
+  }                                                                         \
+} G_STMT_END
+
+/* Adds @inputs to the samples in @outmap. Mixing one input at a time means
+ * one pass over the output per input, so four inputs are added in each
+ * pass, scaled by their volume on the way. The clipping is the same as when
+ * adding them one after the other. */
+static void
+gst_adder_mix_inputs (GstAdder * adder, GstMapInfo * outmap,
+    GstAdderInput * inputs, guint n_inputs)
+{
+  guint n_samples = outmap->size / GST_AUDIO_INFO_BPS (&adder->info);
+  guint i;
+
+  switch (adder->info.finfo->format) {
+    case GST_AUDIO_FORMAT_U8:
+      MIX_INPUTS (u8, volume_i8);
+      break;
+    case GST_AUDIO_FORMAT_S8:
+      MIX_INPUTS (s8, volume_i8);
+      break;
+    case GST_AUDIO_FORMAT_U16:
+      MIX_INPUTS (u16, volume_i16);
+      break;
+    case GST_AUDIO_FORMAT_S16:
+      MIX_INPUTS (s16, volume_i16);
+      break;
+    case GST_AUDIO_FORMAT_U32:
+      MIX_INPUTS (u32, volume_i32);
+      break;
+    case GST_AUDIO_FORMAT_S32:
+      MIX_INPUTS (s32, volume_i32);
+      break;
+    case GST_AUDIO_FORMAT_F32:
+      MIX_INPUTS (f32, volume);
+      break;
+    case GST_AUDIO_FORMAT_F64:
+      MIX_INPUTS (f64, volume);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+#undef MIX_INPUTS
+
+/* Like gst_adder_mix_inputs() but for the float-accumulator property: the
+ * samples in @outmap (with @volume applied) and @inputs are summed in a
+ * float (S16) or double (S32) buffer and only clipped when writing the
+ * result back to @outmap. */
+static void
+gst_adder_accumulate_inputs (GstAdder * adder, GstMapInfo * outmap,
+    gdouble volume, GstAdderInput * inputs, guint n_inputs)
+{
+  guint n_samples = outmap->size / GST_AUDIO_INFO_BPS (&adder->info);
+  gsize size;
+  guint i;
+
+  if (adder->info.finfo->format == GST_AUDIO_FORMAT_S16)
+    size = n_samples * sizeof (gfloat);
+  else
+    size = n_samples * sizeof (gdouble);
+
+  if (adder->accumulator_size < size) {
+    g_free (adder->accumulator);
+    adder->accumulator = g_malloc (size);
+    adder->accumulator_size = size;
+  }
+  memset (adder->accumulator, 0, size);
+
+  switch (adder->info.finfo->format) {
+    case GST_AUDIO_FORMAT_S16:
+      adder_orc_accumulate_s16 (adder->accumulator,
+          (gpointer) outmap->data, volume, n_samples);
+      for (i = 0; i + 4 <= n_inputs; i += 4) {
+        adder_orc_accumulate4_s16 (adder->accumulator,
+            (gpointer) inputs[i].map.data, (gpointer) inputs[i + 1].map.data,
+            (gpointer) inputs[i + 2].map.data,
+            (gpointer) inputs[i + 3].map.data, inputs[i].volume,
+            inputs[i + 1].volume, inputs[i + 2].volume, inputs[i + 3].volume,
+            n_samples);
+      }
+      for (; i < n_inputs; i++) {
+        adder_orc_accumulate_s16 (adder->accumulator,
+            (gpointer) inputs[i].map.data, inputs[i].volume, n_samples);
+      }
+      adder_orc_clamp_s16 ((gpointer) outmap->data, adder->accumulator,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_S32:
+      adder_orc_accumulate_s32 (adder->accumulator,
+          (gpointer) outmap->data, volume, n_samples);
+      for (i = 0; i + 4 <= n_inputs; i += 4) {
+        adder_orc_accumulate4_s32 (adder->accumulator,
+            (gpointer) inputs[i].map.data, (gpointer) inputs[i + 1].map.data,
+            (gpointer) inputs[i + 2].map.data,
+            (gpointer) inputs[i + 3].map.data, inputs[i].volume,
+            inputs[i + 1].volume, inputs[i + 2].volume, inputs[i + 3].volume,
+            n_samples);
+      }
+      for (; i < n_inputs; i++) {
+        adder_orc_accumulate_s32 (adder->accumulator,
+            (gpointer) inputs[i].map.data, inputs[i].volume, n_samples);
+      }
+      adder_orc_clamp_s32 ((gpointer) outmap->data, adder->accumulator,
+          n_samples);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/* Applies the volume of @input in place to the samples in @outmap */
+static void
+gst_adder_apply_volume (GstAdder * adder, GstMapInfo * outmap,
+    const GstAdderInput * input)
+{
+  guint n_samples = outmap->size / GST_AUDIO_INFO_BPS (&adder->info);
+
+  switch (adder->info.finfo->format) {
+    case GST_AUDIO_FORMAT_U8:
+      adder_orc_volume_u8 ((gpointer) outmap->data, input->volume_i8,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_S8:
+      adder_orc_volume_s8 ((gpointer) outmap->data, input->volume_i8,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_U16:
+      adder_orc_volume_u16 ((gpointer) outmap->data, input->volume_i16,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_S16:
+      adder_orc_volume_s16 ((gpointer) outmap->data, input->volume_i16,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_U32:
+      adder_orc_volume_u32 ((gpointer) outmap->data, input->volume_i32,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_S32:
+      adder_orc_volume_s32 ((gpointer) outmap->data, input->volume_i32,
+          n_samples);
+      break;
+    case GST_AUDIO_FORMAT_F32:
+      adder_orc_volume_f32 ((gpointer) outmap->data, input->volume, n_samples);
+      break;
+    case GST_AUDIO_FORMAT_F64:
+      adder_orc_volume_f64 ((gpointer) outmap->data, input->volume, n_samples);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/* Checks if @map only contains silence for the negotiated format. The first
+ * sample is compared against the silence pattern, which rejects almost all
+ * buffers with sound right away, then the rest of the buffer is compared
+ * against itself shifted by one sample. */
+static gboolean
+gst_adder_is_silent (GstAdder * adder, const GstMapInfo * map)
+{
+  guint8 silence[8];
+  gint bps = GST_AUDIO_INFO_BPS (&adder->info);
+
+  if (map->size < bps)
+    return FALSE;
+
+  gst_audio_format_fill_silence (adder->info.finfo, silence, bps);
+  if (memcmp (map->data, silence, bps) != 0)
+    return FALSE;
+
+  return memcmp (map->data, map->data + bps, map->size - bps) == 0;
+}
+
 static GstFlowReturn
 gst_adder_collected (GstCollectPads * pads, gpointer user_data)
 {
@@ -1123,8 +1829,11 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
    * - this function is called when all pads have a buffer
    * - get available bytes on all pads.
    * - repeat for each input pad :
-   *   - read available bytes, copy or add to target buffer
+   *   - read available bytes, skip GAP buffers and buffers with only silence
    *   - if there's an EOS event, remove the input channel
+   * - if only one input is left and it has unity volume, pass it on as is
+   * - otherwise the first input becomes the target buffer and the other
+   *   buffers are added to it, several at a time
    * - push out the output buffer
    *
    * todo:
@@ -1143,6 +1852,11 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
   gint64 next_timestamp;
   gint rate, bps, bpf;
   gboolean had_mute = FALSE;
+  GstAdderInput *inputs;
+  guint n_inputs = 0;
+  guint64 skipped = 0, passthrough = 0;
+  gboolean accumulate;
+  gboolean timed_out = FALSE;
 
   adder = GST_ADDER (user_data);
 
@@ -1183,12 +1897,32 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
     adder->send_caps = FALSE;
   }
 
+  /* the data is collected, there is no need for the deadline anymore */
+  gst_adder_cancel_timeout (adder);
+
   /* get available bytes for reading, this can be 0 which could mean empty
    * buffers or EOS, which we will catch when we loop over the pads. */
-  outsize = gst_collect_pads_available (pads);
-  /* can only happen when no pads to collect or all EOS */
-  if (outsize == 0)
+  outsize = gst_adder_available (adder, pads);
+
+  /* pads that missed the deadline are mixed as silence this time, wait for
+   * them again from the next output buffer on */
+  for (collected = pads->data; collected; collected = g_slist_next (collected)) {
+    GstCollectData *collect_data = (GstCollectData *) collected->data;
+
+    if (!GST_COLLECT_PADS_STATE_IS_SET (collect_data,
+            GST_COLLECT_PADS_STATE_WAITING)) {
+      gst_collect_pads_set_waiting (pads, collect_data, TRUE);
+      timed_out = TRUE;
+    }
+  }
+
+  if (outsize == 0) {
+    /* the pads that had data were flushed after the deadline */
+    if (timed_out)
+      return GST_FLOW_OK;
+    /* can only happen when no pads to collect or all EOS */
     goto eos;
+  }
 
   rate = GST_AUDIO_INFO_RATE (&adder->info);
   bps = GST_AUDIO_INFO_BPS (&adder->info);
@@ -1198,11 +1932,20 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
       "starting to cycle through channels, %d bytes available (bps = %d, bpf = %d)",
       outsize, bps, bpf);
 
+  GST_OBJECT_LOCK (adder);
+  accumulate = adder->float_accumulator
+      && (adder->info.finfo->format == GST_AUDIO_FORMAT_S16
+      || adder->info.finfo->format == GST_AUDIO_FORMAT_S32);
+  GST_OBJECT_UNLOCK (adder);
+
+  inputs = g_newa (GstAdderInput, g_slist_length (pads->data));
+
   for (collected = pads->data; collected; collected = next) {
     GstCollectData *collect_data;
     GstBuffer *inbuf;
     gboolean is_gap;
     GstAdderPad *pad;
+    GstAdderInput *input;
     GstClockTime timestamp, stream_time;
 
     /* take next to see if this is the last collectdata */
@@ -1213,7 +1956,7 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
 
     /* get a buffer of size bytes, if we get a buffer, it is at least outsize
      * bytes big. */
-    inbuf = gst_collect_pads_take_buffer (pads, collect_data, outsize);
+    inbuf = gst_adder_take_buffer (adder, pads, collect_data, outsize);
     /* NULL means EOS or an empty buffer so we still need to flush in
      * case of an empty buffer. */
     if (inbuf == NULL) {
@@ -1239,182 +1982,96 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
       continue;
     }
 
-    is_gap = GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP);
+    input = &inputs[n_inputs];
 
-    /* Try to make an output buffer */
-    if (outbuf == NULL) {
-      /* if this is a gap buffer but we have some more pads to check, skip it.
-       * If we are at the last buffer, take it, regardless if it is a GAP
-       * buffer or not. */
-      if (is_gap && next) {
-        GST_DEBUG_OBJECT (adder, "skipping, non-last GAP buffer");
-        /* we keep the GAP buffer, if we don't have anymore buffers (all pads
-         * EOS, we can use this one as the output buffer. */
-        if (gapbuf == NULL)
-          gapbuf = inbuf;
-        else
-          gst_buffer_unref (inbuf);
-        GST_OBJECT_UNLOCK (pad);
-        continue;
+    is_gap = GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP);
+    if (!is_gap) {
+      gst_buffer_map (inbuf, &input->map, GST_MAP_READ);
+
+      /* all buffers should have outsize, there are no short buffers because we
+       * asked for the max size above */
+      g_assert (input->map.size == outsize);
+
+      if (gst_adder_is_silent (adder, &input->map)) {
+        GST_LOG_OBJECT (adder, "channel %p: buffer only contains silence",
+            collect_data);
+        gst_buffer_unmap (inbuf, &input->map);
+        is_gap = TRUE;
       }
+    }
 
-      GST_LOG_OBJECT (adder, "channel %p: preparing output buffer of %d bytes",
-          collect_data, outsize);
-
-      /* make data and metadata writable, can simply return the inbuf when we
-       * are the only one referencing this buffer. If this is the last (and
-       * only) GAP buffer, it will automatically copy the GAP flag. */
-      outbuf = gst_buffer_make_writable (inbuf);
-      gst_buffer_map (outbuf, &outmap, GST_MAP_READWRITE);
-
-      if (pad->volume != 1.0) {
-        switch (adder->info.finfo->format) {
-          case GST_AUDIO_FORMAT_U8:
-            adder_orc_volume_u8 ((gpointer) outmap.data, pad->volume_i8,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_S8:
-            adder_orc_volume_s8 ((gpointer) outmap.data, pad->volume_i8,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_U16:
-            adder_orc_volume_u16 ((gpointer) outmap.data, pad->volume_i16,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_S16:
-            adder_orc_volume_s16 ((gpointer) outmap.data, pad->volume_i16,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_U32:
-            adder_orc_volume_u32 ((gpointer) outmap.data, pad->volume_i32,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_S32:
-            adder_orc_volume_s32 ((gpointer) outmap.data, pad->volume_i32,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_F32:
-            adder_orc_volume_f32 ((gpointer) outmap.data, pad->volume,
-                outmap.size / bps);
-            break;
-          case GST_AUDIO_FORMAT_F64:
-            adder_orc_volume_f64 ((gpointer) outmap.data, pad->volume,
-                outmap.size / bps);
-            break;
-          default:
-            g_assert_not_reached ();
-            break;
-        }
-      }
-    } else {
-      if (!is_gap) {
-        /* we had a previous output buffer, mix this non-GAP buffer */
-        GstMapInfo inmap;
-
-        gst_buffer_map (inbuf, &inmap, GST_MAP_READ);
-
-        /* all buffers should have outsize, there are no short buffers because we
-         * asked for the max size above */
-        g_assert (inmap.size == outmap.size);
-
-        GST_LOG_OBJECT (adder, "channel %p: mixing %" G_GSIZE_FORMAT " bytes"
-            " from data %p", collect_data, inmap.size, inmap.data);
-
-        /* further buffers, need to add them */
-        if (pad->volume == 1.0) {
-          switch (adder->info.finfo->format) {
-            case GST_AUDIO_FORMAT_U8:
-              adder_orc_add_u8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S8:
-              adder_orc_add_s8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U16:
-              adder_orc_add_u16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S16:
-              adder_orc_add_s16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U32:
-              adder_orc_add_u32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S32:
-              adder_orc_add_s32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F32:
-              adder_orc_add_f32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F64:
-              adder_orc_add_f64 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            default:
-              g_assert_not_reached ();
-              break;
-          }
-        } else {
-          switch (adder->info.finfo->format) {
-            case GST_AUDIO_FORMAT_U8:
-              adder_orc_add_volume_u8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i8, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S8:
-              adder_orc_add_volume_s8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i8, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U16:
-              adder_orc_add_volume_u16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i16, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S16:
-              adder_orc_add_volume_s16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i16, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U32:
-              adder_orc_add_volume_u32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i32, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S32:
-              adder_orc_add_volume_s32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i32, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F32:
-              adder_orc_add_volume_f32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F64:
-              adder_orc_add_volume_f64 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume, inmap.size / bps);
-              break;
-            default:
-              g_assert_not_reached ();
-              break;
-          }
-        }
-        gst_buffer_unmap (inbuf, &inmap);
-      } else {
-        /* skip gap buffer */
-        GST_LOG_OBJECT (adder, "channel %p: skipping GAP buffer", collect_data);
-      }
-      gst_buffer_unref (inbuf);
+    if (is_gap) {
+      /* nothing to mix, but we keep the first GAP buffer, if we don't have
+       * any other buffers we can use it as the output buffer. */
+      GST_LOG_OBJECT (adder, "channel %p: skipping GAP buffer", collect_data);
+      skipped++;
+      if (gapbuf == NULL)
+        gapbuf = inbuf;
+      else
+        gst_buffer_unref (inbuf);
+      GST_OBJECT_UNLOCK (pad);
+      continue;
     }
+
+    input->buffer = inbuf;
+    input->volume = pad->volume;
+    input->volume_i32 = pad->volume_i32;
+    input->volume_i16 = pad->volume_i16;
+    input->volume_i8 = pad->volume_i8;
+    n_inputs++;
     GST_OBJECT_UNLOCK (pad);
+
+    GST_LOG_OBJECT (adder, "channel %p: mixing %" G_GSIZE_FORMAT " bytes"
+        " from data %p", collect_data, input->map.size, input->map.data);
   }
-  if (outbuf)
+
+  if (n_inputs == 1 && inputs[0].volume == 1.0) {
+    /* only one stream with sound, pass it on without touching the data. We
+     * only need writable metadata for the timestamps, which does not copy
+     * the memory. */
+    GST_LOG_OBJECT (adder, "passing through single non-silent buffer");
+    gst_buffer_unmap (inputs[0].buffer, &inputs[0].map);
+    outbuf = gst_buffer_make_writable (inputs[0].buffer);
+    passthrough++;
+  } else if (n_inputs > 0) {
+    guint i;
+
+    GST_LOG_OBJECT (adder, "channel %p: preparing output buffer of %d bytes",
+        inputs[0].buffer, outsize);
+
+    /* the first buffer becomes the output buffer, make data and metadata
+     * writable, can simply return the inbuf when we are the only one
+     * referencing this buffer. */
+    gst_buffer_unmap (inputs[0].buffer, &inputs[0].map);
+    outbuf = gst_buffer_make_writable (inputs[0].buffer);
+    gst_buffer_map (outbuf, &outmap, GST_MAP_READWRITE);
+
+    if (accumulate) {
+      /* the accumulator applies the volume while converting to float */
+      gst_adder_accumulate_inputs (adder, &outmap, inputs[0].volume,
+          inputs + 1, n_inputs - 1);
+    } else {
+      if (inputs[0].volume != 1.0)
+        gst_adder_apply_volume (adder, &outmap, &inputs[0]);
+      if (n_inputs > 1)
+        gst_adder_mix_inputs (adder, &outmap, inputs + 1, n_inputs - 1);
+    }
+
+    for (i = 1; i < n_inputs; i++) {
+      gst_buffer_unmap (inputs[i].buffer, &inputs[i].map);
+      gst_buffer_unref (inputs[i].buffer);
+    }
     gst_buffer_unmap (outbuf, &outmap);
+  }
 
   if (outbuf == NULL) {
     /* no output buffer, reuse one of the GAP buffers then if we have one */
     if (gapbuf) {
       GST_LOG_OBJECT (adder, "reusing GAP buffer %p", gapbuf);
-      outbuf = gapbuf;
+      outbuf = gst_buffer_make_writable (gapbuf);
+      /* it might have been a buffer with only silence without the flag */
+      GST_BUFFER_FLAG_SET (outbuf, GST_BUFFER_FLAG_GAP);
+      passthrough++;
     } else if (had_mute) {
       GstMapInfo map;
 
@@ -1433,6 +2090,20 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
     gst_buffer_unref (gapbuf);
   }
 
+  GST_OBJECT_LOCK (adder);
+  adder->skipped += skipped;
+  adder->passthrough += passthrough;
+  GST_OBJECT_UNLOCK (adder);
+
+  /* start the deadline for the next output buffer if a pad has data left */
+  for (collected = pads->data; collected; collected = g_slist_next (collected)) {
+    GstCollectData *collect_data = (GstCollectData *) collected->data;
+
+    if (collect_data->buffer)
+      gst_adder_schedule_timeout (adder, gst_adder_running_time_end (adder,
+              collect_data, collect_data->buffer));
+  }
+
   if (g_atomic_int_compare_and_exchange (&adder->new_segment_pending, TRUE,
           FALSE)) {
     GstEvent *event;
@@ -1503,6 +2174,18 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
   adder->offset = next_offset;
   adder->segment.position = next_timestamp;
 
+  /* the pads that missed the deadline were mixed as silence up to the end of
+   * this buffer, their data before that is dropped when it arrives */
+  if (timed_out && adder->segment.rate > 0.0) {
+    GstClockTime mixed;
+
+    mixed = gst_segment_to_running_time (&adder->segment, GST_FORMAT_TIME,
+        next_timestamp);
+    GST_OBJECT_LOCK (adder);
+    adder->mixed_running_time = mixed;
+    GST_OBJECT_UNLOCK (adder);
+  }
+
   /* send it out */
   GST_LOG_OBJECT (adder, "pushing outbuf %p, timestamp %" GST_TIME_FORMAT
       " offset %" G_GINT64_FORMAT, outbuf,
@@ -1548,11 +2231,16 @@ gst_adder_change_state (GstElement * element, GstStateChange transition)
       adder->send_caps = TRUE;
       gst_caps_replace (&adder->current_caps, NULL);
       gst_segment_init (&adder->segment, GST_FORMAT_TIME);
+      GST_OBJECT_LOCK (adder);
+      adder->skipped = adder->passthrough = 0;
+      adder->mixed_running_time = GST_CLOCK_TIME_NONE;
+      GST_OBJECT_UNLOCK (adder);
       gst_collect_pads_start (adder->collect);
       break;
     case GST_STATE_CHANGE_PAUSED_TO_PLAYING:
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_adder_cancel_timeout (adder);
       /* need to unblock the collectpads before calling the
        * parent change_state so that streaming can finish */
       gst_collect_pads_stop (adder->collect);
@@ -77,6 +77,22 @@ struct _GstAdder {
   
   gboolean send_stream_start;
   gboolean send_caps;
+
+  /* mix S16/S32 in floating point, set via property */
+  gboolean float_accumulator;
+  /* float or double sums for the float accumulator */
+  gpointer accumulator;
+  gsize accumulator_size;
+
+  /* stats, GAP or silent inputs and outputs pushed without mixing */
+  guint64 skipped;
+  guint64 passthrough;
+
+  /* live timeout mode, see the latency property */
+  GstClockTime latency;
+  GstClockID timeout_id;
+  /* running time up to which pads that missed a deadline were mixed */
+  GstClockTime mixed_running_time;
 };
 
 struct _GstAdderClass {
@@ -100,6 +116,10 @@ struct _GstAdderPad {
   gint volume_i16;
   gint volume_i8;
   gboolean mute;
+
+  /* stats of the live timeout mode */
+  guint64 missed;
+  guint64 late;
 };
 
 struct _GstAdderPadClass {
@@ -135,6 +135,54 @@ void adder_orc_add_volume_f32 (float *ORC_RESTRICT d1,
     const float *ORC_RESTRICT s1, float p1, int n);
 void adder_orc_add_volume_f64 (double *ORC_RESTRICT d1,
     const double *ORC_RESTRICT s1, double p1, int n);
+void adder_orc_add_volume4_u8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
+    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s8 (gint8 * ORC_RESTRICT d1,
+    const gint8 * ORC_RESTRICT s1, const gint8 * ORC_RESTRICT s2,
+    const gint8 * ORC_RESTRICT s3, const gint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_u16 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s16 (gint16 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_u32 (guint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2,
+    const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s32 (gint32 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_f32 (float *ORC_RESTRICT d1,
+    const float *ORC_RESTRICT s1, const float *ORC_RESTRICT s2,
+    const float *ORC_RESTRICT s3, const float *ORC_RESTRICT s4, float p1,
+    float p2, float p3, float p4, int n);
+void adder_orc_add_volume4_f64 (double *ORC_RESTRICT d1,
+    const double *ORC_RESTRICT s1, const double *ORC_RESTRICT s2,
+    const double *ORC_RESTRICT s3, const double *ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n);
+void adder_orc_accumulate_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, float p1, int n);
+void adder_orc_accumulate4_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, float p1,
+    float p2, float p3, float p4, int n);
+void adder_orc_clamp_s16 (gint16 * ORC_RESTRICT d1,
+    const float *ORC_RESTRICT s1, int n);
+void adder_orc_accumulate_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, double p1, int n);
+void adder_orc_accumulate4_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n);
+void adder_orc_clamp_s32 (gint32 * ORC_RESTRICT d1,
+    const double *ORC_RESTRICT s1, int n);
 
 
 /* begin Orc C target preamble */
@@ -3614,3 +3662,4718 @@ adder_orc_add_volume_f64 (double *ORC_RESTRICT d1,
   func (ex);
 }
 #endif
+
+
+/* adder_orc_add_volume4_u8 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_u8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
+    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var36;
+#else
+  orc_int8 var36;
+#endif
+  orc_int8 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var38;
+#else
+  orc_int8 var38;
+#endif
+  orc_int8 var39;
+  orc_int8 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var41;
+#else
+  orc_int8 var41;
+#endif
+  orc_int8 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var43;
+#else
+  orc_int8 var43;
+#endif
+  orc_int8 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var45;
+#else
+  orc_int8 var45;
+#endif
+  orc_int8 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var47;
+#else
+  orc_int8 var47;
+#endif
+  orc_int8 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var49;
+#else
+  orc_int8 var49;
+#endif
+  orc_int8 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var51;
+#else
+  orc_int8 var51;
+#endif
+  orc_int8 var52;
+  orc_int8 var53;
+  orc_union16 var54;
+  orc_union16 var55;
+  orc_int8 var56;
+  orc_int8 var57;
+  orc_int8 var58;
+  orc_int8 var59;
+  orc_union16 var60;
+  orc_union16 var61;
+  orc_int8 var62;
+  orc_int8 var63;
+  orc_int8 var64;
+  orc_int8 var65;
+  orc_union16 var66;
+  orc_union16 var67;
+  orc_int8 var68;
+  orc_int8 var69;
+  orc_int8 var70;
+  orc_int8 var71;
+  orc_union16 var72;
+  orc_union16 var73;
+  orc_int8 var74;
+  orc_int8 var75;
+
+  ptr0 = (orc_int8 *) d1;
+  ptr4 = (orc_int8 *) s1;
+  ptr5 = (orc_int8 *) s2;
+  ptr6 = (orc_int8 *) s3;
+  ptr7 = (orc_int8 *) s4;
+
+  /* 1: loadpb */
+  var36 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 3: loadpb */
+  var37 = p1;
+  /* 7: loadpb */
+  var38 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 12: loadpb */
+  var41 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 14: loadpb */
+  var42 = p2;
+  /* 18: loadpb */
+  var43 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 22: loadpb */
+  var45 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 24: loadpb */
+  var46 = p3;
+  /* 28: loadpb */
+  var47 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 32: loadpb */
+  var49 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 34: loadpb */
+  var50 = p4;
+  /* 38: loadpb */
+  var51 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var35 = ptr4[i];
+    /* 2: xorb */
+    var53 = var35 ^ var36;
+    /* 4: mulsbw */
+    var54.i = var53 * var37;
+    /* 5: shrsw */
+    var55.i = var54.i >> 3;
+    /* 6: convssswb */
+    var56 = ORC_CLAMP_SB (var55.i);
+    /* 8: xorb */
+    var57 = var56 ^ var38;
+    /* 9: loadb */
+    var39 = ptr0[i];
+    /* 10: addusb */
+    var58 = ORC_CLAMP_UB ((orc_uint8) var39 + (orc_uint8) var57);
+    /* 11: loadb */
+    var40 = ptr5[i];
+    /* 13: xorb */
+    var59 = var40 ^ var41;
+    /* 15: mulsbw */
+    var60.i = var59 * var42;
+    /* 16: shrsw */
+    var61.i = var60.i >> 3;
+    /* 17: convssswb */
+    var62 = ORC_CLAMP_SB (var61.i);
+    /* 19: xorb */
+    var63 = var62 ^ var43;
+    /* 20: addusb */
+    var64 = ORC_CLAMP_UB ((orc_uint8) var58 + (orc_uint8) var63);
+    /* 21: loadb */
+    var44 = ptr6[i];
+    /* 23: xorb */
+    var65 = var44 ^ var45;
+    /* 25: mulsbw */
+    var66.i = var65 * var46;
+    /* 26: shrsw */
+    var67.i = var66.i >> 3;
+    /* 27: convssswb */
+    var68 = ORC_CLAMP_SB (var67.i);
+    /* 29: xorb */
+    var69 = var68 ^ var47;
+    /* 30: addusb */
+    var70 = ORC_CLAMP_UB ((orc_uint8) var64 + (orc_uint8) var69);
+    /* 31: loadb */
+    var48 = ptr7[i];
+    /* 33: xorb */
+    var71 = var48 ^ var49;
+    /* 35: mulsbw */
+    var72.i = var71 * var50;
+    /* 36: shrsw */
+    var73.i = var72.i >> 3;
+    /* 37: convssswb */
+    var74 = ORC_CLAMP_SB (var73.i);
+    /* 39: xorb */
+    var75 = var74 ^ var51;
+    /* 40: addusb */
+    var52 = ORC_CLAMP_UB ((orc_uint8) var70 + (orc_uint8) var75);
+    /* 41: storeb */
+    ptr0[i] = var52;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var36;
+#else
+  orc_int8 var36;
+#endif
+  orc_int8 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var38;
+#else
+  orc_int8 var38;
+#endif
+  orc_int8 var39;
+  orc_int8 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var41;
+#else
+  orc_int8 var41;
+#endif
+  orc_int8 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var43;
+#else
+  orc_int8 var43;
+#endif
+  orc_int8 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var45;
+#else
+  orc_int8 var45;
+#endif
+  orc_int8 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var47;
+#else
+  orc_int8 var47;
+#endif
+  orc_int8 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var49;
+#else
+  orc_int8 var49;
+#endif
+  orc_int8 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_int8 var51;
+#else
+  orc_int8 var51;
+#endif
+  orc_int8 var52;
+  orc_int8 var53;
+  orc_union16 var54;
+  orc_union16 var55;
+  orc_int8 var56;
+  orc_int8 var57;
+  orc_int8 var58;
+  orc_int8 var59;
+  orc_union16 var60;
+  orc_union16 var61;
+  orc_int8 var62;
+  orc_int8 var63;
+  orc_int8 var64;
+  orc_int8 var65;
+  orc_union16 var66;
+  orc_union16 var67;
+  orc_int8 var68;
+  orc_int8 var69;
+  orc_int8 var70;
+  orc_int8 var71;
+  orc_union16 var72;
+  orc_union16 var73;
+  orc_int8 var74;
+  orc_int8 var75;
+
+  ptr0 = (orc_int8 *) ex->arrays[0];
+  ptr4 = (orc_int8 *) ex->arrays[4];
+  ptr5 = (orc_int8 *) ex->arrays[5];
+  ptr6 = (orc_int8 *) ex->arrays[6];
+  ptr7 = (orc_int8 *) ex->arrays[7];
+
+  /* 1: loadpb */
+  var36 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 3: loadpb */
+  var37 = ex->params[24];
+  /* 7: loadpb */
+  var38 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 12: loadpb */
+  var41 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 14: loadpb */
+  var42 = ex->params[25];
+  /* 18: loadpb */
+  var43 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 22: loadpb */
+  var45 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 24: loadpb */
+  var46 = ex->params[26];
+  /* 28: loadpb */
+  var47 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 32: loadpb */
+  var49 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+  /* 34: loadpb */
+  var50 = ex->params[27];
+  /* 38: loadpb */
+  var51 = (int) 0x00000080;     /* 128 or 6.32404e-322f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var35 = ptr4[i];
+    /* 2: xorb */
+    var53 = var35 ^ var36;
+    /* 4: mulsbw */
+    var54.i = var53 * var37;
+    /* 5: shrsw */
+    var55.i = var54.i >> 3;
+    /* 6: convssswb */
+    var56 = ORC_CLAMP_SB (var55.i);
+    /* 8: xorb */
+    var57 = var56 ^ var38;
+    /* 9: loadb */
+    var39 = ptr0[i];
+    /* 10: addusb */
+    var58 = ORC_CLAMP_UB ((orc_uint8) var39 + (orc_uint8) var57);
+    /* 11: loadb */
+    var40 = ptr5[i];
+    /* 13: xorb */
+    var59 = var40 ^ var41;
+    /* 15: mulsbw */
+    var60.i = var59 * var42;
+    /* 16: shrsw */
+    var61.i = var60.i >> 3;
+    /* 17: convssswb */
+    var62 = ORC_CLAMP_SB (var61.i);
+    /* 19: xorb */
+    var63 = var62 ^ var43;
+    /* 20: addusb */
+    var64 = ORC_CLAMP_UB ((orc_uint8) var58 + (orc_uint8) var63);
+    /* 21: loadb */
+    var44 = ptr6[i];
+    /* 23: xorb */
+    var65 = var44 ^ var45;
+    /* 25: mulsbw */
+    var66.i = var65 * var46;
+    /* 26: shrsw */
+    var67.i = var66.i >> 3;
+    /* 27: convssswb */
+    var68 = ORC_CLAMP_SB (var67.i);
+    /* 29: xorb */
+    var69 = var68 ^ var47;
+    /* 30: addusb */
+    var70 = ORC_CLAMP_UB ((orc_uint8) var64 + (orc_uint8) var69);
+    /* 31: loadb */
+    var48 = ptr7[i];
+    /* 33: xorb */
+    var71 = var48 ^ var49;
+    /* 35: mulsbw */
+    var72.i = var71 * var50;
+    /* 36: shrsw */
+    var73.i = var72.i >> 3;
+    /* 37: convssswb */
+    var74 = ORC_CLAMP_SB (var73.i);
+    /* 39: xorb */
+    var75 = var74 ^ var51;
+    /* 40: addusb */
+    var52 = ORC_CLAMP_UB ((orc_uint8) var70 + (orc_uint8) var75);
+    /* 41: storeb */
+    ptr0[i] = var52;
+  }
+
+}
+
+void
+adder_orc_add_volume4_u8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
+    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 117, 56, 11, 1, 1, 12, 1,
+        1, 12, 1, 1, 12, 1, 1, 12, 1, 1, 14, 1, 128, 0, 0, 0,
+        14, 4, 3, 0, 0, 0, 16, 1, 16, 1, 16, 1, 16, 1, 20, 2,
+        20, 1, 20, 1, 68, 33, 4, 16, 174, 32, 33, 24, 94, 32, 32, 17,
+        159, 33, 32, 68, 33, 33, 16, 35, 34, 0, 33, 68, 33, 5, 16, 174,
+        32, 33, 25, 94, 32, 32, 17, 159, 33, 32, 68, 33, 33, 16, 35, 34,
+        34, 33, 68, 33, 6, 16, 174, 32, 33, 26, 94, 32, 32, 17, 159, 33,
+        32, 68, 33, 33, 16, 35, 34, 34, 33, 68, 33, 7, 16, 174, 32, 33,
+        27, 94, 32, 32, 17, 159, 33, 32, 68, 33, 33, 16, 35, 0, 34, 33,
+        2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_u8");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_source (p, 1, "s2");
+      orc_program_add_source (p, 1, "s3");
+      orc_program_add_source (p, 1, "s4");
+      orc_program_add_constant (p, 1, 0x00000080, "c1");
+      orc_program_add_constant (p, 4, 0x00000003, "c2");
+      orc_program_add_parameter (p, 1, "p1");
+      orc_program_add_parameter (p, 1, "p2");
+      orc_program_add_parameter (p, 1, "p3");
+      orc_program_add_parameter (p, 1, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusb", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusb", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusb", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorb", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusb", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_s8 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_s8 (gint8 * ORC_RESTRICT d1,
+    const gint8 * ORC_RESTRICT s1, const gint8 * ORC_RESTRICT s2,
+    const gint8 * ORC_RESTRICT s3, const gint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var35;
+  orc_int8 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_int8 var43;
+  orc_int8 var44;
+  orc_union16 var45;
+  orc_union16 var46;
+  orc_int8 var47;
+  orc_int8 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_int8 var51;
+  orc_int8 var52;
+  orc_union16 var53;
+  orc_union16 var54;
+  orc_int8 var55;
+  orc_int8 var56;
+  orc_union16 var57;
+  orc_union16 var58;
+  orc_int8 var59;
+
+  ptr0 = (orc_int8 *) d1;
+  ptr4 = (orc_int8 *) s1;
+  ptr5 = (orc_int8 *) s2;
+  ptr6 = (orc_int8 *) s3;
+  ptr7 = (orc_int8 *) s4;
+
+  /* 1: loadpb */
+  var36 = p1;
+  /* 8: loadpb */
+  var39 = p2;
+  /* 14: loadpb */
+  var41 = p3;
+  /* 20: loadpb */
+  var43 = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var35 = ptr4[i];
+    /* 2: mulsbw */
+    var45.i = var35 * var36;
+    /* 3: shrsw */
+    var46.i = var45.i >> 3;
+    /* 4: convssswb */
+    var47 = ORC_CLAMP_SB (var46.i);
+    /* 5: loadb */
+    var37 = ptr0[i];
+    /* 6: addssb */
+    var48 = ORC_CLAMP_SB (var37 + var47);
+    /* 7: loadb */
+    var38 = ptr5[i];
+    /* 9: mulsbw */
+    var49.i = var38 * var39;
+    /* 10: shrsw */
+    var50.i = var49.i >> 3;
+    /* 11: convssswb */
+    var51 = ORC_CLAMP_SB (var50.i);
+    /* 12: addssb */
+    var52 = ORC_CLAMP_SB (var48 + var51);
+    /* 13: loadb */
+    var40 = ptr6[i];
+    /* 15: mulsbw */
+    var53.i = var40 * var41;
+    /* 16: shrsw */
+    var54.i = var53.i >> 3;
+    /* 17: convssswb */
+    var55 = ORC_CLAMP_SB (var54.i);
+    /* 18: addssb */
+    var56 = ORC_CLAMP_SB (var52 + var55);
+    /* 19: loadb */
+    var42 = ptr7[i];
+    /* 21: mulsbw */
+    var57.i = var42 * var43;
+    /* 22: shrsw */
+    var58.i = var57.i >> 3;
+    /* 23: convssswb */
+    var59 = ORC_CLAMP_SB (var58.i);
+    /* 24: addssb */
+    var44 = ORC_CLAMP_SB (var56 + var59);
+    /* 25: storeb */
+    ptr0[i] = var44;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_s8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var35;
+  orc_int8 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_int8 var43;
+  orc_int8 var44;
+  orc_union16 var45;
+  orc_union16 var46;
+  orc_int8 var47;
+  orc_int8 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_int8 var51;
+  orc_int8 var52;
+  orc_union16 var53;
+  orc_union16 var54;
+  orc_int8 var55;
+  orc_int8 var56;
+  orc_union16 var57;
+  orc_union16 var58;
+  orc_int8 var59;
+
+  ptr0 = (orc_int8 *) ex->arrays[0];
+  ptr4 = (orc_int8 *) ex->arrays[4];
+  ptr5 = (orc_int8 *) ex->arrays[5];
+  ptr6 = (orc_int8 *) ex->arrays[6];
+  ptr7 = (orc_int8 *) ex->arrays[7];
+
+  /* 1: loadpb */
+  var36 = ex->params[24];
+  /* 8: loadpb */
+  var39 = ex->params[25];
+  /* 14: loadpb */
+  var41 = ex->params[26];
+  /* 20: loadpb */
+  var43 = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var35 = ptr4[i];
+    /* 2: mulsbw */
+    var45.i = var35 * var36;
+    /* 3: shrsw */
+    var46.i = var45.i >> 3;
+    /* 4: convssswb */
+    var47 = ORC_CLAMP_SB (var46.i);
+    /* 5: loadb */
+    var37 = ptr0[i];
+    /* 6: addssb */
+    var48 = ORC_CLAMP_SB (var37 + var47);
+    /* 7: loadb */
+    var38 = ptr5[i];
+    /* 9: mulsbw */
+    var49.i = var38 * var39;
+    /* 10: shrsw */
+    var50.i = var49.i >> 3;
+    /* 11: convssswb */
+    var51 = ORC_CLAMP_SB (var50.i);
+    /* 12: addssb */
+    var52 = ORC_CLAMP_SB (var48 + var51);
+    /* 13: loadb */
+    var40 = ptr6[i];
+    /* 15: mulsbw */
+    var53.i = var40 * var41;
+    /* 16: shrsw */
+    var54.i = var53.i >> 3;
+    /* 17: convssswb */
+    var55 = ORC_CLAMP_SB (var54.i);
+    /* 18: addssb */
+    var56 = ORC_CLAMP_SB (var52 + var55);
+    /* 19: loadb */
+    var42 = ptr7[i];
+    /* 21: mulsbw */
+    var57.i = var42 * var43;
+    /* 22: shrsw */
+    var58.i = var57.i >> 3;
+    /* 23: convssswb */
+    var59 = ORC_CLAMP_SB (var58.i);
+    /* 24: addssb */
+    var44 = ORC_CLAMP_SB (var56 + var59);
+    /* 25: storeb */
+    ptr0[i] = var44;
+  }
+
+}
+
+void
+adder_orc_add_volume4_s8 (gint8 * ORC_RESTRICT d1,
+    const gint8 * ORC_RESTRICT s1, const gint8 * ORC_RESTRICT s2,
+    const gint8 * ORC_RESTRICT s3, const gint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 115, 56, 11, 1, 1, 12, 1,
+        1, 12, 1, 1, 12, 1, 1, 12, 1, 1, 14, 4, 3, 0, 0, 0,
+        16, 1, 16, 1, 16, 1, 16, 1, 20, 2, 20, 1, 20, 1, 174, 32,
+        4, 24, 94, 32, 32, 16, 159, 33, 32, 34, 34, 0, 33, 174, 32, 5,
+        25, 94, 32, 32, 16, 159, 33, 32, 34, 34, 34, 33, 174, 32, 6, 26,
+        94, 32, 32, 16, 159, 33, 32, 34, 34, 34, 33, 174, 32, 7, 27, 94,
+        32, 32, 16, 159, 33, 32, 34, 0, 34, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_s8");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_source (p, 1, "s2");
+      orc_program_add_source (p, 1, "s3");
+      orc_program_add_source (p, 1, "s4");
+      orc_program_add_constant (p, 4, 0x00000003, "c1");
+      orc_program_add_parameter (p, 1, "p1");
+      orc_program_add_parameter (p, 1, "p2");
+      orc_program_add_parameter (p, 1, "p3");
+      orc_program_add_parameter (p, 1, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssb", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssb", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssb", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulsbw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssswb", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssb", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_u16 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_u16 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var38;
+#else
+  orc_union16 var38;
+#endif
+  orc_union16 var39;
+  orc_union16 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var41;
+#else
+  orc_union16 var41;
+#endif
+  orc_union16 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var43;
+#else
+  orc_union16 var43;
+#endif
+  orc_union16 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var45;
+#else
+  orc_union16 var45;
+#endif
+  orc_union16 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var47;
+#else
+  orc_union16 var47;
+#endif
+  orc_union16 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var49;
+#else
+  orc_union16 var49;
+#endif
+  orc_union16 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var51;
+#else
+  orc_union16 var51;
+#endif
+  orc_union16 var52;
+  orc_union16 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union16 var56;
+  orc_union16 var57;
+  orc_union16 var58;
+  orc_union16 var59;
+  orc_union32 var60;
+  orc_union32 var61;
+  orc_union16 var62;
+  orc_union16 var63;
+  orc_union16 var64;
+  orc_union16 var65;
+  orc_union32 var66;
+  orc_union32 var67;
+  orc_union16 var68;
+  orc_union16 var69;
+  orc_union16 var70;
+  orc_union16 var71;
+  orc_union32 var72;
+  orc_union32 var73;
+  orc_union16 var74;
+  orc_union16 var75;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+  /* 1: loadpw */
+  var36.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 3: loadpw */
+  var37.i = p1;
+  /* 7: loadpw */
+  var38.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 12: loadpw */
+  var41.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 14: loadpw */
+  var42.i = p2;
+  /* 18: loadpw */
+  var43.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 22: loadpw */
+  var45.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 24: loadpw */
+  var46.i = p3;
+  /* 28: loadpw */
+  var47.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 32: loadpw */
+  var49.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 34: loadpw */
+  var50.i = p4;
+  /* 38: loadpw */
+  var51.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 2: xorw */
+    var53.i = var35.i ^ var36.i;
+    /* 4: mulswl */
+    var54.i = var53.i * var37.i;
+    /* 5: shrsl */
+    var55.i = var54.i >> 11;
+    /* 6: convssslw */
+    var56.i = ORC_CLAMP_SW (var55.i);
+    /* 8: xorw */
+    var57.i = var56.i ^ var38.i;
+    /* 9: loadw */
+    var39 = ptr0[i];
+    /* 10: addusw */
+    var58.i = ORC_CLAMP_UW ((orc_uint16) var39.i + (orc_uint16) var57.i);
+    /* 11: loadw */
+    var40 = ptr5[i];
+    /* 13: xorw */
+    var59.i = var40.i ^ var41.i;
+    /* 15: mulswl */
+    var60.i = var59.i * var42.i;
+    /* 16: shrsl */
+    var61.i = var60.i >> 11;
+    /* 17: convssslw */
+    var62.i = ORC_CLAMP_SW (var61.i);
+    /* 19: xorw */
+    var63.i = var62.i ^ var43.i;
+    /* 20: addusw */
+    var64.i = ORC_CLAMP_UW ((orc_uint16) var58.i + (orc_uint16) var63.i);
+    /* 21: loadw */
+    var44 = ptr6[i];
+    /* 23: xorw */
+    var65.i = var44.i ^ var45.i;
+    /* 25: mulswl */
+    var66.i = var65.i * var46.i;
+    /* 26: shrsl */
+    var67.i = var66.i >> 11;
+    /* 27: convssslw */
+    var68.i = ORC_CLAMP_SW (var67.i);
+    /* 29: xorw */
+    var69.i = var68.i ^ var47.i;
+    /* 30: addusw */
+    var70.i = ORC_CLAMP_UW ((orc_uint16) var64.i + (orc_uint16) var69.i);
+    /* 31: loadw */
+    var48 = ptr7[i];
+    /* 33: xorw */
+    var71.i = var48.i ^ var49.i;
+    /* 35: mulswl */
+    var72.i = var71.i * var50.i;
+    /* 36: shrsl */
+    var73.i = var72.i >> 11;
+    /* 37: convssslw */
+    var74.i = ORC_CLAMP_SW (var73.i);
+    /* 39: xorw */
+    var75.i = var74.i ^ var51.i;
+    /* 40: addusw */
+    var52.i = ORC_CLAMP_UW ((orc_uint16) var70.i + (orc_uint16) var75.i);
+    /* 41: storew */
+    ptr0[i] = var52;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_u16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var36;
+#else
+  orc_union16 var36;
+#endif
+  orc_union16 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var38;
+#else
+  orc_union16 var38;
+#endif
+  orc_union16 var39;
+  orc_union16 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var41;
+#else
+  orc_union16 var41;
+#endif
+  orc_union16 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var43;
+#else
+  orc_union16 var43;
+#endif
+  orc_union16 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var45;
+#else
+  orc_union16 var45;
+#endif
+  orc_union16 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var47;
+#else
+  orc_union16 var47;
+#endif
+  orc_union16 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var49;
+#else
+  orc_union16 var49;
+#endif
+  orc_union16 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var51;
+#else
+  orc_union16 var51;
+#endif
+  orc_union16 var52;
+  orc_union16 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union16 var56;
+  orc_union16 var57;
+  orc_union16 var58;
+  orc_union16 var59;
+  orc_union32 var60;
+  orc_union32 var61;
+  orc_union16 var62;
+  orc_union16 var63;
+  orc_union16 var64;
+  orc_union16 var65;
+  orc_union32 var66;
+  orc_union32 var67;
+  orc_union16 var68;
+  orc_union16 var69;
+  orc_union16 var70;
+  orc_union16 var71;
+  orc_union32 var72;
+  orc_union32 var73;
+  orc_union16 var74;
+  orc_union16 var75;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+  /* 1: loadpw */
+  var36.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 3: loadpw */
+  var37.i = ex->params[24];
+  /* 7: loadpw */
+  var38.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 12: loadpw */
+  var41.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 14: loadpw */
+  var42.i = ex->params[25];
+  /* 18: loadpw */
+  var43.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 22: loadpw */
+  var45.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 24: loadpw */
+  var46.i = ex->params[26];
+  /* 28: loadpw */
+  var47.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 32: loadpw */
+  var49.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+  /* 34: loadpw */
+  var50.i = ex->params[27];
+  /* 38: loadpw */
+  var51.i = (int) 0x00008000;   /* 32768 or 1.61895e-319f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 2: xorw */
+    var53.i = var35.i ^ var36.i;
+    /* 4: mulswl */
+    var54.i = var53.i * var37.i;
+    /* 5: shrsl */
+    var55.i = var54.i >> 11;
+    /* 6: convssslw */
+    var56.i = ORC_CLAMP_SW (var55.i);
+    /* 8: xorw */
+    var57.i = var56.i ^ var38.i;
+    /* 9: loadw */
+    var39 = ptr0[i];
+    /* 10: addusw */
+    var58.i = ORC_CLAMP_UW ((orc_uint16) var39.i + (orc_uint16) var57.i);
+    /* 11: loadw */
+    var40 = ptr5[i];
+    /* 13: xorw */
+    var59.i = var40.i ^ var41.i;
+    /* 15: mulswl */
+    var60.i = var59.i * var42.i;
+    /* 16: shrsl */
+    var61.i = var60.i >> 11;
+    /* 17: convssslw */
+    var62.i = ORC_CLAMP_SW (var61.i);
+    /* 19: xorw */
+    var63.i = var62.i ^ var43.i;
+    /* 20: addusw */
+    var64.i = ORC_CLAMP_UW ((orc_uint16) var58.i + (orc_uint16) var63.i);
+    /* 21: loadw */
+    var44 = ptr6[i];
+    /* 23: xorw */
+    var65.i = var44.i ^ var45.i;
+    /* 25: mulswl */
+    var66.i = var65.i * var46.i;
+    /* 26: shrsl */
+    var67.i = var66.i >> 11;
+    /* 27: convssslw */
+    var68.i = ORC_CLAMP_SW (var67.i);
+    /* 29: xorw */
+    var69.i = var68.i ^ var47.i;
+    /* 30: addusw */
+    var70.i = ORC_CLAMP_UW ((orc_uint16) var64.i + (orc_uint16) var69.i);
+    /* 31: loadw */
+    var48 = ptr7[i];
+    /* 33: xorw */
+    var71.i = var48.i ^ var49.i;
+    /* 35: mulswl */
+    var72.i = var71.i * var50.i;
+    /* 36: shrsl */
+    var73.i = var72.i >> 11;
+    /* 37: convssslw */
+    var74.i = ORC_CLAMP_SW (var73.i);
+    /* 39: xorw */
+    var75.i = var74.i ^ var51.i;
+    /* 40: addusw */
+    var52.i = ORC_CLAMP_UW ((orc_uint16) var70.i + (orc_uint16) var75.i);
+    /* 41: storew */
+    ptr0[i] = var52;
+  }
+
+}
+
+void
+adder_orc_add_volume4_u16 (guint16 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2,
+    const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 117, 49, 54, 11, 2, 2, 12,
+        2, 2, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 2, 0, 128, 0,
+        0, 14, 4, 11, 0, 0, 0, 16, 2, 16, 2, 16, 2, 16, 2, 20,
+        4, 20, 2, 20, 2, 101, 33, 4, 16, 176, 32, 33, 24, 125, 32, 32,
+        17, 165, 33, 32, 101, 33, 33, 16, 72, 34, 0, 33, 101, 33, 5, 16,
+        176, 32, 33, 25, 125, 32, 32, 17, 165, 33, 32, 101, 33, 33, 16, 72,
+        34, 34, 33, 101, 33, 6, 16, 176, 32, 33, 26, 125, 32, 32, 17, 165,
+        33, 32, 101, 33, 33, 16, 72, 34, 34, 33, 101, 33, 7, 16, 176, 32,
+        33, 27, 125, 32, 32, 17, 165, 33, 32, 101, 33, 33, 16, 72, 0, 34,
+        33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_u16");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 2, 0x00008000, "c1");
+      orc_program_add_constant (p, 4, 0x0000000b, "c2");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_s16 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_s16 (gint16 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union16 var55;
+  orc_union16 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union16 var59;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+  /* 1: loadpw */
+  var36.i = p1;
+  /* 8: loadpw */
+  var39.i = p2;
+  /* 14: loadpw */
+  var41.i = p3;
+  /* 20: loadpw */
+  var43.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 2: mulswl */
+    var45.i = var35.i * var36.i;
+    /* 3: shrsl */
+    var46.i = var45.i >> 11;
+    /* 4: convssslw */
+    var47.i = ORC_CLAMP_SW (var46.i);
+    /* 5: loadw */
+    var37 = ptr0[i];
+    /* 6: addssw */
+    var48.i = ORC_CLAMP_SW (var37.i + var47.i);
+    /* 7: loadw */
+    var38 = ptr5[i];
+    /* 9: mulswl */
+    var49.i = var38.i * var39.i;
+    /* 10: shrsl */
+    var50.i = var49.i >> 11;
+    /* 11: convssslw */
+    var51.i = ORC_CLAMP_SW (var50.i);
+    /* 12: addssw */
+    var52.i = ORC_CLAMP_SW (var48.i + var51.i);
+    /* 13: loadw */
+    var40 = ptr6[i];
+    /* 15: mulswl */
+    var53.i = var40.i * var41.i;
+    /* 16: shrsl */
+    var54.i = var53.i >> 11;
+    /* 17: convssslw */
+    var55.i = ORC_CLAMP_SW (var54.i);
+    /* 18: addssw */
+    var56.i = ORC_CLAMP_SW (var52.i + var55.i);
+    /* 19: loadw */
+    var42 = ptr7[i];
+    /* 21: mulswl */
+    var57.i = var42.i * var43.i;
+    /* 22: shrsl */
+    var58.i = var57.i >> 11;
+    /* 23: convssslw */
+    var59.i = ORC_CLAMP_SW (var58.i);
+    /* 24: addssw */
+    var44.i = ORC_CLAMP_SW (var56.i + var59.i);
+    /* 25: storew */
+    ptr0[i] = var44;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_s16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union16 var55;
+  orc_union16 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union16 var59;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+  /* 1: loadpw */
+  var36.i = ex->params[24];
+  /* 8: loadpw */
+  var39.i = ex->params[25];
+  /* 14: loadpw */
+  var41.i = ex->params[26];
+  /* 20: loadpw */
+  var43.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr4[i];
+    /* 2: mulswl */
+    var45.i = var35.i * var36.i;
+    /* 3: shrsl */
+    var46.i = var45.i >> 11;
+    /* 4: convssslw */
+    var47.i = ORC_CLAMP_SW (var46.i);
+    /* 5: loadw */
+    var37 = ptr0[i];
+    /* 6: addssw */
+    var48.i = ORC_CLAMP_SW (var37.i + var47.i);
+    /* 7: loadw */
+    var38 = ptr5[i];
+    /* 9: mulswl */
+    var49.i = var38.i * var39.i;
+    /* 10: shrsl */
+    var50.i = var49.i >> 11;
+    /* 11: convssslw */
+    var51.i = ORC_CLAMP_SW (var50.i);
+    /* 12: addssw */
+    var52.i = ORC_CLAMP_SW (var48.i + var51.i);
+    /* 13: loadw */
+    var40 = ptr6[i];
+    /* 15: mulswl */
+    var53.i = var40.i * var41.i;
+    /* 16: shrsl */
+    var54.i = var53.i >> 11;
+    /* 17: convssslw */
+    var55.i = ORC_CLAMP_SW (var54.i);
+    /* 18: addssw */
+    var56.i = ORC_CLAMP_SW (var52.i + var55.i);
+    /* 19: loadw */
+    var42 = ptr7[i];
+    /* 21: mulswl */
+    var57.i = var42.i * var43.i;
+    /* 22: shrsl */
+    var58.i = var57.i >> 11;
+    /* 23: convssslw */
+    var59.i = ORC_CLAMP_SW (var58.i);
+    /* 24: addssw */
+    var44.i = ORC_CLAMP_SW (var56.i + var59.i);
+    /* 25: storew */
+    ptr0[i] = var44;
+  }
+
+}
+
+void
+adder_orc_add_volume4_s16 (gint16 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 115, 49, 54, 11, 2, 2, 12,
+        2, 2, 12, 2, 2, 12, 2, 2, 12, 2, 2, 14, 4, 11, 0, 0,
+        0, 16, 2, 16, 2, 16, 2, 16, 2, 20, 4, 20, 2, 20, 2, 176,
+        32, 4, 24, 125, 32, 32, 16, 165, 33, 32, 71, 34, 0, 33, 176, 32,
+        5, 25, 125, 32, 32, 16, 165, 33, 32, 71, 34, 34, 33, 176, 32, 6,
+        26, 125, 32, 32, 16, 165, 33, 32, 71, 34, 34, 33, 176, 32, 7, 27,
+        125, 32, 32, 16, 165, 33, 32, 71, 0, 34, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_s16");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_constant (p, 4, 0x0000000b, "c1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssw", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssw", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_u32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_u32 (guint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2,
+    const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var36;
+#else
+  orc_union32 var36;
+#endif
+  orc_union32 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var38;
+#else
+  orc_union32 var38;
+#endif
+  orc_union32 var39;
+  orc_union32 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var41;
+#else
+  orc_union32 var41;
+#endif
+  orc_union32 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var43;
+#else
+  orc_union32 var43;
+#endif
+  orc_union32 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var45;
+#else
+  orc_union32 var45;
+#endif
+  orc_union32 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var47;
+#else
+  orc_union32 var47;
+#endif
+  orc_union32 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var49;
+#else
+  orc_union32 var49;
+#endif
+  orc_union32 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var51;
+#else
+  orc_union32 var51;
+#endif
+  orc_union32 var52;
+  orc_union32 var53;
+  orc_union64 var54;
+  orc_union64 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union64 var60;
+  orc_union64 var61;
+  orc_union32 var62;
+  orc_union32 var63;
+  orc_union32 var64;
+  orc_union32 var65;
+  orc_union64 var66;
+  orc_union64 var67;
+  orc_union32 var68;
+  orc_union32 var69;
+  orc_union32 var70;
+  orc_union32 var71;
+  orc_union64 var72;
+  orc_union64 var73;
+  orc_union32 var74;
+  orc_union32 var75;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+  ptr6 = (orc_union32 *) s3;
+  ptr7 = (orc_union32 *) s4;
+
+  /* 1: loadpl */
+  var36.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 3: loadpl */
+  var37.i = p1;
+  /* 7: loadpl */
+  var38.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 12: loadpl */
+  var41.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 14: loadpl */
+  var42.i = p2;
+  /* 18: loadpl */
+  var43.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 22: loadpl */
+  var45.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 24: loadpl */
+  var46.i = p3;
+  /* 28: loadpl */
+  var47.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 32: loadpl */
+  var49.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 34: loadpl */
+  var50.i = p4;
+  /* 38: loadpl */
+  var51.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var35 = ptr4[i];
+    /* 2: xorl */
+    var53.i = var35.i ^ var36.i;
+    /* 4: mulslq */
+    var54.i = ((orc_int64) var53.i) * ((orc_int64) var37.i);
+    /* 5: shrsq */
+    var55.i = var54.i >> 27;
+    /* 6: convsssql */
+    var56.i = ORC_CLAMP_SL (var55.i);
+    /* 8: xorl */
+    var57.i = var56.i ^ var38.i;
+    /* 9: loadl */
+    var39 = ptr0[i];
+    /* 10: addusl */
+    var58.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var39.i +
+        (orc_int64) (orc_uint32) var57.i);
+    /* 11: loadl */
+    var40 = ptr5[i];
+    /* 13: xorl */
+    var59.i = var40.i ^ var41.i;
+    /* 15: mulslq */
+    var60.i = ((orc_int64) var59.i) * ((orc_int64) var42.i);
+    /* 16: shrsq */
+    var61.i = var60.i >> 27;
+    /* 17: convsssql */
+    var62.i = ORC_CLAMP_SL (var61.i);
+    /* 19: xorl */
+    var63.i = var62.i ^ var43.i;
+    /* 20: addusl */
+    var64.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var58.i +
+        (orc_int64) (orc_uint32) var63.i);
+    /* 21: loadl */
+    var44 = ptr6[i];
+    /* 23: xorl */
+    var65.i = var44.i ^ var45.i;
+    /* 25: mulslq */
+    var66.i = ((orc_int64) var65.i) * ((orc_int64) var46.i);
+    /* 26: shrsq */
+    var67.i = var66.i >> 27;
+    /* 27: convsssql */
+    var68.i = ORC_CLAMP_SL (var67.i);
+    /* 29: xorl */
+    var69.i = var68.i ^ var47.i;
+    /* 30: addusl */
+    var70.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var64.i +
+        (orc_int64) (orc_uint32) var69.i);
+    /* 31: loadl */
+    var48 = ptr7[i];
+    /* 33: xorl */
+    var71.i = var48.i ^ var49.i;
+    /* 35: mulslq */
+    var72.i = ((orc_int64) var71.i) * ((orc_int64) var50.i);
+    /* 36: shrsq */
+    var73.i = var72.i >> 27;
+    /* 37: convsssql */
+    var74.i = ORC_CLAMP_SL (var73.i);
+    /* 39: xorl */
+    var75.i = var74.i ^ var51.i;
+    /* 40: addusl */
+    var52.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var70.i +
+        (orc_int64) (orc_uint32) var75.i);
+    /* 41: storel */
+    ptr0[i] = var52;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_u32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var35;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var36;
+#else
+  orc_union32 var36;
+#endif
+  orc_union32 var37;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var38;
+#else
+  orc_union32 var38;
+#endif
+  orc_union32 var39;
+  orc_union32 var40;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var41;
+#else
+  orc_union32 var41;
+#endif
+  orc_union32 var42;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var43;
+#else
+  orc_union32 var43;
+#endif
+  orc_union32 var44;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var45;
+#else
+  orc_union32 var45;
+#endif
+  orc_union32 var46;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var47;
+#else
+  orc_union32 var47;
+#endif
+  orc_union32 var48;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var49;
+#else
+  orc_union32 var49;
+#endif
+  orc_union32 var50;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var51;
+#else
+  orc_union32 var51;
+#endif
+  orc_union32 var52;
+  orc_union32 var53;
+  orc_union64 var54;
+  orc_union64 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union64 var60;
+  orc_union64 var61;
+  orc_union32 var62;
+  orc_union32 var63;
+  orc_union32 var64;
+  orc_union32 var65;
+  orc_union64 var66;
+  orc_union64 var67;
+  orc_union32 var68;
+  orc_union32 var69;
+  orc_union32 var70;
+  orc_union32 var71;
+  orc_union64 var72;
+  orc_union64 var73;
+  orc_union32 var74;
+  orc_union32 var75;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+  ptr6 = (orc_union32 *) ex->arrays[6];
+  ptr7 = (orc_union32 *) ex->arrays[7];
+
+  /* 1: loadpl */
+  var36.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 3: loadpl */
+  var37.i = ex->params[24];
+  /* 7: loadpl */
+  var38.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 12: loadpl */
+  var41.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 14: loadpl */
+  var42.i = ex->params[25];
+  /* 18: loadpl */
+  var43.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 22: loadpl */
+  var45.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 24: loadpl */
+  var46.i = ex->params[26];
+  /* 28: loadpl */
+  var47.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 32: loadpl */
+  var49.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+  /* 34: loadpl */
+  var50.i = ex->params[27];
+  /* 38: loadpl */
+  var51.i = (int) 0x80000000;   /* -2147483648 or 1.061e-314f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var35 = ptr4[i];
+    /* 2: xorl */
+    var53.i = var35.i ^ var36.i;
+    /* 4: mulslq */
+    var54.i = ((orc_int64) var53.i) * ((orc_int64) var37.i);
+    /* 5: shrsq */
+    var55.i = var54.i >> 27;
+    /* 6: convsssql */
+    var56.i = ORC_CLAMP_SL (var55.i);
+    /* 8: xorl */
+    var57.i = var56.i ^ var38.i;
+    /* 9: loadl */
+    var39 = ptr0[i];
+    /* 10: addusl */
+    var58.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var39.i +
+        (orc_int64) (orc_uint32) var57.i);
+    /* 11: loadl */
+    var40 = ptr5[i];
+    /* 13: xorl */
+    var59.i = var40.i ^ var41.i;
+    /* 15: mulslq */
+    var60.i = ((orc_int64) var59.i) * ((orc_int64) var42.i);
+    /* 16: shrsq */
+    var61.i = var60.i >> 27;
+    /* 17: convsssql */
+    var62.i = ORC_CLAMP_SL (var61.i);
+    /* 19: xorl */
+    var63.i = var62.i ^ var43.i;
+    /* 20: addusl */
+    var64.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var58.i +
+        (orc_int64) (orc_uint32) var63.i);
+    /* 21: loadl */
+    var44 = ptr6[i];
+    /* 23: xorl */
+    var65.i = var44.i ^ var45.i;
+    /* 25: mulslq */
+    var66.i = ((orc_int64) var65.i) * ((orc_int64) var46.i);
+    /* 26: shrsq */
+    var67.i = var66.i >> 27;
+    /* 27: convsssql */
+    var68.i = ORC_CLAMP_SL (var67.i);
+    /* 29: xorl */
+    var69.i = var68.i ^ var47.i;
+    /* 30: addusl */
+    var70.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var64.i +
+        (orc_int64) (orc_uint32) var69.i);
+    /* 31: loadl */
+    var48 = ptr7[i];
+    /* 33: xorl */
+    var71.i = var48.i ^ var49.i;
+    /* 35: mulslq */
+    var72.i = ((orc_int64) var71.i) * ((orc_int64) var50.i);
+    /* 36: shrsq */
+    var73.i = var72.i >> 27;
+    /* 37: convsssql */
+    var74.i = ORC_CLAMP_SL (var73.i);
+    /* 39: xorl */
+    var75.i = var74.i ^ var51.i;
+    /* 40: addusl */
+    var52.i =
+        ORC_CLAMP_UL ((orc_int64) (orc_uint32) var70.i +
+        (orc_int64) (orc_uint32) var75.i);
+    /* 41: storel */
+    ptr0[i] = var52;
+  }
+
+}
+
+void
+adder_orc_add_volume4_u32 (guint32 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2,
+    const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 117, 51, 50, 11, 4, 4, 12,
+        4, 4, 12, 4, 4, 12, 4, 4, 12, 4, 4, 14, 4, 0, 0, 0,
+        128, 14, 4, 27, 0, 0, 0, 16, 4, 16, 4, 16, 4, 16, 4, 20,
+        8, 20, 4, 20, 4, 132, 33, 4, 16, 178, 32, 33, 24, 147, 32, 32,
+        17, 170, 33, 32, 132, 33, 33, 16, 105, 34, 0, 33, 132, 33, 5, 16,
+        178, 32, 33, 25, 147, 32, 32, 17, 170, 33, 32, 132, 33, 33, 16, 105,
+        34, 34, 33, 132, 33, 6, 16, 178, 32, 33, 26, 147, 32, 32, 17, 170,
+        33, 32, 132, 33, 33, 16, 105, 34, 34, 33, 132, 33, 7, 16, 178, 32,
+        33, 27, 147, 32, 32, 17, 170, 33, 32, 132, 33, 33, 16, 105, 0, 34,
+        33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_u32");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_u32);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_constant (p, 4, 0x80000000, "c1");
+      orc_program_add_constant (p, 4, 0x0000001b, "c2");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_parameter (p, 4, "p3");
+      orc_program_add_parameter (p, 4, "p4");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusl", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "xorl", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addusl", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_s32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_s32 (gint32 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union64 var57;
+  orc_union64 var58;
+  orc_union32 var59;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+  ptr6 = (orc_union32 *) s3;
+  ptr7 = (orc_union32 *) s4;
+
+  /* 1: loadpl */
+  var36.i = p1;
+  /* 8: loadpl */
+  var39.i = p2;
+  /* 14: loadpl */
+  var41.i = p3;
+  /* 20: loadpl */
+  var43.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var35 = ptr4[i];
+    /* 2: mulslq */
+    var45.i = ((orc_int64) var35.i) * ((orc_int64) var36.i);
+    /* 3: shrsq */
+    var46.i = var45.i >> 27;
+    /* 4: convsssql */
+    var47.i = ORC_CLAMP_SL (var46.i);
+    /* 5: loadl */
+    var37 = ptr0[i];
+    /* 6: addssl */
+    var48.i = ORC_CLAMP_SL ((orc_int64) var37.i + (orc_int64) var47.i);
+    /* 7: loadl */
+    var38 = ptr5[i];
+    /* 9: mulslq */
+    var49.i = ((orc_int64) var38.i) * ((orc_int64) var39.i);
+    /* 10: shrsq */
+    var50.i = var49.i >> 27;
+    /* 11: convsssql */
+    var51.i = ORC_CLAMP_SL (var50.i);
+    /* 12: addssl */
+    var52.i = ORC_CLAMP_SL ((orc_int64) var48.i + (orc_int64) var51.i);
+    /* 13: loadl */
+    var40 = ptr6[i];
+    /* 15: mulslq */
+    var53.i = ((orc_int64) var40.i) * ((orc_int64) var41.i);
+    /* 16: shrsq */
+    var54.i = var53.i >> 27;
+    /* 17: convsssql */
+    var55.i = ORC_CLAMP_SL (var54.i);
+    /* 18: addssl */
+    var56.i = ORC_CLAMP_SL ((orc_int64) var52.i + (orc_int64) var55.i);
+    /* 19: loadl */
+    var42 = ptr7[i];
+    /* 21: mulslq */
+    var57.i = ((orc_int64) var42.i) * ((orc_int64) var43.i);
+    /* 22: shrsq */
+    var58.i = var57.i >> 27;
+    /* 23: convsssql */
+    var59.i = ORC_CLAMP_SL (var58.i);
+    /* 24: addssl */
+    var44.i = ORC_CLAMP_SL ((orc_int64) var56.i + (orc_int64) var59.i);
+    /* 25: storel */
+    ptr0[i] = var44;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_s32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union64 var57;
+  orc_union64 var58;
+  orc_union32 var59;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+  ptr6 = (orc_union32 *) ex->arrays[6];
+  ptr7 = (orc_union32 *) ex->arrays[7];
+
+  /* 1: loadpl */
+  var36.i = ex->params[24];
+  /* 8: loadpl */
+  var39.i = ex->params[25];
+  /* 14: loadpl */
+  var41.i = ex->params[26];
+  /* 20: loadpl */
+  var43.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var35 = ptr4[i];
+    /* 2: mulslq */
+    var45.i = ((orc_int64) var35.i) * ((orc_int64) var36.i);
+    /* 3: shrsq */
+    var46.i = var45.i >> 27;
+    /* 4: convsssql */
+    var47.i = ORC_CLAMP_SL (var46.i);
+    /* 5: loadl */
+    var37 = ptr0[i];
+    /* 6: addssl */
+    var48.i = ORC_CLAMP_SL ((orc_int64) var37.i + (orc_int64) var47.i);
+    /* 7: loadl */
+    var38 = ptr5[i];
+    /* 9: mulslq */
+    var49.i = ((orc_int64) var38.i) * ((orc_int64) var39.i);
+    /* 10: shrsq */
+    var50.i = var49.i >> 27;
+    /* 11: convsssql */
+    var51.i = ORC_CLAMP_SL (var50.i);
+    /* 12: addssl */
+    var52.i = ORC_CLAMP_SL ((orc_int64) var48.i + (orc_int64) var51.i);
+    /* 13: loadl */
+    var40 = ptr6[i];
+    /* 15: mulslq */
+    var53.i = ((orc_int64) var40.i) * ((orc_int64) var41.i);
+    /* 16: shrsq */
+    var54.i = var53.i >> 27;
+    /* 17: convsssql */
+    var55.i = ORC_CLAMP_SL (var54.i);
+    /* 18: addssl */
+    var56.i = ORC_CLAMP_SL ((orc_int64) var52.i + (orc_int64) var55.i);
+    /* 19: loadl */
+    var42 = ptr7[i];
+    /* 21: mulslq */
+    var57.i = ((orc_int64) var42.i) * ((orc_int64) var43.i);
+    /* 22: shrsq */
+    var58.i = var57.i >> 27;
+    /* 23: convsssql */
+    var59.i = ORC_CLAMP_SL (var58.i);
+    /* 24: addssl */
+    var44.i = ORC_CLAMP_SL ((orc_int64) var56.i + (orc_int64) var59.i);
+    /* 25: storel */
+    ptr0[i] = var44;
+  }
+
+}
+
+void
+adder_orc_add_volume4_s32 (gint32 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 115, 51, 50, 11, 4, 4, 12,
+        4, 4, 12, 4, 4, 12, 4, 4, 12, 4, 4, 14, 4, 27, 0, 0,
+        0, 16, 4, 16, 4, 16, 4, 16, 4, 20, 8, 20, 4, 20, 4, 178,
+        32, 4, 24, 147, 32, 32, 16, 170, 33, 32, 104, 34, 0, 33, 178, 32,
+        5, 25, 147, 32, 32, 16, 170, 33, 32, 104, 34, 34, 33, 178, 32, 6,
+        26, 147, 32, 32, 16, 170, 33, 32, 104, 34, 34, 33, 178, 32, 7, 27,
+        147, 32, 32, 16, 170, 33, 32, 104, 0, 34, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_s32");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_s32);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_constant (p, 4, 0x0000001b, "c1");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_parameter (p, 4, "p3");
+      orc_program_add_parameter (p, 4, "p4");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssl", 0, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulslq", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsq", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsssql", 0, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addssl", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_f32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_f32 (float *ORC_RESTRICT d1, const float *ORC_RESTRICT s1,
+    const float *ORC_RESTRICT s2, const float *ORC_RESTRICT s3,
+    const float *ORC_RESTRICT s4, float p1, float p2, float p3, float p4, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+  ptr6 = (orc_union32 *) s3;
+  ptr7 = (orc_union32 *) s4;
+
+  /* 1: loadpl */
+  var35.f = p1;
+  /* 6: loadpl */
+  var38.f = p2;
+  /* 10: loadpl */
+  var40.f = p3;
+  /* 14: loadpl */
+  var42.f = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 2: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var34.i);
+      _src2.i = ORC_DENORMAL (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var44.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 3: loadl */
+    var36 = ptr0[i];
+    /* 4: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var36.i);
+      _src2.i = ORC_DENORMAL (var44.i);
+      _dest1.f = _src1.f + _src2.f;
+      var45.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var37 = ptr5[i];
+    /* 7: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var37.i);
+      _src2.i = ORC_DENORMAL (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 8: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var45.i);
+      _src2.i = ORC_DENORMAL (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 9: loadl */
+    var39 = ptr6[i];
+    /* 11: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var39.i);
+      _src2.i = ORC_DENORMAL (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 12: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var47.i);
+      _src2.i = ORC_DENORMAL (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 13: loadl */
+    var41 = ptr7[i];
+    /* 15: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var41.i);
+      _src2.i = ORC_DENORMAL (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 16: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var49.i);
+      _src2.i = ORC_DENORMAL (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 17: storel */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_f32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+  ptr6 = (orc_union32 *) ex->arrays[6];
+  ptr7 = (orc_union32 *) ex->arrays[7];
+
+  /* 1: loadpl */
+  var35.i = ex->params[24];
+  /* 6: loadpl */
+  var38.i = ex->params[25];
+  /* 10: loadpl */
+  var40.i = ex->params[26];
+  /* 14: loadpl */
+  var42.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 2: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var34.i);
+      _src2.i = ORC_DENORMAL (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var44.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 3: loadl */
+    var36 = ptr0[i];
+    /* 4: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var36.i);
+      _src2.i = ORC_DENORMAL (var44.i);
+      _dest1.f = _src1.f + _src2.f;
+      var45.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var37 = ptr5[i];
+    /* 7: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var37.i);
+      _src2.i = ORC_DENORMAL (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 8: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var45.i);
+      _src2.i = ORC_DENORMAL (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 9: loadl */
+    var39 = ptr6[i];
+    /* 11: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var39.i);
+      _src2.i = ORC_DENORMAL (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 12: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var47.i);
+      _src2.i = ORC_DENORMAL (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 13: loadl */
+    var41 = ptr7[i];
+    /* 15: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var41.i);
+      _src2.i = ORC_DENORMAL (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 16: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var49.i);
+      _src2.i = ORC_DENORMAL (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 17: storel */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+adder_orc_add_volume4_f32 (float *ORC_RESTRICT d1, const float *ORC_RESTRICT s1,
+    const float *ORC_RESTRICT s2, const float *ORC_RESTRICT s3,
+    const float *ORC_RESTRICT s4, float p1, float p2, float p3, float p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 102, 51, 50, 11, 4, 4, 12,
+        4, 4, 12, 4, 4, 12, 4, 4, 12, 4, 4, 17, 4, 17, 4, 17,
+        4, 17, 4, 20, 4, 20, 4, 202, 32, 4, 24, 200, 33, 0, 32, 202,
+        32, 5, 25, 200, 33, 33, 32, 202, 32, 6, 26, 200, 33, 33, 32, 202,
+        32, 7, 27, 200, 0, 33, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_f32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_f32");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_f32);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_parameter_float (p, 4, "p1");
+      orc_program_add_parameter_float (p, 4, "p2");
+      orc_program_add_parameter_float (p, 4, "p3");
+      orc_program_add_parameter_float (p, 4, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  {
+    orc_union32 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p2;
+    ex->params[ORC_VAR_P2] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p3;
+    ex->params[ORC_VAR_P3] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p4;
+    ex->params[ORC_VAR_P4] = tmp.i;
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_add_volume4_f64 */
+#ifdef DISABLE_ORC
+void
+adder_orc_add_volume4_f64 (double *ORC_RESTRICT d1,
+    const double *ORC_RESTRICT s1, const double *ORC_RESTRICT s2,
+    const double *ORC_RESTRICT s3, const double *ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  const orc_union64 *ORC_RESTRICT ptr5;
+  const orc_union64 *ORC_RESTRICT ptr6;
+  const orc_union64 *ORC_RESTRICT ptr7;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+  orc_union64 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+  orc_union64 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union64 var47;
+  orc_union64 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union64 *) s1;
+  ptr5 = (orc_union64 *) s2;
+  ptr6 = (orc_union64 *) s3;
+  ptr7 = (orc_union64 *) s4;
+
+  /* 1: loadpq */
+  var35.f = p1;
+  /* 6: loadpq */
+  var38.f = p2;
+  /* 10: loadpq */
+  var40.f = p3;
+  /* 14: loadpq */
+  var42.f = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 2: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var34.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var44.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 3: loadq */
+    var36 = ptr0[i];
+    /* 4: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var44.i);
+      _dest1.f = _src1.f + _src2.f;
+      var45.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 5: loadq */
+    var37 = ptr5[i];
+    /* 7: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var37.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 8: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var45.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 9: loadq */
+    var39 = ptr6[i];
+    /* 11: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var39.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 12: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var47.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 13: loadq */
+    var41 = ptr7[i];
+    /* 15: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var41.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 16: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var49.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 17: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_add_volume4_f64 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  const orc_union64 *ORC_RESTRICT ptr5;
+  const orc_union64 *ORC_RESTRICT ptr6;
+  const orc_union64 *ORC_RESTRICT ptr7;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+  orc_union64 var39;
+  orc_union64 var40;
+  orc_union64 var41;
+  orc_union64 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union64 var47;
+  orc_union64 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+  ptr5 = (orc_union64 *) ex->arrays[5];
+  ptr6 = (orc_union64 *) ex->arrays[6];
+  ptr7 = (orc_union64 *) ex->arrays[7];
+
+  /* 1: loadpq */
+  var35.i =
+      (ex->params[24] & 0xffffffff) | ((orc_uint64) (ex->params[24 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 6: loadpq */
+  var38.i =
+      (ex->params[25] & 0xffffffff) | ((orc_uint64) (ex->params[25 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 10: loadpq */
+  var40.i =
+      (ex->params[26] & 0xffffffff) | ((orc_uint64) (ex->params[26 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 14: loadpq */
+  var42.i =
+      (ex->params[27] & 0xffffffff) | ((orc_uint64) (ex->params[27 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var34 = ptr4[i];
+    /* 2: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var34.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var44.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 3: loadq */
+    var36 = ptr0[i];
+    /* 4: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var44.i);
+      _dest1.f = _src1.f + _src2.f;
+      var45.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 5: loadq */
+    var37 = ptr5[i];
+    /* 7: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var37.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 8: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var45.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 9: loadq */
+    var39 = ptr6[i];
+    /* 11: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var39.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 12: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var47.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 13: loadq */
+    var41 = ptr7[i];
+    /* 15: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var41.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 16: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var49.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 17: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+adder_orc_add_volume4_f64 (double *ORC_RESTRICT d1,
+    const double *ORC_RESTRICT s1, const double *ORC_RESTRICT s2,
+    const double *ORC_RESTRICT s3, const double *ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 100, 100,
+        95, 118, 111, 108, 117, 109, 101, 52, 95, 102, 54, 52, 11, 8, 8, 12,
+        8, 8, 12, 8, 8, 12, 8, 8, 12, 8, 8, 18, 8, 18, 8, 18,
+        8, 18, 8, 20, 8, 20, 8, 214, 32, 4, 24, 212, 33, 0, 32, 214,
+        32, 5, 25, 212, 33, 33, 32, 214, 32, 6, 26, 212, 33, 33, 32, 214,
+        32, 7, 27, 212, 0, 33, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_f64);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_add_volume4_f64");
+      orc_program_set_backup_function (p, _backup_adder_orc_add_volume4_f64);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_source (p, 8, "s2");
+      orc_program_add_source (p, 8, "s3");
+      orc_program_add_source (p, 8, "s4");
+      orc_program_add_parameter_double (p, 8, "p1");
+      orc_program_add_parameter_double (p, 8, "p2");
+      orc_program_add_parameter_double (p, 8, "p3");
+      orc_program_add_parameter_double (p, 8, "p4");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 8, "t2");
+
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  {
+    orc_union64 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.x2[0];
+    ex->params[ORC_VAR_T1] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p2;
+    ex->params[ORC_VAR_P2] = tmp.x2[0];
+    ex->params[ORC_VAR_T2] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p3;
+    ex->params[ORC_VAR_P3] = tmp.x2[0];
+    ex->params[ORC_VAR_T3] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p4;
+    ex->params[ORC_VAR_P4] = tmp.x2[0];
+    ex->params[ORC_VAR_T4] = tmp.x2[1];
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_accumulate_s16 */
+#ifdef DISABLE_ORC
+void
+adder_orc_accumulate_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, float p1, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union16 *) s1;
+
+  /* 3: loadpl */
+  var34.f = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: convswl */
+    var37.i = var33.i;
+    /* 2: convlf */
+    var38.f = var37.i;
+    /* 4: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var38.i);
+      _src2.i = ORC_DENORMAL (var34.i);
+      _dest1.f = _src1.f * _src2.f;
+      var39.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var35 = ptr0[i];
+    /* 6: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var35.i);
+      _src2.i = ORC_DENORMAL (var39.i);
+      _dest1.f = _src1.f + _src2.f;
+      var36.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 7: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_accumulate_s16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+
+  /* 3: loadpl */
+  var34.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: convswl */
+    var37.i = var33.i;
+    /* 2: convlf */
+    var38.f = var37.i;
+    /* 4: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var38.i);
+      _src2.i = ORC_DENORMAL (var34.i);
+      _dest1.f = _src1.f * _src2.f;
+      var39.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var35 = ptr0[i];
+    /* 6: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var35.i);
+      _src2.i = ORC_DENORMAL (var39.i);
+      _dest1.f = _src1.f + _src2.f;
+      var36.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 7: storel */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+adder_orc_accumulate_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, float p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 99, 99,
+        117, 109, 117, 108, 97, 116, 101, 95, 115, 49, 54, 11, 4, 4, 12, 2,
+        2, 17, 4, 20, 4, 153, 32, 4, 211, 32, 32, 202, 32, 32, 24, 200,
+        0, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate_s16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_accumulate_s16");
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate_s16);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_parameter_float (p, 4, "p1");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "convswl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convlf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_D1, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  {
+    orc_union32 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.i;
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_accumulate4_s16 */
+#ifdef DISABLE_ORC
+void
+adder_orc_accumulate4_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, float p1,
+    float p2, float p3, float p4, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+  ptr7 = (orc_union16 *) s4;
+
+  /* 3: loadpl */
+  var35.f = p1;
+  /* 10: loadpl */
+  var38.f = p2;
+  /* 16: loadpl */
+  var40.f = p3;
+  /* 22: loadpl */
+  var42.f = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 1: convswl */
+    var44.i = var34.i;
+    /* 2: convlf */
+    var45.f = var44.i;
+    /* 4: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var45.i);
+      _src2.i = ORC_DENORMAL (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var36 = ptr0[i];
+    /* 6: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var36.i);
+      _src2.i = ORC_DENORMAL (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 7: loadw */
+    var37 = ptr5[i];
+    /* 8: convswl */
+    var48.i = var37.i;
+    /* 9: convlf */
+    var49.f = var48.i;
+    /* 11: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var49.i);
+      _src2.i = ORC_DENORMAL (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 12: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var47.i);
+      _src2.i = ORC_DENORMAL (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var51.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 13: loadw */
+    var39 = ptr6[i];
+    /* 14: convswl */
+    var52.i = var39.i;
+    /* 15: convlf */
+    var53.f = var52.i;
+    /* 17: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var53.i);
+      _src2.i = ORC_DENORMAL (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var54.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 18: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var51.i);
+      _src2.i = ORC_DENORMAL (var54.i);
+      _dest1.f = _src1.f + _src2.f;
+      var55.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 19: loadw */
+    var41 = ptr7[i];
+    /* 20: convswl */
+    var56.i = var41.i;
+    /* 21: convlf */
+    var57.f = var56.i;
+    /* 23: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var57.i);
+      _src2.i = ORC_DENORMAL (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var58.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 24: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var55.i);
+      _src2.i = ORC_DENORMAL (var58.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 25: storel */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_accumulate4_s16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  const orc_union16 *ORC_RESTRICT ptr7;
+  orc_union16 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+  ptr7 = (orc_union16 *) ex->arrays[7];
+
+  /* 3: loadpl */
+  var35.i = ex->params[24];
+  /* 10: loadpl */
+  var38.i = ex->params[25];
+  /* 16: loadpl */
+  var40.i = ex->params[26];
+  /* 22: loadpl */
+  var42.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 1: convswl */
+    var44.i = var34.i;
+    /* 2: convlf */
+    var45.f = var44.i;
+    /* 4: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var45.i);
+      _src2.i = ORC_DENORMAL (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var46.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 5: loadl */
+    var36 = ptr0[i];
+    /* 6: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var36.i);
+      _src2.i = ORC_DENORMAL (var46.i);
+      _dest1.f = _src1.f + _src2.f;
+      var47.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 7: loadw */
+    var37 = ptr5[i];
+    /* 8: convswl */
+    var48.i = var37.i;
+    /* 9: convlf */
+    var49.f = var48.i;
+    /* 11: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var49.i);
+      _src2.i = ORC_DENORMAL (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var50.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 12: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var47.i);
+      _src2.i = ORC_DENORMAL (var50.i);
+      _dest1.f = _src1.f + _src2.f;
+      var51.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 13: loadw */
+    var39 = ptr6[i];
+    /* 14: convswl */
+    var52.i = var39.i;
+    /* 15: convlf */
+    var53.f = var52.i;
+    /* 17: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var53.i);
+      _src2.i = ORC_DENORMAL (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var54.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 18: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var51.i);
+      _src2.i = ORC_DENORMAL (var54.i);
+      _dest1.f = _src1.f + _src2.f;
+      var55.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 19: loadw */
+    var41 = ptr7[i];
+    /* 20: convswl */
+    var56.i = var41.i;
+    /* 21: convlf */
+    var57.f = var56.i;
+    /* 23: mulf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var57.i);
+      _src2.i = ORC_DENORMAL (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var58.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 24: addf */
+    {
+      orc_union32 _src1;
+      orc_union32 _src2;
+      orc_union32 _dest1;
+      _src1.i = ORC_DENORMAL (var55.i);
+      _src2.i = ORC_DENORMAL (var58.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL (_dest1.i);
+    }
+    /* 25: storel */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+adder_orc_accumulate4_s16 (float *ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, float p1,
+    float p2, float p3, float p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 99, 99,
+        117, 109, 117, 108, 97, 116, 101, 52, 95, 115, 49, 54, 11, 4, 4, 12,
+        2, 2, 12, 2, 2, 12, 2, 2, 12, 2, 2, 17, 4, 17, 4, 17,
+        4, 17, 4, 20, 4, 20, 4, 153, 32, 4, 211, 32, 32, 202, 32, 32,
+        24, 200, 33, 0, 32, 153, 32, 5, 211, 32, 32, 202, 32, 32, 25, 200,
+        33, 33, 32, 153, 32, 6, 211, 32, 32, 202, 32, 32, 26, 200, 33, 33,
+        32, 153, 32, 7, 211, 32, 32, 202, 32, 32, 27, 200, 0, 33, 32, 2,
+        0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate4_s16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_accumulate4_s16");
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate4_s16);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_source (p, 2, "s4");
+      orc_program_add_parameter_float (p, 4, "p1");
+      orc_program_add_parameter_float (p, 4, "p2");
+      orc_program_add_parameter_float (p, 4, "p3");
+      orc_program_add_parameter_float (p, 4, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "convswl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convlf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convswl", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convlf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convswl", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convlf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convswl", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convlf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulf", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addf", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  {
+    orc_union32 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p2;
+    ex->params[ORC_VAR_P2] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p3;
+    ex->params[ORC_VAR_P3] = tmp.i;
+  }
+  {
+    orc_union32 tmp;
+    tmp.f = p4;
+    ex->params[ORC_VAR_P4] = tmp.i;
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_clamp_s16 */
+#ifdef DISABLE_ORC
+void
+adder_orc_clamp_s16 (gint16 * ORC_RESTRICT d1, const float *ORC_RESTRICT s1,
+    int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union32 var35;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: convfl */
+    {
+      int tmp;
+      tmp = (int) var33.f;
+      if (tmp == 0x80000000 && !(var33.i & 0x80000000))
+        tmp = 0x7fffffff;
+      var35.i = tmp;
+    }
+    /* 2: convssslw */
+    var34.i = ORC_CLAMP_SW (var35.i);
+    /* 3: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_clamp_s16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union32 var35;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: convfl */
+    {
+      int tmp;
+      tmp = (int) var33.f;
+      if (tmp == 0x80000000 && !(var33.i & 0x80000000))
+        tmp = 0x7fffffff;
+      var35.i = tmp;
+    }
+    /* 2: convssslw */
+    var34.i = ORC_CLAMP_SW (var35.i);
+    /* 3: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+adder_orc_clamp_s16 (gint16 * ORC_RESTRICT d1, const float *ORC_RESTRICT s1,
+    int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 19, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 99, 108, 97,
+        109, 112, 95, 115, 49, 54, 11, 2, 2, 12, 4, 4, 20, 4, 210, 32,
+        4, 165, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_clamp_s16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_clamp_s16");
+      orc_program_set_backup_function (p, _backup_adder_orc_clamp_s16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "convfl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_accumulate_s32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_accumulate_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, double p1, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+  /* 2: loadpq */
+  var34.f = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: convld */
+    var37.f = var33.i;
+    /* 3: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var37.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var34.i);
+      _dest1.f = _src1.f * _src2.f;
+      var38.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 4: loadq */
+    var35 = ptr0[i];
+    /* 5: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f + _src2.f;
+      var36.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 6: storeq */
+    ptr0[i] = var36;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_accumulate_s32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+  orc_union64 var38;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+  /* 2: loadpq */
+  var34.i =
+      (ex->params[24] & 0xffffffff) | ((orc_uint64) (ex->params[24 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: convld */
+    var37.f = var33.i;
+    /* 3: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var37.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var34.i);
+      _dest1.f = _src1.f * _src2.f;
+      var38.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 4: loadq */
+    var35 = ptr0[i];
+    /* 5: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f + _src2.f;
+      var36.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 6: storeq */
+    ptr0[i] = var36;
+  }
+
+}
+
+void
+adder_orc_accumulate_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, double p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 24, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 99, 99,
+        117, 109, 117, 108, 97, 116, 101, 95, 115, 51, 50, 11, 8, 8, 12, 4,
+        4, 18, 8, 20, 8, 223, 32, 4, 214, 32, 32, 24, 212, 0, 0, 32,
+        2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate_s32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_accumulate_s32");
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate_s32);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_parameter_double (p, 8, "p1");
+      orc_program_add_temporary (p, 8, "t1");
+
+      orc_program_append_2 (p, "convld", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_D1, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  {
+    orc_union64 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.x2[0];
+    ex->params[ORC_VAR_T1] = tmp.x2[1];
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_accumulate4_s32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_accumulate4_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union64 var47;
+  orc_union64 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+  orc_union64 var51;
+  orc_union64 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union32 *) s2;
+  ptr6 = (orc_union32 *) s3;
+  ptr7 = (orc_union32 *) s4;
+
+  /* 2: loadpq */
+  var35.f = p1;
+  /* 8: loadpq */
+  var38.f = p2;
+  /* 13: loadpq */
+  var40.f = p3;
+  /* 18: loadpq */
+  var42.f = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 1: convld */
+    var44.f = var34.i;
+    /* 3: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var44.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var45.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 4: loadq */
+    var36 = ptr0[i];
+    /* 5: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var45.i);
+      _dest1.f = _src1.f + _src2.f;
+      var46.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 6: loadl */
+    var37 = ptr5[i];
+    /* 7: convld */
+    var47.f = var37.i;
+    /* 9: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var47.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 10: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var46.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 11: loadl */
+    var39 = ptr6[i];
+    /* 12: convld */
+    var50.f = var39.i;
+    /* 14: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var50.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var51.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 15: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var49.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var51.i);
+      _dest1.f = _src1.f + _src2.f;
+      var52.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 16: loadl */
+    var41 = ptr7[i];
+    /* 17: convld */
+    var53.f = var41.i;
+    /* 19: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var53.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var54.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 20: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var52.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var54.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 21: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_accumulate4_s32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union32 *ORC_RESTRICT ptr5;
+  const orc_union32 *ORC_RESTRICT ptr6;
+  const orc_union32 *ORC_RESTRICT ptr7;
+  orc_union32 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union32 var37;
+  orc_union64 var38;
+  orc_union32 var39;
+  orc_union64 var40;
+  orc_union32 var41;
+  orc_union64 var42;
+  orc_union64 var43;
+  orc_union64 var44;
+  orc_union64 var45;
+  orc_union64 var46;
+  orc_union64 var47;
+  orc_union64 var48;
+  orc_union64 var49;
+  orc_union64 var50;
+  orc_union64 var51;
+  orc_union64 var52;
+  orc_union64 var53;
+  orc_union64 var54;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union32 *) ex->arrays[5];
+  ptr6 = (orc_union32 *) ex->arrays[6];
+  ptr7 = (orc_union32 *) ex->arrays[7];
+
+  /* 2: loadpq */
+  var35.i =
+      (ex->params[24] & 0xffffffff) | ((orc_uint64) (ex->params[24 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 8: loadpq */
+  var38.i =
+      (ex->params[25] & 0xffffffff) | ((orc_uint64) (ex->params[25 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 13: loadpq */
+  var40.i =
+      (ex->params[26] & 0xffffffff) | ((orc_uint64) (ex->params[26 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 18: loadpq */
+  var42.i =
+      (ex->params[27] & 0xffffffff) | ((orc_uint64) (ex->params[27 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr4[i];
+    /* 1: convld */
+    var44.f = var34.i;
+    /* 3: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var44.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _dest1.f = _src1.f * _src2.f;
+      var45.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 4: loadq */
+    var36 = ptr0[i];
+    /* 5: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var45.i);
+      _dest1.f = _src1.f + _src2.f;
+      var46.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 6: loadl */
+    var37 = ptr5[i];
+    /* 7: convld */
+    var47.f = var37.i;
+    /* 9: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var47.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var38.i);
+      _dest1.f = _src1.f * _src2.f;
+      var48.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 10: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var46.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var48.i);
+      _dest1.f = _src1.f + _src2.f;
+      var49.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 11: loadl */
+    var39 = ptr6[i];
+    /* 12: convld */
+    var50.f = var39.i;
+    /* 14: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var50.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var40.i);
+      _dest1.f = _src1.f * _src2.f;
+      var51.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 15: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var49.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var51.i);
+      _dest1.f = _src1.f + _src2.f;
+      var52.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 16: loadl */
+    var41 = ptr7[i];
+    /* 17: convld */
+    var53.f = var41.i;
+    /* 19: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var53.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var42.i);
+      _dest1.f = _src1.f * _src2.f;
+      var54.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 20: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var52.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var54.i);
+      _dest1.f = _src1.f + _src2.f;
+      var43.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 21: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+adder_orc_accumulate4_s32 (double *ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2,
+    const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, double p1,
+    double p2, double p3, double p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 25, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 97, 99, 99,
+        117, 109, 117, 108, 97, 116, 101, 52, 95, 115, 51, 50, 11, 8, 8, 12,
+        4, 4, 12, 4, 4, 12, 4, 4, 12, 4, 4, 18, 8, 18, 8, 18,
+        8, 18, 8, 20, 8, 20, 8, 223, 32, 4, 214, 32, 32, 24, 212, 33,
+        0, 32, 223, 32, 5, 214, 32, 32, 25, 212, 33, 33, 32, 223, 32, 6,
+        214, 32, 32, 26, 212, 33, 33, 32, 223, 32, 7, 214, 32, 32, 27, 212,
+        0, 33, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate4_s32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_accumulate4_s32");
+      orc_program_set_backup_function (p, _backup_adder_orc_accumulate4_s32);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_parameter_double (p, 8, "p1");
+      orc_program_add_parameter_double (p, 8, "p2");
+      orc_program_add_parameter_double (p, 8, "p3");
+      orc_program_add_parameter_double (p, 8, "p4");
+      orc_program_add_temporary (p, 8, "t1");
+      orc_program_add_temporary (p, 8, "t2");
+
+      orc_program_append_2 (p, "convld", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convld", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convld", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convld", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  {
+    orc_union64 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.x2[0];
+    ex->params[ORC_VAR_T1] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p2;
+    ex->params[ORC_VAR_P2] = tmp.x2[0];
+    ex->params[ORC_VAR_T2] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p3;
+    ex->params[ORC_VAR_P3] = tmp.x2[0];
+    ex->params[ORC_VAR_T3] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p4;
+    ex->params[ORC_VAR_P4] = tmp.x2[0];
+    ex->params[ORC_VAR_T4] = tmp.x2[1];
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* adder_orc_clamp_s32 */
+#ifdef DISABLE_ORC
+void
+adder_orc_clamp_s32 (gint32 * ORC_RESTRICT d1, const double *ORC_RESTRICT s1,
+    int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 1: convdl */
+    {
+      int tmp;
+      tmp = var32.f;
+      if (tmp == 0x80000000 && !(var32.i & ORC_UINT64_C (0x8000000000000000)))
+        tmp = 0x7fffffff;
+      var33.i = tmp;
+    }
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_adder_orc_clamp_s32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union32 var33;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 1: convdl */
+    {
+      int tmp;
+      tmp = var32.f;
+      if (tmp == 0x80000000 && !(var32.i & ORC_UINT64_C (0x8000000000000000)))
+        tmp = 0x7fffffff;
+      var33.i = tmp;
+    }
+    /* 2: storel */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+adder_orc_clamp_s32 (gint32 * ORC_RESTRICT d1, const double *ORC_RESTRICT s1,
+    int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 19, 97, 100, 100, 101, 114, 95, 111, 114, 99, 95, 99, 108, 97,
+        109, 112, 95, 115, 51, 50, 11, 4, 4, 12, 8, 8, 222, 0, 4, 2,
+        0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_adder_orc_clamp_s32);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "adder_orc_clamp_s32");
+      orc_program_set_backup_function (p, _backup_adder_orc_clamp_s32);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 8, "s1");
+
+      orc_program_append_2 (p, "convdl", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
@@ -104,6 +104,20 @@ void adder_orc_add_volume_u32 (guint32 * ORC_RESTRICT d1, const guint32 * ORC_RE
 void adder_orc_add_volume_s32 (gint32 * ORC_RESTRICT d1, const gint32 * ORC_RESTRICT s1, int p1, int n);
 void adder_orc_add_volume_f32 (float * ORC_RESTRICT d1, const float * ORC_RESTRICT s1, float p1, int n);
 void adder_orc_add_volume_f64 (double * ORC_RESTRICT d1, const double * ORC_RESTRICT s1, double p1, int n);
+void adder_orc_add_volume4_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s8 (gint8 * ORC_RESTRICT d1, const gint8 * ORC_RESTRICT s1, const gint8 * ORC_RESTRICT s2, const gint8 * ORC_RESTRICT s3, const gint8 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, const guint16 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s16 (gint16 * ORC_RESTRICT d1, const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_u32 (guint32 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_s32 (gint32 * ORC_RESTRICT d1, const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2, const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void adder_orc_add_volume4_f32 (float * ORC_RESTRICT d1, const float * ORC_RESTRICT s1, const float * ORC_RESTRICT s2, const float * ORC_RESTRICT s3, const float * ORC_RESTRICT s4, float p1, float p2, float p3, float p4, int n);
+void adder_orc_add_volume4_f64 (double * ORC_RESTRICT d1, const double * ORC_RESTRICT s1, const double * ORC_RESTRICT s2, const double * ORC_RESTRICT s3, const double * ORC_RESTRICT s4, double p1, double p2, double p3, double p4, int n);
+void adder_orc_accumulate_s16 (float * ORC_RESTRICT d1, const gint16 * ORC_RESTRICT s1, float p1, int n);
+void adder_orc_accumulate4_s16 (float * ORC_RESTRICT d1, const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, const gint16 * ORC_RESTRICT s3, const gint16 * ORC_RESTRICT s4, float p1, float p2, float p3, float p4, int n);
+void adder_orc_clamp_s16 (gint16 * ORC_RESTRICT d1, const float * ORC_RESTRICT s1, int n);
+void adder_orc_accumulate_s32 (double * ORC_RESTRICT d1, const gint32 * ORC_RESTRICT s1, double p1, int n);
+void adder_orc_accumulate4_s32 (double * ORC_RESTRICT d1, const gint32 * ORC_RESTRICT s1, const gint32 * ORC_RESTRICT s2, const gint32 * ORC_RESTRICT s3, const gint32 * ORC_RESTRICT s4, double p1, double p2, double p3, double p4, int n);
+void adder_orc_clamp_s32 (gint32 * ORC_RESTRICT d1, const double * ORC_RESTRICT s1, int n);
 
 #ifdef __cplusplus
 }
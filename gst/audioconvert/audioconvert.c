@@ -560,6 +560,108 @@ static AudioConvertPack pack_funcs[] = {
       !GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->out.finfo)) ||  \
      (ctx->ns != NOISE_SHAPING_NONE))
 
+/* float to float conversions don't lose precision when mixing in float, the
+ * only other possible conversion is then between endianness */
+#define FLOAT_INTERMEDIATE_FORMAT(ctx)                    \
+    (GST_AUDIO_FORMAT_INFO_IS_FLOAT (ctx->in.finfo) &&    \
+     GST_AUDIO_FORMAT_INFO_WIDTH (ctx->in.finfo) == 32 && \
+     GST_AUDIO_FORMAT_INFO_IS_FLOAT (ctx->out.finfo) &&   \
+     GST_AUDIO_FORMAT_INFO_WIDTH (ctx->out.finfo) == 32)
+
+/* 24 bit samples, copied as a whole */
+typedef struct
+{
+  guint8 b[3];
+} AudioConvertSample24;
+
+#define MAKE_INTERLEAVE_FUNC(name, type)                                \
+static void                                                             \
+audio_convert_interleave_##name (gpointer src, gpointer dst,            \
+    gint channels, gint samples)                                        \
+{                                                                       \
+  const type *s = src;                                                  \
+  type *d = dst;                                                        \
+  gint c, n;                                                            \
+                                                                        \
+  for (c = 0; c < channels; c++) {                                      \
+    const type *p = s + c * samples;                                    \
+                                                                        \
+    for (n = 0; n < samples; n++)                                       \
+      d[n * channels + c] = p[n];                                       \
+  }                                                                     \
+}                                                                       \
+                                                                        \
+static void                                                             \
+audio_convert_deinterleave_##name (gpointer src, gpointer dst,          \
+    gint channels, gint samples)                                        \
+{                                                                       \
+  const type *s = src;                                                  \
+  type *d = dst;                                                        \
+  gint c, n;                                                            \
+                                                                        \
+  for (c = 0; c < channels; c++) {                                      \
+    type *p = d + c * samples;                                          \
+                                                                        \
+    for (n = 0; n < samples; n++)                                       \
+      p[n] = s[n * channels + c];                                       \
+  }                                                                     \
+}
+
+MAKE_INTERLEAVE_FUNC (8, guint8)
+MAKE_INTERLEAVE_FUNC (16, guint16)
+MAKE_INTERLEAVE_FUNC (24, AudioConvertSample24)
+MAKE_INTERLEAVE_FUNC (32, guint32)
+MAKE_INTERLEAVE_FUNC (64, guint64)
+
+static void
+audio_convert_get_interleave_funcs (const GstAudioFormatInfo * finfo,
+    AudioConvertInterleave * interleave, AudioConvertInterleave * deinterleave)
+{
+  switch (GST_AUDIO_FORMAT_INFO_WIDTH (finfo)) {
+    case 8:
+      *interleave = audio_convert_interleave_8;
+      *deinterleave = audio_convert_deinterleave_8;
+      break;
+    case 16:
+      *interleave = audio_convert_interleave_16;
+      *deinterleave = audio_convert_deinterleave_16;
+      break;
+    case 24:
+      *interleave = audio_convert_interleave_24;
+      *deinterleave = audio_convert_deinterleave_24;
+      break;
+    case 32:
+      *interleave = audio_convert_interleave_32;
+      *deinterleave = audio_convert_deinterleave_32;
+      break;
+    case 64:
+      *interleave = audio_convert_interleave_64;
+      *deinterleave = audio_convert_deinterleave_64;
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+static gpointer
+audio_convert_ensure_buffer (gpointer * buf, gint * bufsize, gint size)
+{
+  if (size > *bufsize) {
+    *buf = g_realloc (*buf, size);
+    *bufsize = size;
+  }
+  return *buf;
+}
+
+/* swap the bytes of 32 bit floats, used to and from the float intermediate
+ * format */
+static void
+audio_convert_swap_float (gpointer src, gpointer dst, gint scale, gint count)
+{
+  audio_convert_orc_unpack_s32_swap (dst, src, 0, count);
+}
+
 static gint
 audio_convert_get_func_index (AudioConvertCtx * ctx,
     const GstAudioFormatInfo * fmt)
@@ -585,7 +687,9 @@ audio_convert_get_func_index (AudioConvertCtx * ctx,
 static inline gboolean
 check_default (AudioConvertCtx * ctx, const GstAudioFormatInfo * fmt)
 {
-  if (!DOUBLE_INTERMEDIATE_FORMAT (ctx)) {
+  if (FLOAT_INTERMEDIATE_FORMAT (ctx)) {
+    return GST_AUDIO_FORMAT_INFO_FORMAT (fmt) == GST_AUDIO_FORMAT_F32;
+  } else if (!DOUBLE_INTERMEDIATE_FORMAT (ctx)) {
     return GST_AUDIO_FORMAT_INFO_FORMAT (fmt) == GST_AUDIO_FORMAT_S32;
   } else {
     return GST_AUDIO_FORMAT_INFO_FORMAT (fmt) == GST_AUDIO_FORMAT_F64;
@@ -641,17 +745,27 @@ audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
 
   gst_channel_mix_setup_matrix (ctx);
 
-  idx_in = audio_convert_get_func_index (ctx, in->finfo);
-  ctx->unpack = unpack_funcs[idx_in];
+  if (FLOAT_INTERMEDIATE_FORMAT (ctx)) {
+    /* the only unpacking and packing left is swapping bytes, only used when
+     * the format is not the native endianness */
+    ctx->unpack = audio_convert_swap_float;
+    ctx->pack = audio_convert_swap_float;
+  } else {
+    idx_in = audio_convert_get_func_index (ctx, in->finfo);
+    ctx->unpack = unpack_funcs[idx_in];
 
-  idx_out = audio_convert_get_func_index (ctx, out->finfo);
-  ctx->pack = pack_funcs[idx_out];
+    idx_out = audio_convert_get_func_index (ctx, out->finfo);
+    ctx->pack = pack_funcs[idx_out];
 
-  GST_INFO ("func index in %d, out %d", idx_in, idx_out);
+    GST_INFO ("func index in %d, out %d", idx_in, idx_out);
+  }
 
-  /* if both formats are float/double or we use noise shaping use double as
-   * intermediate format and switch mixing */
-  if (!DOUBLE_INTERMEDIATE_FORMAT (ctx)) {
+  /* if both formats are float use float as intermediate format, if one of
+   * them is double or we use noise shaping use double and switch mixing */
+  if (FLOAT_INTERMEDIATE_FORMAT (ctx)) {
+    GST_INFO ("use float32 mixing");
+    ctx->channel_mix = (AudioConvertMix) gst_channel_mix_mix_float32;
+  } else if (!DOUBLE_INTERMEDIATE_FORMAT (ctx)) {
     GST_INFO ("use int mixing");
     ctx->channel_mix = (AudioConvertMix) gst_channel_mix_mix_int;
   } else {
@@ -679,6 +793,28 @@ audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
 
   gst_audio_quantize_setup (ctx);
 
+  ctx->interleave = NULL;
+  ctx->deinterleave = NULL;
+  if (GST_AUDIO_INFO_LAYOUT (in) == GST_AUDIO_LAYOUT_NON_INTERLEAVED &&
+      GST_AUDIO_INFO_LAYOUT (out) == GST_AUDIO_LAYOUT_NON_INTERLEAVED &&
+      ctx->mix_passthrough && ctx->ns == NOISE_SHAPING_NONE &&
+      ctx->dither != DITHER_TPDF_HF) {
+    /* every sample is converted on its own, the planes can be processed as
+     * they are */
+    GST_INFO ("converting non-interleaved samples in place");
+  } else {
+    AudioConvertInterleave unused;
+
+    if (GST_AUDIO_INFO_LAYOUT (in) == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+      audio_convert_get_interleave_funcs (in->finfo, &ctx->interleave,
+          &unused);
+    if (GST_AUDIO_INFO_LAYOUT (out) == GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+      audio_convert_get_interleave_funcs (out->finfo, &unused,
+          &ctx->deinterleave);
+    GST_INFO ("interleave %d, deinterleave %d", ctx->interleave != NULL,
+        ctx->deinterleave != NULL);
+  }
+
   return TRUE;
 
   /* ERRORS */
@@ -703,6 +839,15 @@ audio_convert_clean_context (AudioConvertCtx * ctx)
   ctx->tmpbuf = NULL;
   ctx->tmpbufsize = 0;
 
+  ctx->interleave = NULL;
+  ctx->deinterleave = NULL;
+  g_free (ctx->in_ibuf);
+  ctx->in_ibuf = NULL;
+  ctx->in_ibufsize = 0;
+  g_free (ctx->out_ibuf);
+  ctx->out_ibuf = NULL;
+  ctx->out_ibufsize = 0;
+
   return TRUE;
 }
 
@@ -720,8 +865,8 @@ audio_convert_get_sizes (AudioConvertCtx * ctx, gint samples, gint * srcsize,
   return TRUE;
 }
 
-gboolean
-audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
+static void
+audio_convert_convert_samples (AudioConvertCtx * ctx, gpointer src,
     gpointer dst, gint samples, gboolean src_writable)
 {
   guint insize, outsize, size;
@@ -729,14 +874,6 @@ audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
   guint intemp = 0, outtemp = 0, biggest;
   gint in_width, out_width;
 
-  g_return_val_if_fail (ctx != NULL, FALSE);
-  g_return_val_if_fail (src != NULL, FALSE);
-  g_return_val_if_fail (dst != NULL, FALSE);
-  g_return_val_if_fail (samples >= 0, FALSE);
-
-  if (samples == 0)
-    return TRUE;
-
   insize = ctx->in.bpf * samples;
   outsize = ctx->out.bpf * samples;
 
@@ -744,8 +881,12 @@ audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
   out_width = GST_AUDIO_FORMAT_INFO_WIDTH (ctx->out.finfo);
 
   /* find biggest temp buffer size */
-  size = (DOUBLE_INTERMEDIATE_FORMAT (ctx)) ? sizeof (gdouble)
-      : sizeof (gint32);
+  if (FLOAT_INTERMEDIATE_FORMAT (ctx))
+    size = sizeof (gfloat);
+  else if (DOUBLE_INTERMEDIATE_FORMAT (ctx))
+    size = sizeof (gdouble);
+  else
+    size = sizeof (gint32);
 
   if (!ctx->in_default)
     intemp = gst_util_uint64_scale (insize, size * 8, in_width);
@@ -806,6 +947,57 @@ audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
     /* pack default format into dst */
     ctx->pack (src, dst, ctx->out_scale, samples * ctx->out.channels);
   }
+}
+
+gboolean
+audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
+    gpointer dst, gint samples, gboolean src_writable)
+{
+  gboolean layout_only;
+  gpointer buf;
+
+  g_return_val_if_fail (ctx != NULL, FALSE);
+  g_return_val_if_fail (src != NULL, FALSE);
+  g_return_val_if_fail (dst != NULL, FALSE);
+  g_return_val_if_fail (samples >= 0, FALSE);
+
+  if (samples == 0)
+    return TRUE;
+
+  if (ctx->interleave == NULL && ctx->deinterleave == NULL) {
+    audio_convert_convert_samples (ctx, src, dst, samples, src_writable);
+    return TRUE;
+  }
+
+  /* when the samples themselves don't change we only convert the layout */
+  layout_only = ctx->in_default && ctx->mix_passthrough && ctx->out_default;
+
+  if (ctx->interleave) {
+    if (layout_only && !ctx->deinterleave)
+      buf = dst;
+    else
+      buf = audio_convert_ensure_buffer (&ctx->in_ibuf, &ctx->in_ibufsize,
+          ctx->in.bpf * samples);
+
+    ctx->interleave (src, buf, ctx->in.channels, samples);
+
+    /* the interleaved copy is ours to use as temp */
+    src = buf;
+    src_writable = TRUE;
+  }
+
+  if (ctx->deinterleave) {
+    if (layout_only) {
+      buf = src;
+    } else {
+      buf = audio_convert_ensure_buffer (&ctx->out_ibuf, &ctx->out_ibufsize,
+          ctx->out.bpf * samples);
+      audio_convert_convert_samples (ctx, src, buf, samples, src_writable);
+    }
+    ctx->deinterleave (buf, dst, ctx->out.channels, samples);
+  } else if (!layout_only) {
+    audio_convert_convert_samples (ctx, src, dst, samples, src_writable);
+  }
 
   return TRUE;
 }
@@ -65,6 +65,7 @@ typedef enum
 } GstAudioConvertNoiseShaping;
 
 typedef struct _AudioConvertCtx AudioConvertCtx;
+
 #if 0
 typedef struct _AudioConvertFmt AudioConvertFmt;
 
@@ -93,6 +94,8 @@ typedef void (*AudioConvertPack) (gpointer src, gpointer dst, gint scale,
     gint count);
 
 typedef void (*AudioConvertMix) (AudioConvertCtx *, gpointer, gpointer, gint);
+typedef void (*AudioConvertInterleave) (gpointer src, gpointer dst,
+    gint channels, gint samples);
 typedef void (*AudioConvertQuantize) (AudioConvertCtx * ctx, gpointer src,
     gpointer dst, gint count);
 
@@ -109,6 +112,12 @@ struct _AudioConvertCtx
   gfloat **matrix;
   /* temp storage for channelmix */
   gpointer tmp;
+  /* the same matrix as one block, m[out_channels][in_channels], and the
+   * kernels for the channel counts, NULL when there are none */
+  gfloat *mix_matrix;
+  AudioConvertMix mix_int_kernel;
+  AudioConvertMix mix_float_kernel;
+  AudioConvertMix mix_float32_kernel;
 
   gboolean in_default;
   gboolean mix_passthrough;
@@ -117,6 +126,16 @@ struct _AudioConvertCtx
   gpointer tmpbuf;
   gint tmpbufsize;
 
+  /* conversion from non-interleaved input and to non-interleaved output,
+   * NULL when the samples can be processed in their layout */
+  AudioConvertInterleave interleave;
+  AudioConvertInterleave deinterleave;
+  /* interleaved copies of the input and output */
+  gpointer in_ibuf;
+  gint in_ibufsize;
+  gpointer out_ibuf;
+  gint out_ibufsize;
+
   gint in_scale;
   gint out_scale;
 
@@ -128,8 +147,15 @@ struct _AudioConvertCtx
   GstAudioConvertNoiseShaping ns;
   /* last random number generated per channel for hifreq TPDF dither */
   gpointer last_random;
-  /* contains the past quantization errors, error[out_channels][count] */
+  /* contains the past quantization errors, error[count][out_channels] */
   gdouble *error_buf;
+  /* scratch space of the noise shaping filters, 2 * out_channels */
+  gdouble *error_tmp;
+  /* state of the dither noise generator and the dither noise of one
+   * buffer */
+  guint32 random_state;
+  gpointer dither_buf;
+  gint dither_buf_size;
 };
 
 gboolean audio_convert_prepare_context (AudioConvertCtx * ctx,
@@ -115,7 +115,7 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioConvert, gst_audio_convert,
 
 #define STATIC_CAPS \
 GST_STATIC_CAPS (GST_AUDIO_CAPS_MAKE (GST_AUDIO_FORMATS_ALL) \
-    ", layout = (string) interleaved")
+    ", layout = (string) { interleaved, non-interleaved }")
 
 static GstStaticPadTemplate gst_audio_convert_src_template =
 GST_STATIC_PAD_TEMPLATE ("src",
@@ -288,7 +288,7 @@ gst_audio_convert_caps_remove_format_info (GstCaps * caps, gboolean channels)
       continue;
 
     st = gst_structure_copy (st);
-    gst_structure_remove_field (st, "format");
+    gst_structure_remove_fields (st, "format", "layout", NULL);
 
     /* Only remove the channels and channel-mask for non-NONE layouts */
     if (gst_structure_get (st, "channel-mask", GST_TYPE_BITMASK, &channel_mask,
@@ -674,6 +674,25 @@ gst_audio_convert_fixate_channels (GstBaseTransform * base, GstStructure * ins,
 /* try to keep as many of the structure members the same by fixating the
  * possible ranges; this way we convert the least amount of things as possible
  */
+/* keep the layout of the input if possible to avoid (de)interleaving */
+static void
+gst_audio_convert_fixate_layout (GstBaseTransform * base, GstStructure * ins,
+    GstStructure * outs)
+{
+  const gchar *in_layout;
+
+  in_layout = gst_structure_get_string (ins, "layout");
+  if (in_layout == NULL)
+    return;
+
+  if (!gst_structure_has_field (outs, "layout")) {
+    gst_structure_set (outs, "layout", G_TYPE_STRING, in_layout, NULL);
+    return;
+  }
+
+  gst_structure_fixate_field_string (outs, "layout", in_layout);
+}
+
 static GstCaps *
 gst_audio_convert_fixate_caps (GstBaseTransform * base,
     GstPadDirection direction, GstCaps * caps, GstCaps * othercaps)
@@ -715,6 +734,7 @@ gst_audio_convert_fixate_caps (GstBaseTransform * base,
 
   gst_audio_convert_fixate_channels (base, ins, outs);
   gst_audio_convert_fixate_format (base, ins, outs);
+  gst_audio_convert_fixate_layout (base, ins, outs);
 
   /* fixate remaining */
   result = gst_caps_fixate (result);
@@ -37,11 +37,190 @@
 #include "audioconvert.h"
 #include "gstaudioquantize.h"
 
-#include "gstfastrandom.h"
-
 #define MAKE_QUANTIZE_FUNC_NAME(name)                                   \
 gst_audio_quantize_quantize_##name
 
+/* Dither noise generation.
+ *
+ * The noise for a whole buffer is generated before quantizing it, from a
+ * linear congruential generator that is seeded with a fixed value for every
+ * context. The numbers are drawn in the same order and mapped to the noise
+ * the same way as when they were drawn per sample, so the dithered output
+ * is reproducible and the same as before. */
+
+/* transform [0..2^32] -> [0..1] */
+#define RANDOM_DOUBLE_TRANSFORM 2.3283064365386962890625e-10
+
+static inline guint32
+gst_audio_quantize_random_uint32 (AudioConvertCtx * ctx)
+{
+  return (ctx->random_state = ctx->random_state * 1103515245 + 12345);
+}
+
+static inline gint32
+gst_audio_quantize_random_int32_range (AudioConvertCtx * ctx, gint32 start,
+    gint32 end)
+{
+  gint64 tmp = gst_audio_quantize_random_uint32 (ctx);
+
+  tmp = (tmp * (end - start)) / G_MAXUINT32 + start;
+
+  return (gint32) tmp;
+}
+
+static inline gdouble
+gst_audio_quantize_random_double (AudioConvertCtx * ctx)
+{
+  gdouble ret;
+
+  do {
+    ret = gst_audio_quantize_random_uint32 (ctx) * RANDOM_DOUBLE_TRANSFORM;
+    ret = (ret + gst_audio_quantize_random_uint32 (ctx))
+        * RANDOM_DOUBLE_TRANSFORM;
+  } while (ret >= 1.0);
+
+  return ret;
+}
+
+static inline gdouble
+gst_audio_quantize_random_double_range (AudioConvertCtx * ctx, gdouble start,
+    gdouble end)
+{
+  return gst_audio_quantize_random_double (ctx) * (end - start) + start;
+}
+
+static gpointer
+gst_audio_quantize_ensure_dither_buf (AudioConvertCtx * ctx, gint count,
+    gsize size)
+{
+  if (count > ctx->dither_buf_size) {
+    ctx->dither_buf = g_realloc (ctx->dither_buf, count * size);
+    ctx->dither_buf_size = count;
+  }
+  return ctx->dither_buf;
+}
+
+/* Dithering definitions
+ * See http://en.wikipedia.org/wiki/Dithering or
+ * http://www.cadenzarecording.com/Dither.html for explainations.
+ *
+ * For int as intermediate format we already add the rounding offset to the
+ * dither noise here to have only one overflow check instead of two. */
+
+/* Returns the dither noise for @samples samples of all channels */
+static gint32 *
+gst_audio_quantize_dither_int (AudioConvertCtx * ctx, gint samples)
+{
+  gint scale = ctx->out_scale;
+  gint channels = ctx->out.channels;
+  gint count = samples * channels;
+  gint32 bias = 1U << (scale - 1);
+  gint32 dither;
+  gint32 *noise;
+  gint i, chan_pos;
+
+  noise = gst_audio_quantize_ensure_dither_buf (ctx, count, sizeof (gint32));
+
+  switch (ctx->dither) {
+    case DITHER_RPDF:
+      dither = 1 << scale;
+      for (i = 0; i < count; i++)
+        noise[i] = gst_audio_quantize_random_int32_range (ctx, bias - dither,
+            bias + dither);
+      break;
+    case DITHER_TPDF:
+      dither = 1 << (scale - 1);
+      bias = bias >> 1;
+      for (i = 0; i < count; i++) {
+        noise[i] = gst_audio_quantize_random_int32_range (ctx, bias - dither,
+            bias + dither - 1);
+        noise[i] += gst_audio_quantize_random_int32_range (ctx, bias - dither,
+            bias + dither - 1);
+      }
+      break;
+    case DITHER_TPDF_HF:{
+      /* Like TPDF dither but the dither noise is oriented more to the
+       * higher frequencies */
+      gint32 *last_random = ctx->last_random;
+
+      dither = 1 << (scale - 1);
+      bias = bias >> 1;
+      for (i = 0; i < count; i += channels) {
+        for (chan_pos = 0; chan_pos < channels; chan_pos++) {
+          gint32 tmp_rand = gst_audio_quantize_random_int32_range (ctx,
+              bias - dither, bias + dither);
+
+          noise[i + chan_pos] = tmp_rand - last_random[chan_pos];
+          last_random[chan_pos] = tmp_rand;
+        }
+      }
+      break;
+    }
+    case DITHER_NONE:
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  return noise;
+}
+
+/* Returns the dither noise for @samples samples of all channels, or NULL
+ * when not dithering */
+static gdouble *
+gst_audio_quantize_dither_float (AudioConvertCtx * ctx, gint samples)
+{
+  gint scale = ctx->out_scale;
+  gint channels = ctx->out.channels;
+  gint count = samples * channels;
+  gdouble dither;
+  gdouble *noise;
+  gint i, chan_pos;
+
+  if (ctx->dither == DITHER_NONE)
+    return NULL;
+
+  noise = gst_audio_quantize_ensure_dither_buf (ctx, count, sizeof (gdouble));
+
+  switch (ctx->dither) {
+    case DITHER_RPDF:
+      dither = 1.0 / (1U << (32 - scale - 1));
+      for (i = 0; i < count; i++)
+        noise[i] = gst_audio_quantize_random_double_range (ctx, -dither,
+            dither);
+      break;
+    case DITHER_TPDF:
+      dither = 1.0 / (1U << (32 - scale));
+      for (i = 0; i < count; i++) {
+        noise[i] = gst_audio_quantize_random_double_range (ctx, -dither,
+            dither);
+        noise[i] += gst_audio_quantize_random_double_range (ctx, -dither,
+            dither);
+      }
+      break;
+    case DITHER_TPDF_HF:{
+      gdouble *last_random = ctx->last_random;
+
+      dither = 1.0 / (1U << (32 - scale));
+      for (i = 0; i < count; i += channels) {
+        for (chan_pos = 0; chan_pos < channels; chan_pos++) {
+          gdouble tmp_rand = gst_audio_quantize_random_double_range (ctx,
+              -dither, dither);
+
+          noise[i + chan_pos] = tmp_rand - last_random[chan_pos];
+          last_random[chan_pos] = tmp_rand;
+        }
+      }
+      break;
+    }
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  return noise;
+}
+
 /* Quantize functions for gint32 as intermediate format */
 
 #define MAKE_QUANTIZE_FUNC_I(name, DITHER_INIT_FUNC, ADD_DITHER_FUNC,   \
@@ -79,13 +258,40 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gint32 *src,      \
   }                                                                     \
 }
 
+/* Rounding functions for int as intermediate format, only used when
+ * not using dithering. With dithering we include this offset in our
+ * dither noise instead. */
+
+#define ROUND()                                                         \
+        if (tmp > 0 && G_MAXINT32 - tmp <= bias)                        \
+          tmp = G_MAXINT32;                                             \
+        else                                                            \
+          tmp += bias;
+
+#define NONE_FUNC()
+
+#define INIT_DITHER_I()                                                 \
+  gint32 rand;                                                          \
+  gint32 *noise = gst_audio_quantize_dither_int (ctx, count);           \
+  (void) bias;
+
+#define ADD_DITHER_I()                                                  \
+        rand = *noise++;                                                \
+        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
+                tmp = G_MAXINT32;                                       \
+        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
+                tmp = G_MININT32;                                       \
+        else                                                            \
+                tmp += rand;
 
 /* Quantize functions for gdouble as intermediate format with
- * int as target */
+ * int as target, applying noise shaping.
+ *
+ * The noise shaping filters run on all channels of a sample at once, the
+ * error history is stored as errors[taps][channels] so that the channels
+ * of every tap are next to each other. */
 
-#define MAKE_QUANTIZE_FUNC_F(name, DITHER_INIT_FUNC, NS_INIT_FUNC,      \
-                             ADD_NS_FUNC, ADD_DITHER_FUNC,              \
-                             UPDATE_ERROR_FUNC)                         \
+#define MAKE_QUANTIZE_FUNC_F(name, ADD_NS_FUNC, UPDATE_ERROR_FUNC)      \
 static void                                                             \
 MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
                                 gdouble *dst, gint count)               \
@@ -97,19 +303,24 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
                                                                         \
   if (scale > 0) {                                                      \
     gdouble tmp;                                                        \
-    DITHER_INIT_FUNC()                                                  \
-    NS_INIT_FUNC()                                                      \
+    gdouble *errors = ctx->error_buf;                                   \
+    gdouble *orig = ctx->error_tmp;                                     \
+    gdouble *noise = gst_audio_quantize_dither_float (ctx, count);      \
                                                                         \
     for (;count;count--) {                                              \
+      ADD_NS_FUNC()                                                     \
+      if (noise) {                                                      \
+        for (chan_pos = 0; chan_pos < channels; chan_pos++)             \
+          dst[chan_pos] += noise[chan_pos];                             \
+        noise += channels;                                              \
+      }                                                                 \
       for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
-        tmp = *src++;                                                   \
-        ADD_NS_FUNC()                                                   \
-        ADD_DITHER_FUNC()                                               \
-        tmp = floor(tmp * factor + 0.5);                                \
-        *dst = CLAMP (tmp, -factor - 1, factor);                        \
-        UPDATE_ERROR_FUNC()                                             \
-        dst++;                                                          \
+        tmp = floor(dst[chan_pos] * factor + 0.5);                      \
+        dst[chan_pos] = CLAMP (tmp, -factor - 1, factor);               \
       }                                                                 \
+      UPDATE_ERROR_FUNC()                                               \
+      src += channels;                                                  \
+      dst += channels;                                                  \
     }                                                                   \
   } else {                                                              \
     for (;count;count--) {                                              \
@@ -121,102 +332,6 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
   }                                                                     \
 }
 
-/* Rounding functions for int as intermediate format, only used when
- * not using dithering. With dithering we include this offset in our
- * dither noise instead. */
-
-#define ROUND()                                                         \
-        if (tmp > 0 && G_MAXINT32 - tmp <= bias)                        \
-          tmp = G_MAXINT32;                                             \
-        else                                                            \
-          tmp += bias;
-
-
-#define NONE_FUNC()
-
-/* Dithering definitions
- * See http://en.wikipedia.org/wiki/Dithering or
- * http://www.cadenzarecording.com/Dither.html for explainations.
- *
- * We already add the rounding offset to the dither noise here
- * to have only one overflow check instead of two. */
-
-#define INIT_DITHER_RPDF_I()                                            \
-  gint32 rand;                                                          \
-  gint32 dither = (1<<(scale));
-
-#define ADD_DITHER_RPDF_I()                                             \
-        rand = gst_fast_random_int32_range (bias - dither,              \
-	    bias + dither);                                             \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
-
-#define INIT_DITHER_RPDF_F()                                            \
-  gdouble dither = 1.0/(1U<<(32 - scale - 1));
-
-#define ADD_DITHER_RPDF_F()                                             \
-        tmp += gst_fast_random_double_range (- dither, dither);
-
-#define INIT_DITHER_TPDF_I()                                            \
-  gint32 rand;                                                          \
-  gint32 dither = (1<<(scale - 1));                                     \
-  bias = bias >> 1;
-
-#define ADD_DITHER_TPDF_I()                                             \
-        rand = gst_fast_random_int32_range (bias - dither,              \
-                   bias + dither - 1)                                   \
-               + gst_fast_random_int32_range (bias - dither,            \
-                   bias + dither - 1);                                  \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
-
-#define INIT_DITHER_TPDF_F()                                            \
-  gdouble dither = 1.0/(1U<<(32 - scale));
-
-#define ADD_DITHER_TPDF_F()                                             \
-        tmp += gst_fast_random_double_range (- dither, dither)          \
-               + gst_fast_random_double_range (- dither, dither);
-
-#define INIT_DITHER_TPDF_HF_I()                                         \
-  gint32 rand;                                                          \
-  gint32 dither = (1<<(scale-1));                                       \
-  gint32 *last_random = (gint32 *) ctx->last_random, tmp_rand;          \
-  bias = bias >> 1;
-
-#define ADD_DITHER_TPDF_HF_I()                                          \
-        tmp_rand = gst_fast_random_int32_range (bias - dither,          \
-                       bias + dither);                                  \
-        rand = tmp_rand - last_random[chan_pos];                        \
-        last_random[chan_pos] = tmp_rand;                               \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
-
-/* Like TPDF dither but the dither noise is oriented more to the
- * higher frequencies */
-
-#define INIT_DITHER_TPDF_HF_F()                                         \
-  gdouble rand;                                                         \
-  gdouble dither = 1.0/(1U<<(32 - scale));                              \
-  gdouble *last_random = (gdouble *) ctx->last_random, tmp_rand;
-
-#define ADD_DITHER_TPDF_HF_F()                                          \
-        tmp_rand = gst_fast_random_double_range (- dither, dither);     \
-        rand = tmp_rand - last_random[chan_pos];                        \
-        last_random[chan_pos] = tmp_rand;                               \
-        tmp += rand;
-
 /* Noise shaping definitions.
  * See http://en.wikipedia.org/wiki/Noise_shaping for explanations. */
 
@@ -224,33 +339,55 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
 /* Simple error feedback: Just accumulate the dithering and quantization
  * error and remove it from each sample. */
 
-#define INIT_NS_ERROR_FEEDBACK()                                        \
-  gdouble orig;                                                         \
-  gdouble *errors = ctx->error_buf;
-
 #define ADD_NS_ERROR_FEEDBACK()                                         \
-        orig = tmp;                                                     \
-        tmp -= errors[chan_pos];
+      for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
+        orig[chan_pos] = src[chan_pos];                                 \
+        dst[chan_pos] = src[chan_pos] - errors[chan_pos];               \
+      }
 
 #define UPDATE_ERROR_ERROR_FEEDBACK()                                   \
-        errors[chan_pos] += (*dst)/factor - orig;
+      for (chan_pos = 0; chan_pos < channels; chan_pos++)               \
+        errors[chan_pos] += dst[chan_pos] / factor - orig[chan_pos];
+
+/* Filter the error history with the coefficients of the noise shaping
+ * filter and remove the result from each sample */
+
+#define INIT_NS_FILTER()                                                \
+      gdouble *cur_error = ctx->error_tmp + channels;                   \
+      gint j;
+
+#define ADD_NS_FILTER(coeffs, taps)                                     \
+      for (chan_pos = 0; chan_pos < channels; chan_pos++)               \
+        cur_error[chan_pos] = 0.0;                                      \
+      for (j = 0; j < taps; j++) {                                      \
+        for (chan_pos = 0; chan_pos < channels; chan_pos++)             \
+          cur_error[chan_pos] += errors[j * channels + chan_pos]        \
+              * coeffs[j];                                              \
+      }                                                                 \
+      for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
+        orig[chan_pos] = src[chan_pos] - cur_error[chan_pos];           \
+        dst[chan_pos] = orig[chan_pos];                                 \
+      }
+
+#define UPDATE_ERROR_FILTER(taps)                                       \
+      memmove (errors + channels, errors,                               \
+          (taps - 1) * channels * sizeof (gdouble));                    \
+      for (chan_pos = 0; chan_pos < channels; chan_pos++)               \
+        errors[chan_pos] = dst[chan_pos] / factor - orig[chan_pos];
 
 /* Same as error feedback but also add 1/2 of the previous error value.
  * This moves the noise a bit more into the higher frequencies. */
 
-#define INIT_NS_SIMPLE()                                                \
-  gdouble orig;                                                         \
-  gdouble *errors = ctx->error_buf, cur_error;
+static const gdouble ns_simple_coeffs[] = {
+  1.0, -0.5
+};
 
 #define ADD_NS_SIMPLE()                                                 \
-        cur_error = errors[chan_pos*2] - 0.5 * errors[chan_pos*2 + 1];  \
-        tmp -= cur_error;                                               \
-        orig = tmp;
+      INIT_NS_FILTER ()                                                 \
+      ADD_NS_FILTER (ns_simple_coeffs, 2)
 
 #define UPDATE_ERROR_SIMPLE()                                           \
-        errors[chan_pos*2 + 1] = errors[chan_pos*2];                    \
-        errors[chan_pos*2] = (*dst)/factor - orig;
-
+      UPDATE_ERROR_FILTER (2)
 
 /* Noise shaping coefficients from[1], moves most power of the
  * error noise into inaudible frequency ranges.
@@ -264,22 +401,12 @@ static const gdouble ns_medium_coeffs[] = {
   2.033, -2.165, 1.959, -1.590, 0.6149
 };
 
-#define INIT_NS_MEDIUM()                                                \
-  gdouble orig;                                                         \
-  gdouble *errors = ctx->error_buf, cur_error;                          \
-  int j;
-
 #define ADD_NS_MEDIUM()                                                 \
-        cur_error = 0.0;                                                \
-        for (j = 0; j < 5; j++)                                         \
-          cur_error += errors[chan_pos*5 + j] * ns_medium_coeffs[j];    \
-        tmp -= cur_error;                                               \
-        orig = tmp;
+      INIT_NS_FILTER ()                                                 \
+      ADD_NS_FILTER (ns_medium_coeffs, 5)
 
 #define UPDATE_ERROR_MEDIUM()                                           \
-        for (j = 4; j > 0; j--)                                         \
-          errors[chan_pos*5 + j] = errors[chan_pos*5 + j-1];            \
-        errors[chan_pos*5] = (*dst)/factor - orig;
+      UPDATE_ERROR_FILTER (5)
 
 /* Noise shaping coefficients by David Schleef, moves most power of the
  * error noise into inaudible frequency ranges */
@@ -288,105 +415,33 @@ static const gdouble ns_high_coeffs[] = {
   2.08484, -2.92975, 3.27918, -3.31399, 2.61339, -1.72008, 0.876066, -0.340122
 };
 
-#define INIT_NS_HIGH()                                                  \
-  gdouble orig;                                                         \
-  gdouble *errors = ctx->error_buf, cur_error;                          \
-  int j;
-
 #define ADD_NS_HIGH()                                                   \
-        cur_error = 0.0;                                                \
-        for (j = 0; j < 8; j++)                                         \
-          cur_error += errors[chan_pos + j] * ns_high_coeffs[j];          \
-        tmp -= cur_error;                                               \
-        orig = tmp;
+      INIT_NS_FILTER ()                                                 \
+      ADD_NS_FILTER (ns_high_coeffs, 8)
 
 #define UPDATE_ERROR_HIGH()                                             \
-        for (j = 7; j > 0; j--)                                         \
-          errors[chan_pos + j] = errors[chan_pos + j-1];                \
-        errors[chan_pos] = (*dst)/factor - orig;
-
-
-MAKE_QUANTIZE_FUNC_I (signed_none_none, NONE_FUNC, NONE_FUNC, ROUND);
-MAKE_QUANTIZE_FUNC_I (signed_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_RPDF_I,
-    NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (signed_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_TPDF_I,
-    NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (signed_tpdf_hf_none, INIT_DITHER_TPDF_HF_I,
-    ADD_DITHER_TPDF_HF_I, NONE_FUNC);
-
-MAKE_QUANTIZE_FUNC_I (unsigned_none_none, NONE_FUNC, NONE_FUNC, ROUND);
-MAKE_QUANTIZE_FUNC_I (unsigned_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_RPDF_I,
-    NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (unsigned_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_TPDF_I,
-    NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (unsigned_tpdf_hf_none, INIT_DITHER_TPDF_HF_I,
-    ADD_DITHER_TPDF_HF_I, NONE_FUNC);
-
-MAKE_QUANTIZE_FUNC_F (float_none_error_feedback, NONE_FUNC,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, NONE_FUNC,
-    UPDATE_ERROR_ERROR_FEEDBACK);
-MAKE_QUANTIZE_FUNC_F (float_none_simple, NONE_FUNC, INIT_NS_SIMPLE,
-    ADD_NS_SIMPLE, NONE_FUNC, UPDATE_ERROR_SIMPLE);
-MAKE_QUANTIZE_FUNC_F (float_none_medium, NONE_FUNC, INIT_NS_MEDIUM,
-    ADD_NS_MEDIUM, NONE_FUNC, UPDATE_ERROR_MEDIUM);
-MAKE_QUANTIZE_FUNC_F (float_none_high, NONE_FUNC, INIT_NS_HIGH, ADD_NS_HIGH,
-    NONE_FUNC, UPDATE_ERROR_HIGH);
-
-MAKE_QUANTIZE_FUNC_F (float_rpdf_error_feedback, INIT_DITHER_RPDF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_RPDF_F,
-    UPDATE_ERROR_ERROR_FEEDBACK);
-MAKE_QUANTIZE_FUNC_F (float_rpdf_simple, INIT_DITHER_RPDF_F, INIT_NS_SIMPLE,
-    ADD_NS_SIMPLE, ADD_DITHER_RPDF_F, UPDATE_ERROR_SIMPLE);
-MAKE_QUANTIZE_FUNC_F (float_rpdf_medium, INIT_DITHER_RPDF_F, INIT_NS_MEDIUM,
-    ADD_NS_MEDIUM, ADD_DITHER_RPDF_F, UPDATE_ERROR_MEDIUM);
-MAKE_QUANTIZE_FUNC_F (float_rpdf_high, INIT_DITHER_RPDF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_RPDF_F, UPDATE_ERROR_HIGH);
-
-MAKE_QUANTIZE_FUNC_F (float_tpdf_error_feedback, INIT_DITHER_TPDF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_TPDF_F,
-    UPDATE_ERROR_ERROR_FEEDBACK);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_simple, INIT_DITHER_TPDF_F, INIT_NS_SIMPLE,
-    ADD_NS_SIMPLE, ADD_DITHER_TPDF_F, UPDATE_ERROR_SIMPLE);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_medium, INIT_DITHER_TPDF_F, INIT_NS_MEDIUM,
-    ADD_NS_MEDIUM, ADD_DITHER_TPDF_F, UPDATE_ERROR_MEDIUM);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_high, INIT_DITHER_TPDF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_TPDF_F, UPDATE_ERROR_HIGH);
-
-MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_error_feedback, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_TPDF_HF_F,
-    UPDATE_ERROR_ERROR_FEEDBACK);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_simple, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_SIMPLE, ADD_NS_SIMPLE, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_SIMPLE);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_medium, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_MEDIUM, ADD_NS_MEDIUM, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_MEDIUM);
-MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_high, INIT_DITHER_TPDF_HF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_HIGH);
+      UPDATE_ERROR_FILTER (8)
+
+
+MAKE_QUANTIZE_FUNC_I (int_none, NONE_FUNC, NONE_FUNC, ROUND)
+MAKE_QUANTIZE_FUNC_I (int_dither, INIT_DITHER_I, ADD_DITHER_I, NONE_FUNC)
 
+MAKE_QUANTIZE_FUNC_F (float_error_feedback, ADD_NS_ERROR_FEEDBACK,
+    UPDATE_ERROR_ERROR_FEEDBACK)
+MAKE_QUANTIZE_FUNC_F (float_simple, ADD_NS_SIMPLE, UPDATE_ERROR_SIMPLE)
+MAKE_QUANTIZE_FUNC_F (float_medium, ADD_NS_MEDIUM, UPDATE_ERROR_MEDIUM)
+MAKE_QUANTIZE_FUNC_F (float_high, ADD_NS_HIGH, UPDATE_ERROR_HIGH)
+
+/* signed and unsigned samples are quantized the same way as the packing
+ * functions take care of the sign, and the dither noise is generated
+ * per buffer for all dither methods */
 static AudioConvertQuantize quantize_funcs[] = {
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (signed_none_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (signed_rpdf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (signed_tpdf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (signed_tpdf_hf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (unsigned_none_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (unsigned_rpdf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (unsigned_tpdf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (unsigned_tpdf_hf_none),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_none_error_feedback),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_none_simple),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_none_medium),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_none_high),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_rpdf_error_feedback),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_rpdf_simple),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_rpdf_medium),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_rpdf_high),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_error_feedback),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_simple),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_medium),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_high),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_hf_error_feedback),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_hf_simple),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_hf_medium),
-  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_tpdf_hf_high)
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (int_none),
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (int_dither),
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_error_feedback),
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_simple),
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_medium),
+  (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (float_high)
 };
 
 static void
@@ -413,6 +468,12 @@ gst_audio_quantize_setup_noise_shaping (AudioConvertCtx * ctx)
       ctx->error_buf = NULL;
       break;
   }
+
+  if (ctx->error_buf)
+    ctx->error_tmp = g_new0 (gdouble, ctx->out.channels * 2);
+  else
+    ctx->error_tmp = NULL;
+
   return;
 }
 
@@ -431,6 +492,8 @@ gst_audio_quantize_free_noise_shaping (AudioConvertCtx * ctx)
 
   g_free (ctx->error_buf);
   ctx->error_buf = NULL;
+  g_free (ctx->error_tmp);
+  ctx->error_tmp = NULL;
   return;
 }
 
@@ -453,6 +516,11 @@ gst_audio_quantize_setup_dither (AudioConvertCtx * ctx)
       ctx->last_random = NULL;
       break;
   }
+
+  ctx->random_state = 0xdeadbeef;
+  ctx->dither_buf = NULL;
+  ctx->dither_buf_size = 0;
+
   return;
 }
 
@@ -460,6 +528,11 @@ static void
 gst_audio_quantize_free_dither (AudioConvertCtx * ctx)
 {
   g_free (ctx->last_random);
+  ctx->last_random = NULL;
+
+  g_free (ctx->dither_buf);
+  ctx->dither_buf = NULL;
+  ctx->dither_buf_size = 0;
 
   return;
 }
@@ -475,11 +548,9 @@ gst_audio_quantize_setup_quantize_func (AudioConvertCtx * ctx)
   }
 
   if (ctx->ns == NOISE_SHAPING_NONE) {
-    index += ctx->dither;
-    index += GST_AUDIO_FORMAT_INFO_IS_SIGNED (ctx->out.finfo) ? 0 : 4;
+    index += (ctx->dither == DITHER_NONE) ? 0 : 1;
   } else {
-    index += 8 + (4 * ctx->dither);
-    index += ctx->ns - 1;
+    index += 2 + ctx->ns - 1;
   }
 
   ctx->quantize = quantize_funcs[index];
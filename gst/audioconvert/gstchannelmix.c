@@ -50,6 +50,11 @@ gst_channel_mix_unset_matrix (AudioConvertCtx * this)
   this->matrix = NULL;
   g_free (this->tmp);
   this->tmp = NULL;
+  g_free (this->mix_matrix);
+  this->mix_matrix = NULL;
+  this->mix_int_kernel = NULL;
+  this->mix_float_kernel = NULL;
+  this->mix_float32_kernel = NULL;
 }
 
 /*
@@ -590,6 +595,116 @@ gst_channel_mix_fill_matrix (AudioConvertCtx * this)
   }
 }
 
+/*
+ * Mixing kernels for common channel counts. The channel counts are
+ * constants so the compiler can unroll the loops over the channels and keep
+ * the matrix in registers, the clipping is done without branches. They
+ * accumulate and round exactly like the generic functions below.
+ */
+
+/* mix from in_data to out_data, going backwards if we upmix as the buffers
+ * might be the same */
+#define MIX_KERNEL_BODY(type,acctype,IN,OUT,minval,maxval)              \
+G_STMT_START {                                                          \
+  const gfloat *m = this->mix_matrix;                                   \
+  type tmp[OUT];                                                        \
+  gint in, out, n;                                                      \
+                                                                        \
+  for (n = 0; n < samples; n++) {                                       \
+    gint s = (OUT > IN) ? samples - 1 - n : n;                          \
+    const type *ip = in_data + s * IN;                                  \
+                                                                        \
+    for (out = 0; out < OUT; out++) {                                   \
+      acctype res = 0;                                                  \
+                                                                        \
+      for (in = 0; in < IN; in++)                                       \
+        res += ip[in] * m[out * IN + in];                               \
+      tmp[out] = CLAMP (res, minval, maxval);                           \
+    }                                                                   \
+    for (out = 0; out < OUT; out++)                                     \
+      out_data[s * OUT + out] = tmp[out];                               \
+  }                                                                     \
+} G_STMT_END
+
+#define DEFINE_MIX_KERNELS(IN,OUT)                                      \
+static void                                                             \
+gst_channel_mix_mix_int_##IN##_##OUT (AudioConvertCtx * this,           \
+    gint32 * in_data, gint32 * out_data, gint samples)                  \
+{                                                                       \
+  MIX_KERNEL_BODY (gint32, gint64, IN, OUT, G_MININT32, G_MAXINT32);    \
+}                                                                       \
+                                                                        \
+static void                                                             \
+gst_channel_mix_mix_float_##IN##_##OUT (AudioConvertCtx * this,         \
+    gdouble * in_data, gdouble * out_data, gint samples)                \
+{                                                                       \
+  MIX_KERNEL_BODY (gdouble, gdouble, IN, OUT, -1.0, 1.0);               \
+}                                                                       \
+                                                                        \
+static void                                                             \
+gst_channel_mix_mix_float32_##IN##_##OUT (AudioConvertCtx * this,       \
+    gfloat * in_data, gfloat * out_data, gint samples)                  \
+{                                                                       \
+  MIX_KERNEL_BODY (gfloat, gfloat, IN, OUT, -1.0f, 1.0f);               \
+}
+
+DEFINE_MIX_KERNELS (1, 2)
+DEFINE_MIX_KERNELS (2, 1)
+DEFINE_MIX_KERNELS (4, 2)
+DEFINE_MIX_KERNELS (6, 2)
+DEFINE_MIX_KERNELS (8, 2)
+DEFINE_MIX_KERNELS (8, 6)
+
+#define MIX_KERNEL(IN,OUT)                                      \
+  { IN, OUT,                                                    \
+    (AudioConvertMix) gst_channel_mix_mix_int_##IN##_##OUT,     \
+    (AudioConvertMix) gst_channel_mix_mix_float_##IN##_##OUT,   \
+    (AudioConvertMix) gst_channel_mix_mix_float32_##IN##_##OUT }
+
+static const struct
+{
+  gint in_channels, out_channels;
+  AudioConvertMix mix_int, mix_float, mix_float32;
+} mix_kernels[] = {
+  MIX_KERNEL (1, 2),
+  MIX_KERNEL (2, 1),
+  MIX_KERNEL (4, 2),
+  MIX_KERNEL (6, 2),
+  MIX_KERNEL (8, 2),
+  MIX_KERNEL (8, 6)
+};
+
+/* copy the matrix to one block and pick the kernels for the channel counts */
+static void
+gst_channel_mix_setup_kernels (AudioConvertCtx * this)
+{
+  gint i, j, inchannels, outchannels;
+  guint k;
+
+  inchannels = this->in.channels;
+  outchannels = this->out.channels;
+
+  for (k = 0; k < G_N_ELEMENTS (mix_kernels); k++) {
+    if (mix_kernels[k].in_channels == inchannels &&
+        mix_kernels[k].out_channels == outchannels)
+      break;
+  }
+  if (k == G_N_ELEMENTS (mix_kernels))
+    return;
+
+  GST_DEBUG ("using mixing kernels for %d -> %d channels", inchannels,
+      outchannels);
+
+  this->mix_matrix = g_new (gfloat, inchannels * outchannels);
+  for (i = 0; i < inchannels; i++)
+    for (j = 0; j < outchannels; j++)
+      this->mix_matrix[j * inchannels + i] = this->matrix[i][j];
+
+  this->mix_int_kernel = mix_kernels[k].mix_int;
+  this->mix_float_kernel = mix_kernels[k].mix_float;
+  this->mix_float32_kernel = mix_kernels[k].mix_float32;
+}
+
 /* only call after this->out and this->in are filled in */
 void
 gst_channel_mix_setup_matrix (AudioConvertCtx * this)
@@ -599,13 +714,9 @@ gst_channel_mix_setup_matrix (AudioConvertCtx * this)
   /* don't lose memory */
   gst_channel_mix_unset_matrix (this);
 
-  /* temp storage */
-  if (GST_AUDIO_FORMAT_INFO_IS_INTEGER (this->in.finfo) ||
-      GST_AUDIO_FORMAT_INFO_IS_INTEGER (this->out.finfo)) {
-    this->tmp = (gpointer) g_new (gint32, this->out.channels);
-  } else {
-    this->tmp = (gpointer) g_new (gdouble, this->out.channels);
-  }
+  /* temp storage, big enough for the int and the float mixing as noise
+   * shaping makes int to int conversions use the float mixing */
+  this->tmp = (gpointer) g_new (gdouble, this->out.channels);
 
   /* allocate */
   this->matrix = g_new0 (gfloat *, this->in.channels);
@@ -618,6 +729,8 @@ gst_channel_mix_setup_matrix (AudioConvertCtx * this)
   /* setup the matrix' internal values */
   gst_channel_mix_fill_matrix (this);
 
+  gst_channel_mix_setup_kernels (this);
+
 #ifndef GST_DISABLE_GST_DEBUG
   /* debug */
   {
@@ -679,11 +792,15 @@ gst_channel_mix_mix_int (AudioConvertCtx * this,
   g_return_if_fail (this->matrix != NULL);
   g_return_if_fail (this->tmp != NULL);
 
+  if (this->mix_int_kernel) {
+    this->mix_int_kernel (this, in_data, out_data, samples);
+    return;
+  }
+
   inchannels = this->in.channels;
   outchannels = this->out.channels;
   backwards = outchannels > inchannels;
 
-  /* FIXME: use orc here? */
   for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;
       backwards ? n-- : n++) {
     for (out = 0; out < outchannels; out++) {
@@ -718,11 +835,15 @@ gst_channel_mix_mix_float (AudioConvertCtx * this,
   g_return_if_fail (this->matrix != NULL);
   g_return_if_fail (this->tmp != NULL);
 
+  if (this->mix_float_kernel) {
+    this->mix_float_kernel (this, in_data, out_data, samples);
+    return;
+  }
+
   inchannels = this->in.channels;
   outchannels = this->out.channels;
   backwards = outchannels > inchannels;
 
-  /* FIXME: use liboil here? */
   for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;
       backwards ? n-- : n++) {
     for (out = 0; out < outchannels; out++) {
@@ -743,3 +864,42 @@ gst_channel_mix_mix_float (AudioConvertCtx * this,
         sizeof (gdouble) * outchannels);
   }
 }
+
+void
+gst_channel_mix_mix_float32 (AudioConvertCtx * this,
+    gfloat * in_data, gfloat * out_data, gint samples)
+{
+  gint in, out, n;
+  gfloat res;
+  gboolean backwards;
+  gint inchannels, outchannels;
+  gfloat *tmp = (gfloat *) this->tmp;
+
+  g_return_if_fail (this->matrix != NULL);
+  g_return_if_fail (this->tmp != NULL);
+
+  if (this->mix_float32_kernel) {
+    this->mix_float32_kernel (this, in_data, out_data, samples);
+    return;
+  }
+
+  inchannels = this->in.channels;
+  outchannels = this->out.channels;
+  backwards = outchannels > inchannels;
+
+  for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;
+      backwards ? n-- : n++) {
+    for (out = 0; out < outchannels; out++) {
+      /* convert */
+      res = 0.0;
+      for (in = 0; in < inchannels; in++) {
+        res += in_data[n * inchannels + in] * this->matrix[in][out];
+      }
+
+      /* clip */
+      tmp[out] = CLAMP (res, -1.0f, 1.0f);
+    }
+    memcpy (&out_data[n * outchannels], this->tmp,
+        sizeof (gfloat) * outchannels);
+  }
+}
@@ -53,4 +53,9 @@ void            gst_channel_mix_mix_float       (AudioConvertCtx * this,
                                                  gdouble         * out_data,
                                                  gint              samples);
 
+void            gst_channel_mix_mix_float32     (AudioConvertCtx * this,
+                                                 gfloat          * in_data,
+                                                 gfloat          * out_data,
+                                                 gint              samples);
+
 #endif /* __GST_CHANNEL_MIX_H__ */
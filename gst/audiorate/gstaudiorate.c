@@ -218,6 +218,12 @@ gst_audio_rate_setcaps (GstAudioRate * audiorate, GstCaps * caps)
 
   audiorate->info = info;
 
+  /* the silence depends on the format */
+  if (audiorate->silence) {
+    gst_memory_unref (audiorate->silence);
+    audiorate->silence = NULL;
+  }
+
   return TRUE;
 
   /* ERRORS */
@@ -252,6 +258,38 @@ gst_audio_rate_init (GstAudioRate * audiorate)
   audiorate->tolerance = DEFAULT_TOLERANCE;
 }
 
+/* Creates a GAP buffer with @size bytes of silence. All of these share one
+ * read-only memory of one second, so filling gaps does not allocate memory
+ * for the samples, no matter how long the gaps are. */
+static GstBuffer *
+gst_audio_rate_new_silence (GstAudioRate * audiorate, gsize size)
+{
+  GstBuffer *buffer;
+
+  if (audiorate->silence == NULL || audiorate->silence->size < size) {
+    GstMapInfo map;
+    gsize silence_size;
+
+    if (audiorate->silence)
+      gst_memory_unref (audiorate->silence);
+
+    silence_size = MAX (size, (gsize) GST_AUDIO_INFO_RATE (&audiorate->info) *
+        GST_AUDIO_INFO_BPF (&audiorate->info));
+    audiorate->silence = gst_allocator_alloc (NULL, silence_size, NULL);
+    gst_memory_map (audiorate->silence, &map, GST_MAP_WRITE);
+    gst_audio_format_fill_silence (audiorate->info.finfo, map.data, map.size);
+    gst_memory_unmap (audiorate->silence, &map);
+    GST_MINI_OBJECT_FLAG_SET (audiorate->silence, GST_MEMORY_FLAG_READONLY);
+  }
+
+  buffer = gst_buffer_new ();
+  gst_buffer_append_memory (buffer, gst_memory_share (audiorate->silence, 0,
+          size));
+  GST_BUFFER_FLAG_SET (buffer, GST_BUFFER_FLAG_GAP);
+
+  return buffer;
+}
+
 static void
 gst_audio_rate_fill_to_time (GstAudioRate * audiorate, GstClockTime time)
 {
@@ -334,6 +372,29 @@ gst_audio_rate_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
       }
       break;
     }
+    case GST_EVENT_GAP:
+    {
+      GstClockTime timestamp, duration;
+
+      gst_event_parse_gap (event, &timestamp, &duration);
+
+      /* fill the gap with silence buffers, they have the GAP flag too so
+       * downstream can still skip them. Before the first buffer we don't
+       * know the offsets yet and pass the event on. */
+      if (audiorate->src_segment.format == GST_FORMAT_TIME
+          && GST_CLOCK_TIME_IS_VALID (audiorate->next_ts)
+          && GST_CLOCK_TIME_IS_VALID (timestamp)
+          && GST_CLOCK_TIME_IS_VALID (duration)) {
+        GST_DEBUG_OBJECT (audiorate, "filling GAP event up to %"
+            GST_TIME_FORMAT, GST_TIME_ARGS (timestamp + duration));
+        gst_audio_rate_fill_to_time (audiorate, timestamp + duration);
+        gst_event_unref (event);
+        res = TRUE;
+      } else {
+        res = gst_pad_push_event (audiorate->srcpad, event);
+      }
+      break;
+    }
     case GST_EVENT_EOS:
       /* Fill segment until the end */
       if (GST_CLOCK_TIME_IS_VALID (audiorate->src_segment.stop))
@@ -522,10 +583,7 @@ gst_audio_rate_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       fillsamples -= cursamples;
       fillsize = cursamples * bpf;
 
-      fill = gst_buffer_new_and_alloc (fillsize);
-
-      /* FIXME, 0 might not be the silence byte for the negotiated format. */
-      gst_buffer_memset (fill, 0, 0, fillsize);
+      fill = gst_audio_rate_new_silence (audiorate, fillsize);
 
       GST_DEBUG_OBJECT (audiorate, "inserting %" G_GUINT64_FORMAT " samples",
           cursamples);
@@ -543,8 +601,6 @@ gst_audio_rate_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       GST_BUFFER_DURATION (fill) = audiorate->next_ts -
           GST_BUFFER_TIMESTAMP (fill);
 
-      /* we created this buffer to fill a gap */
-      GST_BUFFER_FLAG_SET (fill, GST_BUFFER_FLAG_GAP);
       /* set discont if it's pending, this is mostly done for the first buffer 
        * and after a flushing seek */
       if (audiorate->discont) {
@@ -724,6 +780,10 @@ gst_audio_rate_change_state (GstElement * element, GstStateChange transition)
 
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
+      if (audiorate->silence) {
+        gst_memory_unref (audiorate->silence);
+        audiorate->silence = NULL;
+      }
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       audiorate->in = 0;
@@ -65,6 +65,9 @@ struct _GstAudioRate
 
   gboolean discont;
 
+  /* read-only silence that all gap filling buffers share */
+  GstMemory *silence;
+
   gboolean new_segment;
   /* we accept all formats on the sink */
   GstSegment sink_segment;
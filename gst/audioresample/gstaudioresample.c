@@ -71,15 +71,20 @@ GST_DEBUG_CATEGORY_STATIC (GST_CAT_PERFORMANCE);
 #endif
 
 #define GST_TYPE_SPEEX_RESAMPLER_SINC_FILTER_MODE (speex_resampler_sinc_filter_mode_get_type ())
+#define GST_TYPE_SPEEX_RESAMPLER_FILTER_PHASE (speex_resampler_filter_phase_get_type ())
 
 enum
 {
   PROP_0,
   PROP_QUALITY,
   PROP_SINC_FILTER_MODE,
-  PROP_SINC_FILTER_AUTO_THRESHOLD
+  PROP_SINC_FILTER_AUTO_THRESHOLD,
+  PROP_FILTER_PHASE,
+  PROP_RATE_ADJUST
 };
 
+#define DEFAULT_RATE_ADJUST 1.0
+
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 #define SUPPORTED_CAPS \
   GST_AUDIO_CAPS_MAKE ("{ F32LE, F64LE, S32LE, S24LE, S16LE, S8 }") \
@@ -118,6 +123,8 @@ static void gst_audio_resample_get_property (GObject * object,
 
 static GType
 speex_resampler_sinc_filter_mode_get_type (void);
+static GType
+speex_resampler_filter_phase_get_type (void);
 
 /* vmethods */
 static gboolean gst_audio_resample_get_unit_size (GstBaseTransform * base,
@@ -131,6 +138,8 @@ static gboolean gst_audio_resample_transform_size (GstBaseTransform * trans,
     GstCaps * outcaps, gsize * outsize);
 static gboolean gst_audio_resample_set_caps (GstBaseTransform * base,
     GstCaps * incaps, GstCaps * outcaps);
+static void gst_audio_resample_before_transform (GstBaseTransform * base,
+    GstBuffer * buffer);
 static GstFlowReturn gst_audio_resample_transform (GstBaseTransform * base,
     GstBuffer * inbuf, GstBuffer * outbuf);
 static gboolean gst_audio_resample_sink_event (GstBaseTransform * base,
@@ -173,6 +182,41 @@ gst_audio_resample_class_init (GstAudioResampleClass * klass)
           SPEEX_RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT,
            G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioResample:filter-phase:
+   *
+   * Phase response of the filter. The minimum-phase filter has the same
+   * magnitude response as the default linear-phase one but only a few
+   * samples of latency instead of half the filter length, at the cost of
+   * phase distortion near the cutoff frequency.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_FILTER_PHASE,
+      g_param_spec_enum ("filter-phase", "Filter phase",
+          "Phase response of the filter",
+          GST_TYPE_SPEEX_RESAMPLER_FILTER_PHASE,
+          SPEEX_RESAMPLER_FILTER_PHASE_DEFAULT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioResample:rate-adjust:
+   *
+   * Factor applied to the conversion ratio, e.g. to compensate for clock
+   * drift between sender and receiver. Values above 1.0 consume the input
+   * faster. Changes take effect from the next buffer on without resetting
+   * the filter or renegotiating, and the element does not go into
+   * passthrough mode while an adjustment is set.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_RATE_ADJUST,
+      g_param_spec_double ("rate-adjust", "Rate adjustment",
+          "Factor applied to the conversion ratio for clock drift compensation",
+          0.5, 2.0, DEFAULT_RATE_ADJUST,
+          G_PARAM_READWRITE | GST_PARAM_CONTROLLABLE |
+          G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_audio_resample_src_template));
   gst_element_class_add_pad_template (gstelement_class,
@@ -196,6 +240,8 @@ gst_audio_resample_class_init (GstAudioResampleClass * klass)
       GST_DEBUG_FUNCPTR (gst_audio_resample_fixate_caps);
   GST_BASE_TRANSFORM_CLASS (klass)->set_caps =
       GST_DEBUG_FUNCPTR (gst_audio_resample_set_caps);
+  GST_BASE_TRANSFORM_CLASS (klass)->before_transform =
+      GST_DEBUG_FUNCPTR (gst_audio_resample_before_transform);
   GST_BASE_TRANSFORM_CLASS (klass)->transform =
       GST_DEBUG_FUNCPTR (gst_audio_resample_transform);
   GST_BASE_TRANSFORM_CLASS (klass)->sink_event =
@@ -212,6 +258,9 @@ gst_audio_resample_init (GstAudioResample * resample)
   resample->quality = SPEEX_RESAMPLER_QUALITY_DEFAULT;
   resample->sinc_filter_mode = SPEEX_RESAMPLER_SINC_FILTER_DEFAULT;
   resample->sinc_filter_auto_threshold = SPEEX_RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT;
+  resample->filter_phase = SPEEX_RESAMPLER_FILTER_PHASE_DEFAULT;
+  resample->rate_adjust = DEFAULT_RATE_ADJUST;
+  resample->pending_rate_adjust = DEFAULT_RATE_ADJUST;
 
   gst_base_transform_set_gap_aware (trans, TRUE);
   gst_pad_set_query_function (trans->srcpad, gst_audio_resample_query);
@@ -382,7 +431,7 @@ static SpeexResamplerState *
 gst_audio_resample_init_state (GstAudioResample * resample, gint width,
     gint channels, gint inrate, gint outrate, gint quality, gboolean fp,
     SpeexResamplerSincFilterMode sinc_filter_mode,
-    guint32 sinc_filter_auto_threshold)
+    guint32 sinc_filter_auto_threshold, SpeexResamplerFilterPhase filter_phase)
 {
   SpeexResamplerState *ret = NULL;
   gint err = RESAMPLER_ERR_SUCCESS;
@@ -402,6 +451,14 @@ gst_audio_resample_init_state (GstAudioResample * resample, gint width,
         funcs->get_sinc_filter_mode(ret) ? "full" : "interpolated");
   }
 
+  if (filter_phase == SPEEX_RESAMPLER_FILTER_PHASE_MINIMUM) {
+    GST_INFO_OBJECT (resample, "Using the minimum-phase filter");
+    funcs->set_filter_phase (ret, 1);
+  }
+
+  if (resample->rate_adjust != 1.0)
+    funcs->set_rate_adjust (ret, resample->rate_adjust);
+
   funcs->skip_zeros (ret);
 
   return ret;
@@ -411,23 +468,26 @@ static gboolean
 gst_audio_resample_update_state (GstAudioResample * resample, gint width,
     gint channels, gint inrate, gint outrate, gint quality, gboolean fp,
     SpeexResamplerSincFilterMode sinc_filter_mode,
-    guint32 sinc_filter_auto_threshold)
+    guint32 sinc_filter_auto_threshold, SpeexResamplerFilterPhase filter_phase)
 {
   gboolean ret = TRUE;
   gboolean updated_latency = FALSE;
 
   updated_latency = (resample->inrate != inrate
-      || quality != resample->quality) && resample->state != NULL;
+      || quality != resample->quality
+      || filter_phase != resample->filter_phase) && resample->state != NULL;
 
   if (resample->state == NULL) {
     ret = TRUE;
   } else if (resample->channels != channels || fp != resample->fp
       || width != resample->width || sinc_filter_mode != resample->sinc_filter_mode
-      || sinc_filter_auto_threshold != resample->sinc_filter_auto_threshold) {
+      || sinc_filter_auto_threshold != resample->sinc_filter_auto_threshold
+      || filter_phase != resample->filter_phase) {
     resample->funcs->destroy (resample->state);
     resample->state =
         gst_audio_resample_init_state (resample, width, channels, inrate,
-        outrate, quality, fp, sinc_filter_mode, sinc_filter_auto_threshold);
+        outrate, quality, fp, sinc_filter_mode, sinc_filter_auto_threshold,
+        filter_phase);
 
     resample->funcs = gst_audio_resample_get_funcs (width, fp);
     ret = (resample->state != NULL);
@@ -435,6 +495,9 @@ gst_audio_resample_update_state (GstAudioResample * resample, gint width,
     gint err = RESAMPLER_ERR_SUCCESS;
 
     err = resample->funcs->set_rate (resample->state, inrate, outrate);
+    if (err == RESAMPLER_ERR_SUCCESS && resample->rate_adjust != 1.0)
+      err = resample->funcs->set_rate_adjust (resample->state,
+          resample->rate_adjust);
 
     if (G_UNLIKELY (err != RESAMPLER_ERR_SUCCESS))
       GST_ERROR_OBJECT (resample, "Failed to update rate: %s",
@@ -461,6 +524,7 @@ gst_audio_resample_update_state (GstAudioResample * resample, gint width,
   resample->outrate = outrate;
   resample->sinc_filter_mode = sinc_filter_mode;
   resample->sinc_filter_auto_threshold = sinc_filter_auto_threshold;
+  resample->filter_phase = filter_phase;
 
   if (updated_latency)
     gst_element_post_message (GST_ELEMENT (resample),
@@ -524,7 +588,16 @@ gst_audio_resample_transform_size (GstBaseTransform * base,
   ratio_num = inrate / gcd;
   ratio_den = outrate / gcd;
 
-  if (direction == GST_PAD_SINK) {
+  if (GST_AUDIO_RESAMPLE (base)->rate_adjust != 1.0) {
+    gdouble adjust = GST_AUDIO_RESAMPLE (base)->rate_adjust;
+
+    /* the adjusted ratio isn't exact, leave room for one more sample */
+    if (direction == GST_PAD_SINK)
+      *othersize = ceil (size * ratio_den / (ratio_num * adjust)) + 1;
+    else
+      *othersize = floor (size * ratio_num * adjust / ratio_den);
+    *othersize *= bpf;
+  } else if (direction == GST_PAD_SINK) {
     /* asked to convert size of an incoming buffer. Round up the output size */
     *othersize = gst_util_uint64_scale_int_ceil (size, ratio_den, ratio_num);
     *othersize *= bpf;
@@ -567,15 +640,21 @@ gst_audio_resample_set_caps (GstBaseTransform * base, GstCaps * incaps,
   inrate = GST_AUDIO_INFO_RATE (&in);
   outrate = GST_AUDIO_INFO_RATE (&out);
   fp = GST_AUDIO_FORMAT_INFO_IS_FLOAT (in.finfo);
+  resample->layout = GST_AUDIO_INFO_LAYOUT (&in);
 
   ret =
       gst_audio_resample_update_state (resample, width, channels, inrate,
       outrate, resample->quality, fp, resample->sinc_filter_mode,
-      resample->sinc_filter_auto_threshold);
+      resample->sinc_filter_auto_threshold, resample->filter_phase);
 
   if (G_UNLIKELY (!ret))
     return FALSE;
 
+  /* base transform goes into passthrough on equal caps, but a rate
+   * adjustment still needs the resampler */
+  if (resample->rate_adjust != 1.0)
+    gst_base_transform_set_passthrough (base, FALSE);
+
   return TRUE;
 
   /* ERROR */
@@ -766,6 +845,42 @@ gst_audio_resample_workspace_realloc (guint8 ** workspace, guint * size,
   return *workspace;
 }
 
+/* Resamples @in_len frames of @in to at most @out_len frames of @out, both in
+ * the sample format of the resampler. Non-interleaved audio is resampled one
+ * plane at a time, @in can be %NULL to resample silence. */
+static gint
+gst_audio_resample_process_frames (GstAudioResample * resample,
+    const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len)
+{
+  guint32 in_processed = 0, out_processed = 0;
+  gint bps = resample->funcs->width / 8;
+  gint c, err;
+
+  if (resample->layout != GST_AUDIO_LAYOUT_NON_INTERLEAVED)
+    return resample->funcs->process (resample->state, in, in_len, out,
+        out_len);
+
+  for (c = 0; c < resample->channels; c++) {
+    in_processed = *in_len;
+    out_processed = *out_len;
+    err = resample->funcs->process_channel (resample->state, c,
+        in ? in + c * *in_len * bps : NULL, &in_processed,
+        out + c * *out_len * bps, &out_processed);
+    if (G_UNLIKELY (err != RESAMPLER_ERR_SUCCESS))
+      return err;
+  }
+
+  /* all planes produce the same number of frames, move them together */
+  for (c = 1; c < resample->channels; c++)
+    memmove (out + c * out_processed * bps, out + c * *out_len * bps,
+        out_processed * bps);
+
+  *in_len = in_processed;
+  *out_len = out_processed;
+
+  return RESAMPLER_ERR_SUCCESS;
+}
+
 /* Push history_len zeros into the filter, but discard the output. */
 static void
 gst_audio_resample_dump_drain (GstAudioResample * resample, guint history_len)
@@ -838,7 +953,7 @@ gst_audio_resample_push_drain (GstAudioResample * resample, guint history_len)
     }
 
     /* process */
-    err = resample->funcs->process (resample->state, NULL, &in_processed,
+    err = gst_audio_resample_process_frames (resample, NULL, &in_processed,
         resample->tmp_out, &out_processed);
 
     /* convert output format */
@@ -846,7 +961,7 @@ gst_audio_resample_push_drain (GstAudioResample * resample, guint history_len)
         map.data, out_processed, TRUE);
   } else {
     /* don't need to convert data format;  process */
-    err = resample->funcs->process (resample->state, NULL, &in_processed,
+    err = gst_audio_resample_process_frames (resample, NULL, &in_processed,
         map.data, &out_processed);
   }
 
@@ -1008,6 +1123,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
   guint32 in_len, in_processed;
   guint32 out_len, out_processed;
   guint filt_len = resample->funcs->get_filt_len (resample->state);
+  guint latency = resample->funcs->get_input_latency (resample->state);
 
   gst_buffer_map (inbuf, &in_map, GST_MAP_READ);
   gst_buffer_map (outbuf, &out_map, GST_MAP_WRITE);
@@ -1038,10 +1154,10 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
     {
       guint num, den;
       resample->funcs->get_ratio (resample->state, &num, &den);
-      if (resample->samples_in + in_len >= filt_len / 2)
+      if (resample->samples_in + in_len >= latency)
         out_processed =
             gst_util_uint64_scale_int_ceil (resample->samples_in + in_len -
-            filt_len / 2, den, num) - resample->samples_out;
+            latency, den, num) - resample->samples_out;
       else
         out_processed = 0;
 
@@ -1088,7 +1204,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
           resample->tmp_in, in_len, FALSE);
 
       /* process */
-      err = resample->funcs->process (resample->state,
+      err = gst_audio_resample_process_frames (resample,
           resample->tmp_in, &in_processed, resample->tmp_out, &out_processed);
 
       /* convert output */
@@ -1096,7 +1212,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
           out_map.data, out_processed, TRUE);
     } else {
       /* no format conversion required;  process */
-      err = resample->funcs->process (resample->state,
+      err = gst_audio_resample_process_frames (resample,
           in_map.data, &in_processed, out_map.data, &out_processed);
     }
 
@@ -1160,6 +1276,49 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
   return GST_FLOW_OK;
 }
 
+static void
+gst_audio_resample_before_transform (GstBaseTransform * base,
+    GstBuffer * buffer)
+{
+  GstAudioResample *resample = GST_AUDIO_RESAMPLE (base);
+  GstClockTime timestamp;
+  gdouble rate_adjust;
+
+  timestamp = GST_BUFFER_TIMESTAMP (buffer);
+  timestamp =
+      gst_segment_to_stream_time (&base->segment, GST_FORMAT_TIME, timestamp);
+
+  GST_DEBUG_OBJECT (resample, "sync to %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (timestamp));
+
+  if (GST_CLOCK_TIME_IS_VALID (timestamp))
+    gst_object_sync_values (GST_OBJECT (resample), timestamp);
+
+  GST_OBJECT_LOCK (resample);
+  rate_adjust = resample->pending_rate_adjust;
+  GST_OBJECT_UNLOCK (resample);
+
+  if (rate_adjust == resample->rate_adjust)
+    return;
+
+  GST_LOG_OBJECT (resample, "new rate adjustment %f", rate_adjust);
+  resample->rate_adjust = rate_adjust;
+
+  if (resample->state) {
+    if (rate_adjust != 1.0)
+      resample->funcs->set_rate_adjust (resample->state, rate_adjust);
+    else
+      /* back to the exact ratio that transform_size assumes */
+      resample->funcs->set_rate (resample->state, resample->inrate,
+          resample->outrate);
+  }
+
+  /* same rates means same caps, so this is what passthrough_on_same_caps
+   * would have picked without an adjustment */
+  gst_base_transform_set_passthrough (base, rate_adjust == 1.0
+      && resample->inrate == resample->outrate);
+}
+
 static GstFlowReturn
 gst_audio_resample_transform (GstBaseTransform * base, GstBuffer * inbuf,
     GstBuffer * outbuf)
@@ -1172,7 +1331,8 @@ gst_audio_resample_transform (GstBaseTransform * base, GstBuffer * inbuf,
                 gst_audio_resample_init_state (resample, resample->width,
                     resample->channels, resample->inrate, resample->outrate,
                     resample->quality, resample->fp, resample->sinc_filter_mode,
-                    resample->sinc_filter_auto_threshold))))
+                    resample->sinc_filter_auto_threshold,
+                    resample->filter_phase))))
       return GST_FLOW_ERROR;
 
     resample->funcs =
@@ -1326,7 +1486,7 @@ gst_audio_resample_set_property (GObject * object, guint prop_id,
       gst_audio_resample_update_state (resample, resample->width,
           resample->channels, resample->inrate, resample->outrate,
           quality, resample->fp, resample->sinc_filter_mode,
-          resample->sinc_filter_auto_threshold);
+          resample->sinc_filter_auto_threshold, resample->filter_phase);
       break;
     case PROP_SINC_FILTER_MODE: {
       /* FIXME locking! */
@@ -1335,7 +1495,7 @@ gst_audio_resample_set_property (GObject * object, guint prop_id,
       gst_audio_resample_update_state (resample, resample->width,
           resample->channels, resample->inrate, resample->outrate,
           resample->quality, resample->fp, sinc_filter_mode,
-          resample->sinc_filter_auto_threshold);
+          resample->sinc_filter_auto_threshold, resample->filter_phase);
 
       break;
     }
@@ -1346,7 +1506,24 @@ gst_audio_resample_set_property (GObject * object, guint prop_id,
       gst_audio_resample_update_state (resample, resample->width,
           resample->channels, resample->inrate, resample->outrate,
           resample->quality, resample->fp, resample->sinc_filter_mode,
-          sinc_filter_auto_threshold);
+          sinc_filter_auto_threshold, resample->filter_phase);
+
+      break;
+    }
+    case PROP_RATE_ADJUST:
+      /* applied from the streaming thread in before_transform */
+      GST_OBJECT_LOCK (resample);
+      resample->pending_rate_adjust = g_value_get_double (value);
+      GST_OBJECT_UNLOCK (resample);
+      break;
+    case PROP_FILTER_PHASE: {
+      /* FIXME locking! */
+      SpeexResamplerFilterPhase filter_phase = g_value_get_enum (value);
+
+      gst_audio_resample_update_state (resample, resample->width,
+          resample->channels, resample->inrate, resample->outrate,
+          resample->quality, resample->fp, resample->sinc_filter_mode,
+          resample->sinc_filter_auto_threshold, filter_phase);
 
       break;
     }
@@ -1374,6 +1551,14 @@ gst_audio_resample_get_property (GObject * object, guint prop_id,
     case PROP_SINC_FILTER_AUTO_THRESHOLD:
       g_value_set_uint(value, resample->sinc_filter_auto_threshold);
       break;
+    case PROP_FILTER_PHASE:
+      g_value_set_enum(value, resample->filter_phase);
+      break;
+    case PROP_RATE_ADJUST:
+      GST_OBJECT_LOCK (resample);
+      g_value_set_double (value, resample->pending_rate_adjust);
+      GST_OBJECT_UNLOCK (resample);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1401,6 +1586,26 @@ speex_resampler_sinc_filter_mode_get_type (void)
   return speex_resampler_sinc_filter_mode_type;
 }
 
+static GType
+speex_resampler_filter_phase_get_type (void)
+{
+  static GType speex_resampler_filter_phase_type = 0;
+
+  if (!speex_resampler_filter_phase_type) {
+    static GEnumValue filter_phases[] = {
+      { SPEEX_RESAMPLER_FILTER_PHASE_LINEAR,  "Linear-phase windowed sinc", "linear"  },
+      { SPEEX_RESAMPLER_FILTER_PHASE_MINIMUM, "Minimum-phase, low latency", "minimum" },
+      { 0, NULL, NULL },
+    };
+
+    speex_resampler_filter_phase_type = g_enum_register_static (
+                                        "SpeexResamplerFilterPhase",
+                                        filter_phases);
+  }
+
+  return speex_resampler_filter_phase_type;
+}
+
 /* FIXME: should have a benchmark fallback for the case where orc is disabled */
 #if defined(AUDIORESAMPLE_FORMAT_AUTO) && !defined(DISABLE_ORC)
 
@@ -76,9 +76,13 @@ struct _GstAudioResample {
   gint channels;
   gint inrate;
   gint outrate;
+  GstAudioLayout layout;
 
   SpeexResamplerSincFilterMode sinc_filter_mode;
   guint32 sinc_filter_auto_threshold;
+  SpeexResamplerFilterPhase filter_phase;
+  gdouble rate_adjust;
+  gdouble pending_rate_adjust;   /* protected by the object lock */
 
   guint8 *tmp_in;
   guint tmp_in_size;
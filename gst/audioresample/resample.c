@@ -94,6 +94,12 @@
 #endif
 #endif
 
+#ifdef _USE_AVX2
+#if !defined(_USE_SSE) || !defined(HAVE_IMMINTRIN_H) || !defined(HAVE_AVX2_TARGET_ATTRIBUTE)
+#undef _USE_AVX2
+#endif
+#endif
+
 static inline void *
 speex_alloc (int size)
 {
@@ -140,6 +146,10 @@ speex_free (void *ptr)
 #include "resample_sse.h"
 #endif
 
+#ifdef _USE_AVX2
+#include "resample_avx2.h"
+#endif
+
 #ifdef _USE_NEON
 #include "resample_neon.h"
 #endif
@@ -186,6 +196,26 @@ speex_free (void *ptr)
 typedef int (*resampler_basic_func) (SpeexResamplerState *, spx_uint32_t,
     const spx_word16_t *, spx_uint32_t *, spx_word16_t *, spx_uint32_t *);
 
+/* Filter tables only depend on the parameters below, so they are computed
+ * once and shared by all resamplers using them. This file is built once per
+ * sample type and each build has its own cache. Tables are never modified
+ * after creation and are freed when the last resampler releases them. */
+typedef struct
+{
+  int direct;
+  int minimum_phase;
+  int quality;
+  spx_uint32_t filt_len;
+  spx_uint32_t phases;
+  float cutoff;
+
+  int ref_count;
+  spx_uint32_t length;
+  spx_word16_t *table;
+  /* in input samples */
+  spx_uint32_t latency;
+} SincTableEntry;
+
 struct SpeexResamplerState_
 {
   spx_uint32_t in_rate;
@@ -205,6 +235,7 @@ struct SpeexResamplerState_
   int initialised;
   int started;
   int use_full_sinc_table;
+  int minimum_phase;
 
   /* These are per-channel */
   spx_int32_t *last_sample;
@@ -214,6 +245,7 @@ struct SpeexResamplerState_
   spx_word16_t *mem;
   spx_word16_t *sinc_table;
   spx_uint32_t sinc_table_length;
+  SincTableEntry *sinc_entry;
   resampler_basic_func resampler_ptr;
 
   int in_stride;
@@ -222,6 +254,7 @@ struct SpeexResamplerState_
   int use_sse:1;
   int use_sse2:1;
   int use_neon:1;
+  int use_avx2:1;
 };
 
 static double kaiser12_table[68] = {
@@ -414,6 +447,20 @@ sinc (float cutoff, float x, int N, struct FuncDef *window_func)
 }
 #endif
 
+/* Same as sinc() in double precision and without scaling, used to design
+ * the minimum-phase filter */
+static double
+sinc_prototype (double cutoff, double x, int N, struct FuncDef *window_func)
+{
+  double xx = x * cutoff;
+  if (fabs (x) < 1e-6)
+    return cutoff;
+  else if (fabs (x) > .5 * N)
+    return 0;
+  return cutoff * sin (G_PI * xx) / (G_PI * xx) * compute_func (fabs (2. * x /
+          N), window_func);
+}
+
 #ifdef FIXED_POINT
 static void
 cubic_coef (spx_word16_t x, spx_word16_t interp[4])
@@ -501,7 +548,12 @@ resampler_basic_direct_single (SpeexResamplerState * st,
     NEON_END(INNER_PRODUCT_SINGLE)
 #elif defined(OVERRIDE_INNER_PRODUCT_SINGLE) && defined(_USE_SSE)
     SSE_IMPLEMENTATION (INNER_PRODUCT_SINGLE)
-        sum = inner_product_single (sinc, iptr, N);
+#ifdef _USE_AVX2
+        if (st->use_avx2)
+          sum = inner_product_single_avx2 (sinc, iptr, N);
+        else
+#endif
+          sum = inner_product_single (sinc, iptr, N);
     SSE_END (INNER_PRODUCT_SINGLE)
 #endif
     out[out_stride * out_sample++] = SATURATE32PSHR(sum, 15, 32767);
@@ -597,9 +649,10 @@ resampler_basic_interpolate_single (SpeexResamplerState * st,
 
     const int offset = samp_frac_num * st->oversample / st->den_rate;
 #ifdef FIXED_POINT
+    /* den_rate can be large while the rate is adjusted */
     const spx_word16_t frac =
-        PDIV32 (SHL32 ((samp_frac_num * st->oversample) % st->den_rate, 15),
-        st->den_rate);
+        ((((gint64) ((samp_frac_num * st->oversample) % st->den_rate)) << 15)
+        + (st->den_rate >> 1)) / st->den_rate;
 #else
     const spx_word16_t frac =
         ((float) ((samp_frac_num * st->oversample) % st->den_rate)) /
@@ -682,9 +735,10 @@ resampler_basic_interpolate_double (SpeexResamplerState * st,
 
     const int offset = samp_frac_num * st->oversample / st->den_rate;
 #ifdef FIXED_POINT
+    /* den_rate can be large while the rate is adjusted */
     const spx_word16_t frac =
-        PDIV32 (SHL32 ((samp_frac_num * st->oversample) % st->den_rate, 15),
-        st->den_rate);
+        ((((gint64) ((samp_frac_num * st->oversample) % st->den_rate)) << 15)
+        + (st->den_rate >> 1)) / st->den_rate;
 #else
 #ifdef DOUBLE_PRECISION
     const spx_word16_t frac =
@@ -747,6 +801,261 @@ resampler_basic_interpolate_double (SpeexResamplerState * st,
 }
 #endif
 
+G_LOCK_DEFINE_STATIC (sinc_table_cache);
+static GSList *sinc_table_cache = NULL;
+
+/* In-place radix-2 complex FFT of n = 2^k points, inverse if sign is positive.
+ * The inverse is not scaled. */
+static void
+minimum_phase_fft (double *re, double *im, spx_uint32_t n, int sign)
+{
+  spx_uint32_t i, j, k, len;
+
+  for (i = 1, j = 0; i < n; i++) {
+    spx_uint32_t bit = n >> 1;
+    double t;
+
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j |= bit;
+    if (i < j) {
+      t = re[i];
+      re[i] = re[j];
+      re[j] = t;
+      t = im[i];
+      im[i] = im[j];
+      im[j] = t;
+    }
+  }
+
+  for (len = 2; len <= n; len <<= 1) {
+    const double wr = cos (sign * 2 * G_PI / len);
+    const double wi = sin (sign * 2 * G_PI / len);
+
+    for (i = 0; i < n; i += len) {
+      double cr = 1, ci = 0;
+
+      for (k = 0; k < len / 2; k++) {
+        const spx_uint32_t a = i + k, b = i + k + len / 2;
+        const double tr = re[b] * cr - im[b] * ci;
+        const double ti = re[b] * ci + im[b] * cr;
+        const double t = cr * wr - ci * wi;
+
+        re[b] = re[a] - tr;
+        im[b] = im[a] - ti;
+        re[a] += tr;
+        im[a] += ti;
+        ci = cr * wi + ci * wr;
+        cr = t;
+      }
+    }
+  }
+}
+
+/* Designs the minimum-phase filter with the same magnitude response as the
+ * windowed sinc of st with the cepstrum method. The result has
+ * filt_len * steps + 1 taps, tap k being the response after k / steps input
+ * samples. The group delay at DC in input samples is stored in delay. */
+static double *
+minimum_phase_prototype (SpeexResamplerState * st, spx_uint32_t steps,
+    double *delay)
+{
+  const spx_uint32_t len = st->filt_len * steps + 1;
+  spx_uint32_t n = 1, k;
+  double *re, *im, *m;
+  double max = 0, sum = 0, moment = 0;
+
+  /* Zero padding reduces the time aliasing of the cepstrum */
+  while (n < 8 * len)
+    n <<= 1;
+  re = (double *) speex_alloc (n * sizeof (double));
+  im = (double *) speex_alloc (n * sizeof (double));
+
+  for (k = 0; k < len; k++)
+    re[k] = sinc_prototype (st->cutoff, (double) k / steps - st->filt_len / 2.,
+        st->filt_len, quality_map[st->quality].window_func);
+
+  /* Real cepstrum of the prototype, the log magnitude is clamped to stay
+   * finite in the stop band */
+  minimum_phase_fft (re, im, n, -1);
+  for (k = 0; k < n; k++) {
+    re[k] = sqrt (re[k] * re[k] + im[k] * im[k]);
+    if (re[k] > max)
+      max = re[k];
+  }
+  for (k = 0; k < n; k++) {
+    re[k] = log (IMAX (re[k], max * 1e-10));
+    im[k] = 0;
+  }
+  minimum_phase_fft (re, im, n, 1);
+
+  /* Fold the anti-causal part onto the causal part */
+  for (k = 1; k < n / 2; k++)
+    re[k] *= 2;
+  for (k = n / 2 + 1; k < n; k++)
+    re[k] = 0;
+  for (k = 0; k < n; k++) {
+    re[k] /= n;
+    im[k] = 0;
+  }
+
+  /* And back to the time domain through the complex exponential */
+  minimum_phase_fft (re, im, n, -1);
+  for (k = 0; k < n; k++) {
+    const double e = exp (re[k]);
+
+    re[k] = e * cos (im[k]);
+    im[k] = e * sin (im[k]);
+  }
+  minimum_phase_fft (re, im, n, 1);
+
+  m = (double *) speex_alloc (len * sizeof (double));
+  for (k = 0; k < len; k++) {
+    m[k] = re[k] / n;
+    sum += m[k];
+    moment += k * m[k];
+  }
+  *delay = moment / sum / steps;
+
+  speex_free (re);
+  speex_free (im);
+
+  return m;
+}
+
+static void
+sinc_table_fill (SpeexResamplerState * st, SincTableEntry * entry)
+{
+  spx_word16_t *table = entry->table;
+
+  entry->latency = st->filt_len / 2;
+
+  if (entry->minimum_phase) {
+    /* Table entry i + 4 is used as the weight of an input sample
+     * filt_len - i / oversample input samples before the output */
+    const spx_int32_t len = st->filt_len * st->oversample;
+    double delay;
+    double *m = minimum_phase_prototype (st, st->oversample, &delay);
+    spx_int32_t i;
+
+    for (i = -4; i < len + 4; i++) {
+      const double v = (i >= 0 && i <= len) ? m[len - i] : 0;
+#ifdef FIXED_POINT
+      table[i + 4] = WORD2INT (32768. * v);
+#else
+      table[i + 4] = v;
+#endif
+    }
+    speex_free (m);
+
+    entry->latency = (spx_uint32_t) floor (delay + .5);
+  } else if (entry->direct) {
+    spx_uint32_t i;
+    for (i = 0; i < st->den_rate; i++) {
+      spx_int32_t j;
+      for (j = 0; j < st->filt_len; j++) {
+        table[i * st->filt_len + j] =
+            sinc (st->cutoff, ((j - (spx_int32_t) st->filt_len / 2 + 1) -
+#ifdef DOUBLE_PRECISION
+                ((double) i) / st->den_rate), st->filt_len,
+#else
+                ((float) i) / st->den_rate), st->filt_len,
+#endif
+            quality_map[st->quality].window_func);
+      }
+    }
+  } else {
+    spx_int32_t i;
+    for (i = -4; i < (spx_int32_t) (st->oversample * st->filt_len + 4); i++)
+      table[i + 4] =
+#ifdef DOUBLE_PRECISION
+          sinc (st->cutoff, (i / (double) st->oversample - st->filt_len / 2),
+#else
+          sinc (st->cutoff, (i / (float) st->oversample - st->filt_len / 2),
+#endif
+          st->filt_len, quality_map[st->quality].window_func);
+  }
+}
+
+static void
+sinc_table_unref_locked (SincTableEntry * entry)
+{
+  if (--entry->ref_count > 0)
+    return;
+
+  sinc_table_cache = g_slist_remove (sinc_table_cache, entry);
+  speex_free (entry->table);
+  speex_free (entry);
+}
+
+/* Makes st use the direct or interpolated table for its current parameters,
+ * computing it only if no other resampler uses it yet */
+static void
+sinc_table_acquire (SpeexResamplerState * st, int direct)
+{
+  const int minimum_phase = st->minimum_phase;
+  const spx_uint32_t phases = direct ? st->den_rate : st->oversample;
+  SincTableEntry *entry = NULL;
+  GSList *l;
+
+  G_LOCK (sinc_table_cache);
+  for (l = sinc_table_cache; l; l = l->next) {
+    SincTableEntry *e = l->data;
+
+    if (e->direct == direct && e->minimum_phase == minimum_phase
+        && e->quality == st->quality
+        && e->filt_len == st->filt_len && e->phases == phases
+        && e->cutoff == st->cutoff) {
+      entry = e;
+      break;
+    }
+  }
+
+  if (entry) {
+    entry->ref_count++;
+  } else {
+    entry = (SincTableEntry *) speex_alloc (sizeof (SincTableEntry));
+    entry->direct = direct;
+    entry->minimum_phase = minimum_phase;
+    entry->quality = st->quality;
+    entry->filt_len = st->filt_len;
+    entry->phases = phases;
+    entry->cutoff = st->cutoff;
+    entry->ref_count = 1;
+    entry->length = direct ? st->filt_len * st->den_rate :
+        st->filt_len * st->oversample + 8;
+    entry->table =
+        (spx_word16_t *) speex_alloc (entry->length * sizeof (spx_word16_t));
+    sinc_table_fill (st, entry);
+    sinc_table_cache = g_slist_prepend (sinc_table_cache, entry);
+  }
+
+  /* Release the previous table only now so that it is reused instead of
+   * recomputed if the parameters didn't change */
+  if (st->sinc_entry)
+    sinc_table_unref_locked (st->sinc_entry);
+  G_UNLOCK (sinc_table_cache);
+
+  st->sinc_entry = entry;
+  st->sinc_table = entry->table;
+  st->sinc_table_length = entry->length;
+}
+
+static void
+sinc_table_release (SpeexResamplerState * st)
+{
+  if (!st->sinc_entry)
+    return;
+
+  G_LOCK (sinc_table_cache);
+  sinc_table_unref_locked (st->sinc_entry);
+  G_UNLOCK (sinc_table_cache);
+
+  st->sinc_entry = NULL;
+  st->sinc_table = NULL;
+  st->sinc_table_length = 0;
+}
+
 static void
 update_filter (SpeexResamplerState * st)
 {
@@ -762,7 +1071,7 @@ update_filter (SpeexResamplerState * st)
         quality_map[st->quality].downsample_bandwidth * st->den_rate /
         st->num_rate;
     /* FIXME: divide the numerator and denominator by a certain amount if they're too large */
-    st->filt_len = st->filt_len * st->num_rate / st->den_rate;
+    st->filt_len = (guint64) st->filt_len * st->num_rate / st->den_rate;
     /* Round down to make sure we have a multiple of 4 */
     st->filt_len &= (~0x3);
     if (2 * st->den_rate < st->num_rate)
@@ -782,31 +1091,10 @@ update_filter (SpeexResamplerState * st)
 
   /* Choose the resampling type that requires the least amount of memory */
   /* Or if the full sinc table is explicitely requested, use that */
-  if (st->use_full_sinc_table || (st->den_rate <= st->oversample)) {
-    spx_uint32_t i;
-    if (!st->sinc_table)
-      st->sinc_table =
-          (spx_word16_t *) speex_alloc (st->filt_len * st->den_rate *
-          sizeof (spx_word16_t));
-    else if (st->sinc_table_length < st->filt_len * st->den_rate) {
-      st->sinc_table =
-          (spx_word16_t *) speex_realloc (st->sinc_table,
-          st->filt_len * st->den_rate * sizeof (spx_word16_t));
-      st->sinc_table_length = st->filt_len * st->den_rate;
-    }
-    for (i = 0; i < st->den_rate; i++) {
-      spx_int32_t j;
-      for (j = 0; j < st->filt_len; j++) {
-        st->sinc_table[i * st->filt_len + j] =
-            sinc (st->cutoff, ((j - (spx_int32_t) st->filt_len / 2 + 1) -
-#ifdef DOUBLE_PRECISION
-                ((double) i) / st->den_rate), st->filt_len,
-#else
-                ((float) i) / st->den_rate), st->filt_len,
-#endif
-            quality_map[st->quality].window_func);
-      }
-    }
+  /* The minimum-phase filter is only available as interpolated table */
+  if (!st->minimum_phase && (st->use_full_sinc_table
+          || (st->den_rate <= st->oversample))) {
+    sinc_table_acquire (st, 1);
 #ifdef FIXED_POINT
     st->resampler_ptr = resampler_basic_direct_single;
 #else
@@ -821,25 +1109,7 @@ update_filter (SpeexResamplerState * st)
 #endif
     /*fprintf (stderr, "resampler uses direct sinc table and normalised cutoff %f\n", cutoff); */
   } else {
-    spx_int32_t i;
-    if (!st->sinc_table)
-      st->sinc_table =
-          (spx_word16_t *) speex_alloc ((st->filt_len * st->oversample +
-              8) * sizeof (spx_word16_t));
-    else if (st->sinc_table_length < st->filt_len * st->oversample + 8) {
-      st->sinc_table =
-          (spx_word16_t *) speex_realloc (st->sinc_table,
-          (st->filt_len * st->oversample + 8) * sizeof (spx_word16_t));
-      st->sinc_table_length = st->filt_len * st->oversample + 8;
-    }
-    for (i = -4; i < (spx_int32_t) (st->oversample * st->filt_len + 4); i++)
-      st->sinc_table[i + 4] =
-#ifdef DOUBLE_PRECISION
-          sinc (st->cutoff, (i / (double) st->oversample - st->filt_len / 2),
-#else
-          sinc (st->cutoff, (i / (float) st->oversample - st->filt_len / 2),
-#endif
-          st->filt_len, quality_map[st->quality].window_func);
+    sinc_table_acquire (st, 0);
 #ifdef FIXED_POINT
     st->resampler_ptr = resampler_basic_interpolate_single;
 #else
@@ -1013,11 +1283,13 @@ speex_resampler_init_frac (spx_uint32_t nb_channels, spx_uint32_t ratio_num,
   st->den_rate = 0;
   st->quality = -1;
   st->sinc_table_length = 0;
+  st->sinc_entry = NULL;
   st->mem_alloc_size = 0;
   st->filt_len = 0;
   st->mem = 0;
   st->resampler_ptr = 0;
   st->use_full_sinc_table = use_full_sinc_table;
+  st->minimum_phase = 0;
 
   st->cutoff = 1.f;
   st->nb_channels = nb_channels;
@@ -1032,6 +1304,7 @@ speex_resampler_init_frac (spx_uint32_t nb_channels, spx_uint32_t ratio_num,
 
   st->use_sse = st->use_sse2 = 0;
   st->use_neon = 0;
+  st->use_avx2 = 0;
 #if defined HAVE_ORC && !defined DISABLE_ORC
   orc_init ();
   {
@@ -1047,6 +1320,12 @@ speex_resampler_init_frac (spx_uint32_t nb_channels, spx_uint32_t ratio_num,
     }
   }
 #endif
+#ifdef _USE_AVX2
+  /* ORC doesn't know about AVX2, ask the CPU directly */
+  if (st->use_sse && __builtin_cpu_supports ("avx2")
+      && __builtin_cpu_supports ("fma"))
+    st->use_avx2 = 1;
+#endif
 
   /* Per channel data */
   st->last_sample = (spx_int32_t *) speex_alloc (nb_channels * sizeof (int));
@@ -1085,7 +1364,7 @@ EXPORT void
 speex_resampler_destroy (SpeexResamplerState * st)
 {
   speex_free (st->mem);
-  speex_free (st->sinc_table);
+  sinc_table_release (st);
   speex_free (st->last_sample);
   speex_free (st->magic_samples);
   speex_free (st->samp_frac_num);
@@ -1279,6 +1558,256 @@ speex_resampler_process_int (SpeexResamplerState * st,
   return RESAMPLER_ERR_SUCCESS;
 }
 
+#ifndef FIXED_POINT
+/* All channels can be resampled together with the direct sinc table as long
+ * as they are at the same position in the stream, which is always the case
+ * unless the per-channel API was used on this state */
+static int
+speex_resampler_can_process_multi (SpeexResamplerState * st)
+{
+  spx_uint32_t i;
+
+  if (st->nb_channels < 2 || st->nb_channels > FIXED_STACK_ALLOC)
+    return 0;
+#ifdef DOUBLE_PRECISION
+  if (st->resampler_ptr != resampler_basic_direct_double)
+    return 0;
+#else
+  if (st->resampler_ptr != resampler_basic_direct_single
+      && st->resampler_ptr != resampler_basic_direct_double)
+    return 0;
+#endif
+  for (i = 0; i < st->nb_channels; i++) {
+    if (st->magic_samples[i] || st->last_sample[i] != st->last_sample[0]
+        || st->samp_frac_num[i] != st->samp_frac_num[0])
+      return 0;
+  }
+  return 1;
+}
+
+/* Applies one filter phase to the history of every channel and writes one
+ * interleaved output frame. Four channels are done per pass over the taps
+ * so that each tap is loaded once for all of them. */
+static void
+multi_product (SpeexResamplerState * st, const spx_word16_t * sinc,
+    const spx_word16_t * iptr, spx_word16_t * out)
+{
+  const int N = st->filt_len;
+  const spx_uint32_t channels = st->nb_channels;
+  const spx_uint32_t stride = st->mem_alloc_size;
+  spx_uint32_t c = 0;
+  int j;
+
+#ifndef DOUBLE_PRECISION
+  if (st->resampler_ptr == resampler_basic_direct_single) {
+#ifdef _USE_AVX2
+    if (st->use_avx2) {
+      inner_product_single_multi_avx2 (sinc, iptr, stride, N, channels, out);
+      return;
+    }
+#endif
+#if defined(OVERRIDE_INNER_PRODUCT_SINGLE_MULTI) && defined(_USE_SSE)
+    if (st->use_sse) {
+      inner_product_single_multi (sinc, iptr, stride, N, channels, out);
+      return;
+    }
+#endif
+    for (; c + 4 <= channels; c += 4) {
+      const spx_word16_t *i0 = iptr + c * stride;
+      const spx_word16_t *i1 = i0 + stride;
+      const spx_word16_t *i2 = i1 + stride;
+      const spx_word16_t *i3 = i2 + stride;
+      spx_word32_t accum[4] = { 0, 0, 0, 0 };
+
+      for (j = 0; j < N; j++) {
+        const spx_word16_t s = sinc[j];
+
+        accum[0] += MULT16_16 (s, i0[j]);
+        accum[1] += MULT16_16 (s, i1[j]);
+        accum[2] += MULT16_16 (s, i2[j]);
+        accum[3] += MULT16_16 (s, i3[j]);
+      }
+      out[c] = SATURATE32PSHR (accum[0], 15, 32767);
+      out[c + 1] = SATURATE32PSHR (accum[1], 15, 32767);
+      out[c + 2] = SATURATE32PSHR (accum[2], 15, 32767);
+      out[c + 3] = SATURATE32PSHR (accum[3], 15, 32767);
+    }
+    for (; c < channels; c++) {
+      const spx_word16_t *i0 = iptr + c * stride;
+      spx_word32_t sum = 0;
+
+      for (j = 0; j < N; j++)
+        sum += MULT16_16 (sinc[j], i0[j]);
+      out[c] = SATURATE32PSHR (sum, 15, 32767);
+    }
+    return;
+  }
+#endif
+
+  /* Same as above with a double-precision accumulator */
+#if defined(OVERRIDE_INNER_PRODUCT_DOUBLE) && defined(_USE_SSE2)
+  if (st->use_sse2) {
+    for (; c < channels; c++)
+      out[c] = PSHR32 (inner_product_double (sinc, iptr + c * stride, N), 15);
+    return;
+  }
+#endif
+  for (; c + 4 <= channels; c += 4) {
+    const spx_word16_t *i0 = iptr + c * stride;
+    const spx_word16_t *i1 = i0 + stride;
+    const spx_word16_t *i2 = i1 + stride;
+    const spx_word16_t *i3 = i2 + stride;
+    double accum[4] = { 0, 0, 0, 0 };
+
+    for (j = 0; j < N; j++) {
+      const double s = sinc[j];
+
+      accum[0] += s * i0[j];
+      accum[1] += s * i1[j];
+      accum[2] += s * i2[j];
+      accum[3] += s * i3[j];
+    }
+    out[c] = PSHR32 (accum[0], 15);
+    out[c + 1] = PSHR32 (accum[1], 15);
+    out[c + 2] = PSHR32 (accum[2], 15);
+    out[c + 3] = PSHR32 (accum[3], 15);
+  }
+  for (; c < channels; c++) {
+    const spx_word16_t *i0 = iptr + c * stride;
+    double sum = 0;
+
+    for (j = 0; j < N; j++)
+      sum += sinc[j] * i0[j];
+    out[c] = PSHR32 (sum, 15);
+  }
+}
+
+/* Like speex_resampler_process_native() but for all channels at once, the
+ * output is interleaved */
+static void
+speex_resampler_process_native_multi (SpeexResamplerState * st,
+    spx_uint32_t * in_len, spx_word16_t * out, spx_uint32_t * out_len)
+{
+  const int N = st->filt_len;
+  const spx_uint32_t channels = st->nb_channels;
+  const spx_word16_t *sinc_table = st->sinc_table;
+  const int int_advance = st->int_advance;
+  const int frac_advance = st->frac_advance;
+  const spx_uint32_t den_rate = st->den_rate;
+  int last_sample = st->last_sample[0];
+  spx_uint32_t samp_frac_num = st->samp_frac_num[0];
+  int out_sample = 0;
+  spx_uint32_t i, ilen;
+  int j;
+
+  st->started = 1;
+
+  while (!(last_sample >= (spx_int32_t) * in_len
+          || out_sample >= (spx_int32_t) * out_len)) {
+    multi_product (st, &sinc_table[samp_frac_num * N], &st->mem[last_sample],
+        &out[out_sample * channels]);
+    out_sample++;
+    last_sample += int_advance;
+    samp_frac_num += frac_advance;
+    if (samp_frac_num >= den_rate) {
+      samp_frac_num -= den_rate;
+      last_sample++;
+    }
+  }
+
+  if (last_sample < (spx_int32_t) * in_len)
+    *in_len = last_sample;
+  *out_len = out_sample;
+  ilen = *in_len;
+
+  for (i = 0; i < channels; i++) {
+    spx_word16_t *mem = st->mem + i * st->mem_alloc_size;
+
+    st->last_sample[i] = last_sample - ilen;
+    st->samp_frac_num[i] = samp_frac_num;
+    for (j = 0; j < N - 1; ++j)
+      mem[j] = mem[j + ilen];
+  }
+}
+
+/* Copies the next chunk of interleaved input into the per-channel filter
+ * memory, after the filt_len - 1 samples of history */
+#define DEINTERLEAVE_MULTI(st, in, ichunk) G_STMT_START {              \
+  const spx_uint32_t channels = (st)->nb_channels;                      \
+  spx_uint32_t c, k;                                                    \
+  for (c = 0; c < channels; c++) {                                      \
+    spx_word16_t *x = (st)->mem + c * (st)->mem_alloc_size +            \
+        (st)->filt_len - 1;                                             \
+    if (in) {                                                           \
+      for (k = 0; k < (ichunk); k++)                                    \
+        x[k] = (in)[k * channels + c];                                  \
+    } else {                                                            \
+      for (k = 0; k < (ichunk); k++)                                    \
+        x[k] = 0;                                                       \
+    }                                                                   \
+  }                                                                     \
+} G_STMT_END
+
+static int
+speex_resampler_process_interleaved_float_multi (SpeexResamplerState * st,
+    const spx_word16_t * in, spx_uint32_t * in_len, spx_word16_t * out,
+    spx_uint32_t * out_len)
+{
+  const spx_uint32_t channels = st->nb_channels;
+  const spx_uint32_t xlen = st->mem_alloc_size - (st->filt_len - 1);
+  spx_uint32_t ilen = *in_len;
+  spx_uint32_t olen = *out_len;
+
+  while (ilen && olen) {
+    spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
+    spx_uint32_t ochunk = olen;
+
+    DEINTERLEAVE_MULTI (st, in, ichunk);
+    speex_resampler_process_native_multi (st, &ichunk, out, &ochunk);
+    ilen -= ichunk;
+    olen -= ochunk;
+    out += ochunk * channels;
+    if (in)
+      in += ichunk * channels;
+  }
+  *in_len -= ilen;
+  *out_len -= olen;
+  return RESAMPLER_ERR_SUCCESS;
+}
+
+static int
+speex_resampler_process_interleaved_int_multi (SpeexResamplerState * st,
+    const spx_int16_t * in, spx_uint32_t * in_len, spx_int16_t * out,
+    spx_uint32_t * out_len)
+{
+  const spx_uint32_t channels = st->nb_channels;
+  const spx_uint32_t xlen = st->mem_alloc_size - (st->filt_len - 1);
+  const spx_uint32_t ylen = FIXED_STACK_ALLOC / channels;
+  spx_word16_t ystack[FIXED_STACK_ALLOC];
+  spx_uint32_t ilen = *in_len;
+  spx_uint32_t olen = *out_len;
+  spx_uint32_t j;
+
+  while (ilen && olen) {
+    spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
+    spx_uint32_t ochunk = (olen > ylen) ? ylen : olen;
+
+    DEINTERLEAVE_MULTI (st, in, ichunk);
+    speex_resampler_process_native_multi (st, &ichunk, ystack, &ochunk);
+    for (j = 0; j < ochunk * channels; j++)
+      out[j] = WORD2INT (ystack[j]);
+    ilen -= ichunk;
+    olen -= ochunk;
+    out += ochunk * channels;
+    if (in)
+      in += ichunk * channels;
+  }
+  *in_len -= ilen;
+  *out_len -= olen;
+  return RESAMPLER_ERR_SUCCESS;
+}
+#endif
+
 #ifdef DOUBLE_PRECISION
 EXPORT int
 speex_resampler_process_interleaved_float (SpeexResamplerState * st,
@@ -1293,6 +1822,13 @@ speex_resampler_process_interleaved_float (SpeexResamplerState * st,
   spx_uint32_t i;
   int istride_save, ostride_save;
   spx_uint32_t bak_len = *out_len;
+
+#ifndef FIXED_POINT
+  if (speex_resampler_can_process_multi (st))
+    return speex_resampler_process_interleaved_float_multi (st, in, in_len, out,
+        out_len);
+#endif
+
   istride_save = st->in_stride;
   ostride_save = st->out_stride;
   st->in_stride = st->out_stride = st->nb_channels;
@@ -1316,6 +1852,13 @@ speex_resampler_process_interleaved_int (SpeexResamplerState * st,
   spx_uint32_t i;
   int istride_save, ostride_save;
   spx_uint32_t bak_len = *out_len;
+
+#ifndef FIXED_POINT
+  if (speex_resampler_can_process_multi (st))
+    return speex_resampler_process_interleaved_int_multi (st, in, in_len, out,
+        out_len);
+#endif
+
   istride_save = st->in_stride;
   ostride_save = st->out_stride;
   st->in_stride = st->out_stride = st->nb_channels;
@@ -1373,7 +1916,8 @@ speex_resampler_set_rate_frac (SpeexResamplerState * st, spx_uint32_t ratio_num,
 
   if (old_den > 0) {
     for (i = 0; i < st->nb_channels; i++) {
-      st->samp_frac_num[i] = st->samp_frac_num[i] * st->den_rate / old_den;
+      st->samp_frac_num[i] =
+          (guint64) st->samp_frac_num[i] * st->den_rate / old_den;
       /* Safety net */
       if (st->samp_frac_num[i] >= st->den_rate)
         st->samp_frac_num[i] = st->den_rate - 1;
@@ -1385,6 +1929,38 @@ speex_resampler_set_rate_frac (SpeexResamplerState * st, spx_uint32_t ratio_num,
   return RESAMPLER_ERR_SUCCESS;
 }
 
+/* Denominator of the ratio while it is adjusted */
+#define RATE_ADJUST_DEN (1 << 24)
+
+EXPORT int
+speex_resampler_set_rate_adjust (SpeexResamplerState * st, double adjust)
+{
+  const double num =
+      (double) st->in_rate / st->out_rate * adjust * RATE_ADJUST_DEN;
+  spx_uint32_t i;
+
+  if (adjust <= 0 || num < 1 || num >= 4294967295.)
+    return RESAMPLER_ERR_INVALID_ARG;
+
+  for (i = 0; i < st->nb_channels; i++)
+    st->samp_frac_num[i] =
+        (guint64) st->samp_frac_num[i] * RATE_ADJUST_DEN / st->den_rate;
+
+  st->num_rate = (spx_uint32_t) (num + .5);
+  st->den_rate = RATE_ADJUST_DEN;
+  st->int_advance = st->num_rate / st->den_rate;
+  st->frac_advance = st->num_rate % st->den_rate;
+
+  /* The direct table has one phase per step of den_rate, switch to the
+   * interpolated one once. Later adjustments don't touch the filter. */
+  if (st->sinc_entry && st->sinc_entry->direct) {
+    st->use_full_sinc_table = 0;
+    update_filter (st);
+  }
+
+  return RESAMPLER_ERR_SUCCESS;
+}
+
 EXPORT void
 speex_resampler_get_ratio (SpeexResamplerState * st, spx_uint32_t * ratio_num,
     spx_uint32_t * ratio_den)
@@ -1442,13 +2018,15 @@ speex_resampler_get_output_stride (SpeexResamplerState * st,
 EXPORT int
 speex_resampler_get_input_latency (SpeexResamplerState * st)
 {
+  if (st->sinc_entry)
+    return st->sinc_entry->latency;
   return st->filt_len / 2;
 }
 
 EXPORT int
 speex_resampler_get_output_latency (SpeexResamplerState * st)
 {
-  return ((st->filt_len / 2) * st->den_rate +
+  return (speex_resampler_get_input_latency (st) * st->den_rate +
       (st->num_rate >> 1)) / st->num_rate;
 }
 
@@ -1464,12 +2042,32 @@ speex_resampler_get_sinc_filter_mode (SpeexResamplerState * st)
   return st->use_full_sinc_table;
 }
 
+EXPORT int
+speex_resampler_set_filter_phase (SpeexResamplerState * st, int minimum_phase)
+{
+  minimum_phase = (minimum_phase != 0);
+  if (st->minimum_phase == minimum_phase)
+    return RESAMPLER_ERR_SUCCESS;
+
+  st->minimum_phase = minimum_phase;
+  if (st->initialised)
+    update_filter (st);
+  return RESAMPLER_ERR_SUCCESS;
+}
+
+EXPORT int
+speex_resampler_get_filter_phase (SpeexResamplerState * st)
+{
+  return st->minimum_phase;
+}
+
 EXPORT int
 speex_resampler_skip_zeros (SpeexResamplerState * st)
 {
   spx_uint32_t i;
+  const spx_uint32_t latency = speex_resampler_get_input_latency (st);
   for (i = 0; i < st->nb_channels; i++)
-    st->last_sample[i] = st->filt_len / 2;
+    st->last_sample[i] = latency;
   return RESAMPLER_ERR_SUCCESS;
 }
 
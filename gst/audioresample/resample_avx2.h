@@ -0,0 +1,107 @@
+/**
+   @file resample_avx2.h
+   @brief Resampler functions (AVX2 version)
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* The rest of the file is compiled for the baseline instruction set, so
+   these functions enable AVX2 and FMA with a target attribute and are
+   only called after checking the CPU at runtime. The filter length is
+   always a multiple of 4 but not necessarily of 8. */
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+static AVX2_TARGET __m128 reduce_single_avx2(__m256 sum)
+{
+   return _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+}
+
+static AVX2_TARGET float inner_product_single_avx2(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i;
+   float ret;
+   __m256 sum = _mm256_setzero_ps();
+   __m128 s;
+   for (i=0;i+8<=len;i+=8)
+      sum = _mm256_fmadd_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i), sum);
+   s = reduce_single_avx2(sum);
+   if (i<len)
+      s = _mm_fmadd_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i), s);
+   s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+   s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+   _mm_store_ss(&ret, s);
+   return ret;
+}
+
+/* Same as inner_product_single_multi() but with 8 taps per iteration */
+static AVX2_TARGET void inner_product_single_multi_avx2(const float *a, const float *b, unsigned int stride, unsigned int len, unsigned int channels, float *out)
+{
+   unsigned int c = 0;
+   unsigned int i;
+   for (;c+4<=channels;c+=4)
+   {
+      const float *b0 = b + c*stride;
+      const float *b1 = b0 + stride;
+      const float *b2 = b1 + stride;
+      const float *b3 = b2 + stride;
+      __m256 sum0 = _mm256_setzero_ps();
+      __m256 sum1 = _mm256_setzero_ps();
+      __m256 sum2 = _mm256_setzero_ps();
+      __m256 sum3 = _mm256_setzero_ps();
+      __m128 s0, s1, s2, s3;
+      for (i=0;i+8<=len;i+=8)
+      {
+         __m256 t = _mm256_loadu_ps(a+i);
+         sum0 = _mm256_fmadd_ps(t, _mm256_loadu_ps(b0+i), sum0);
+         sum1 = _mm256_fmadd_ps(t, _mm256_loadu_ps(b1+i), sum1);
+         sum2 = _mm256_fmadd_ps(t, _mm256_loadu_ps(b2+i), sum2);
+         sum3 = _mm256_fmadd_ps(t, _mm256_loadu_ps(b3+i), sum3);
+      }
+      s0 = reduce_single_avx2(sum0);
+      s1 = reduce_single_avx2(sum1);
+      s2 = reduce_single_avx2(sum2);
+      s3 = reduce_single_avx2(sum3);
+      if (i<len)
+      {
+         __m128 t = _mm_loadu_ps(a+i);
+         s0 = _mm_fmadd_ps(t, _mm_loadu_ps(b0+i), s0);
+         s1 = _mm_fmadd_ps(t, _mm_loadu_ps(b1+i), s1);
+         s2 = _mm_fmadd_ps(t, _mm_loadu_ps(b2+i), s2);
+         s3 = _mm_fmadd_ps(t, _mm_loadu_ps(b3+i), s3);
+      }
+      _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+      s0 = _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3));
+      _mm_storeu_ps(out+c, s0);
+   }
+   for (;c<channels;c++)
+      out[c] = inner_product_single_avx2(a, b + c*stride, len);
+}
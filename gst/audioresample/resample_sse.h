@@ -55,6 +55,40 @@ static inline float inner_product_single(const float *a, const float *b, unsigne
    return ret;
 }
 
+/* Computes the dot product of the filter a with the histories of all
+   channels, which are stride samples apart, four channels at a time so
+   that every filter tap is only loaded once. The result is interleaved. */
+#define OVERRIDE_INNER_PRODUCT_SINGLE_MULTI
+static inline void inner_product_single_multi(const float *a, const float *b, unsigned int stride, unsigned int len, unsigned int channels, float *out)
+{
+   unsigned int c = 0;
+   int i;
+   for (;c+4<=channels;c+=4)
+   {
+      const float *b0 = b + c*stride;
+      const float *b1 = b0 + stride;
+      const float *b2 = b1 + stride;
+      const float *b3 = b2 + stride;
+      __m128 sum0 = _mm_setzero_ps();
+      __m128 sum1 = _mm_setzero_ps();
+      __m128 sum2 = _mm_setzero_ps();
+      __m128 sum3 = _mm_setzero_ps();
+      for (i=0;i<len;i+=4)
+      {
+         __m128 t = _mm_loadu_ps(a+i);
+         sum0 = _mm_add_ps(sum0, _mm_mul_ps(t, _mm_loadu_ps(b0+i)));
+         sum1 = _mm_add_ps(sum1, _mm_mul_ps(t, _mm_loadu_ps(b1+i)));
+         sum2 = _mm_add_ps(sum2, _mm_mul_ps(t, _mm_loadu_ps(b2+i)));
+         sum3 = _mm_add_ps(sum3, _mm_mul_ps(t, _mm_loadu_ps(b3+i)));
+      }
+      _MM_TRANSPOSE4_PS(sum0, sum1, sum2, sum3);
+      sum0 = _mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3));
+      _mm_storeu_ps(out+c, sum0);
+   }
+   for (;c<channels;c++)
+      out[c] = inner_product_single(a, b + c*stride, len);
+}
+
 #define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
 static inline float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac) {
   int i;
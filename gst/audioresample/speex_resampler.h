@@ -65,6 +65,7 @@
 #define speex_resampler_get_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_get_rate)
 #define speex_resampler_set_rate_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate_frac)
 #define speex_resampler_get_ratio CAT_PREFIX(RANDOM_PREFIX,_resampler_get_ratio)
+#define speex_resampler_set_rate_adjust CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate_adjust)
 #define speex_resampler_set_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_set_quality)
 #define speex_resampler_get_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_get_quality)
 #define speex_resampler_set_input_stride CAT_PREFIX(RANDOM_PREFIX,_resampler_set_input_stride)
@@ -75,6 +76,8 @@
 #define speex_resampler_get_output_latency CAT_PREFIX(RANDOM_PREFIX,_resampler_get_output_latency)
 #define speex_resampler_get_filt_len CAT_PREFIX(RANDOM_PREFIX,_resampler_get_filt_len)
 #define speex_resampler_get_sinc_filter_mode CAT_PREFIX(RANDOM_PREFIX,_resampler_get_sinc_filter_mode)
+#define speex_resampler_set_filter_phase CAT_PREFIX(RANDOM_PREFIX,_resampler_set_filter_phase)
+#define speex_resampler_get_filter_phase CAT_PREFIX(RANDOM_PREFIX,_resampler_get_filter_phase)
 #define speex_resampler_skip_zeros CAT_PREFIX(RANDOM_PREFIX,_resampler_skip_zeros)
 #define speex_resampler_reset_mem CAT_PREFIX(RANDOM_PREFIX,_resampler_reset_mem)
 #define speex_resampler_strerror CAT_PREFIX(RANDOM_PREFIX,_resampler_strerror)
@@ -310,6 +313,16 @@ void speex_resampler_get_ratio(SpeexResamplerState *st,
                                spx_uint32_t *ratio_num, 
                                spx_uint32_t *ratio_den);
 
+/** Scale the conversion ratio by adjust, e.g. to compensate for clock drift,
+ * without resetting the filter state. The interpolated sinc table is used
+ * from then on and further adjustments only change the step between
+ * output samples. The filter is not updated for the adjusted ratio, so only
+ * small adjustments should be made.
+ * @param st Resampler state
+ * @param adjust Factor applied to the ratio between input and output rate
+ */
+int speex_resampler_set_rate_adjust(SpeexResamplerState *st, double adjust);
+
 /** Set (change) the conversion quality.
  * @param st Resampler state
  * @param quality Resampling quality between 0 and 10, where 0 has poor 
@@ -375,6 +388,20 @@ int speex_resampler_get_filt_len(SpeexResamplerState *st);
  */
 int speex_resampler_get_sinc_filter_mode(SpeexResamplerState *st);
 
+/** Select a minimum-phase filter instead of the linear-phase windowed sinc.
+ * It has the same magnitude response but much lower latency, at the cost of
+ * phase distortion. The minimum-phase filter always uses the interpolated
+ * table.
+ * @param st Resampler state
+ * @param minimum_phase 1 for the minimum-phase filter, 0 for linear-phase
+ */
+int speex_resampler_set_filter_phase(SpeexResamplerState *st, int minimum_phase);
+
+/** Returns 1 if the minimum-phase filter is used, 0 otherwise
+ * @param st Resampler state
+ */
+int speex_resampler_get_filter_phase(SpeexResamplerState *st);
+
 /** Make sure that the first samples to go out of the resamplers don't have 
  * leading zeros. This is only useful before starting to use a newly created 
  * resampler. It is recommended to use that when resampling an audio file, as
@@ -29,6 +29,8 @@
 #define SPEEX_RESAMPLER_SINC_FILTER_DEFAULT SPEEX_RESAMPLER_SINC_FILTER_AUTO
 #define SPEEX_RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT (1 * 1048576)
 
+#define SPEEX_RESAMPLER_FILTER_PHASE_DEFAULT SPEEX_RESAMPLER_FILTER_PHASE_LINEAR
+
 enum
 {
   RESAMPLER_ERR_SUCCESS = 0,
@@ -46,6 +48,11 @@ typedef enum {
   SPEEX_RESAMPLER_SINC_FILTER_AUTO           = 2
 } SpeexResamplerSincFilterMode;
 
+typedef enum {
+  SPEEX_RESAMPLER_FILTER_PHASE_LINEAR        = 0,
+  SPEEX_RESAMPLER_FILTER_PHASE_MINIMUM       = 1
+} SpeexResamplerFilterPhase;
+
 typedef struct SpeexResamplerState_ SpeexResamplerState;
 
 typedef struct {
@@ -56,6 +63,8 @@ typedef struct {
   void (*destroy) (SpeexResamplerState * st);
   int (*process) (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+  int (*process_channel) (SpeexResamplerState * st, guint32 channel_index,
+    const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
   int (*set_rate) (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
   void (*get_rate) (SpeexResamplerState * st,
@@ -66,6 +75,8 @@ typedef struct {
   int (*get_filt_len) (SpeexResamplerState * st);
   int (*get_sinc_filter_mode) (SpeexResamplerState * st);
   int (*set_quality) (SpeexResamplerState * st, gint quality);
+  int (*set_filter_phase) (SpeexResamplerState * st, gint minimum_phase);
+  int (*set_rate_adjust) (SpeexResamplerState * st, gdouble adjust);
   int (*reset_mem) (SpeexResamplerState * st);
   int (*skip_zeros) (SpeexResamplerState * st);
   const char * (*strerror) (gint err);
@@ -79,6 +90,9 @@ SpeexResamplerState *resample_float_resampler_init (guint32 nb_channels,
 void resample_float_resampler_destroy (SpeexResamplerState * st);
 int resample_float_resampler_process_interleaved_float (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_float_resampler_process_float (SpeexResamplerState * st,
+    guint32 channel_index, const guint8 * in, guint32 * in_len, guint8 * out,
+    guint32 * out_len);
 int resample_float_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_float_resampler_get_rate (SpeexResamplerState * st,
@@ -89,6 +103,10 @@ int resample_float_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_float_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_float_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_float_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_float_resampler_set_filter_phase (SpeexResamplerState * st,
+    gint minimum_phase);
+int resample_float_resampler_set_rate_adjust (SpeexResamplerState * st,
+    gdouble adjust);
 int resample_float_resampler_reset_mem (SpeexResamplerState * st);
 int resample_float_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_float_resampler_strerror (gint err);
@@ -98,6 +116,7 @@ static const SpeexResampleFuncs float_funcs =
   resample_float_resampler_init,
   resample_float_resampler_destroy,
   resample_float_resampler_process_interleaved_float,
+  resample_float_resampler_process_float,
   resample_float_resampler_set_rate,
   resample_float_resampler_get_rate,
   resample_float_resampler_get_ratio,
@@ -105,6 +124,8 @@ static const SpeexResampleFuncs float_funcs =
   resample_float_resampler_get_filt_len,
   resample_float_resampler_get_sinc_filter_mode,
   resample_float_resampler_set_quality,
+  resample_float_resampler_set_filter_phase,
+  resample_float_resampler_set_rate_adjust,
   resample_float_resampler_reset_mem,
   resample_float_resampler_skip_zeros,
   resample_float_resampler_strerror,
@@ -118,6 +139,9 @@ SpeexResamplerState *resample_double_resampler_init (guint32 nb_channels,
 void resample_double_resampler_destroy (SpeexResamplerState * st);
 int resample_double_resampler_process_interleaved_float (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_double_resampler_process_float (SpeexResamplerState * st,
+    guint32 channel_index, const guint8 * in, guint32 * in_len, guint8 * out,
+    guint32 * out_len);
 int resample_double_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_double_resampler_get_rate (SpeexResamplerState * st,
@@ -128,6 +152,10 @@ int resample_double_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_double_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_double_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_double_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_double_resampler_set_filter_phase (SpeexResamplerState * st,
+    gint minimum_phase);
+int resample_double_resampler_set_rate_adjust (SpeexResamplerState * st,
+    gdouble adjust);
 int resample_double_resampler_reset_mem (SpeexResamplerState * st);
 int resample_double_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_double_resampler_strerror (gint err);
@@ -137,6 +165,7 @@ static const SpeexResampleFuncs double_funcs =
   resample_double_resampler_init,
   resample_double_resampler_destroy,
   resample_double_resampler_process_interleaved_float,
+  resample_double_resampler_process_float,
   resample_double_resampler_set_rate,
   resample_double_resampler_get_rate,
   resample_double_resampler_get_ratio,
@@ -144,6 +173,8 @@ static const SpeexResampleFuncs double_funcs =
   resample_double_resampler_get_filt_len,
   resample_double_resampler_get_sinc_filter_mode,
   resample_double_resampler_set_quality,
+  resample_double_resampler_set_filter_phase,
+  resample_double_resampler_set_rate_adjust,
   resample_double_resampler_reset_mem,
   resample_double_resampler_skip_zeros,
   resample_double_resampler_strerror,
@@ -157,6 +188,9 @@ SpeexResamplerState *resample_int_resampler_init (guint32 nb_channels,
 void resample_int_resampler_destroy (SpeexResamplerState * st);
 int resample_int_resampler_process_interleaved_int (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_int_resampler_process_int (SpeexResamplerState * st,
+    guint32 channel_index, const guint8 * in, guint32 * in_len, guint8 * out,
+    guint32 * out_len);
 int resample_int_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_int_resampler_get_rate (SpeexResamplerState * st,
@@ -167,6 +201,10 @@ int resample_int_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_int_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_int_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_int_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_int_resampler_set_filter_phase (SpeexResamplerState * st,
+    gint minimum_phase);
+int resample_int_resampler_set_rate_adjust (SpeexResamplerState * st,
+    gdouble adjust);
 int resample_int_resampler_reset_mem (SpeexResamplerState * st);
 int resample_int_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_int_resampler_strerror (gint err);
@@ -176,6 +214,7 @@ static const SpeexResampleFuncs int_funcs =
   resample_int_resampler_init,
   resample_int_resampler_destroy,
   resample_int_resampler_process_interleaved_int,
+  resample_int_resampler_process_int,
   resample_int_resampler_set_rate,
   resample_int_resampler_get_rate,
   resample_int_resampler_get_ratio,
@@ -183,6 +222,8 @@ static const SpeexResampleFuncs int_funcs =
   resample_int_resampler_get_filt_len,
   resample_int_resampler_get_sinc_filter_mode,
   resample_int_resampler_set_quality,
+  resample_int_resampler_set_filter_phase,
+  resample_int_resampler_set_rate_adjust,
   resample_int_resampler_reset_mem,
   resample_int_resampler_skip_zeros,
   resample_int_resampler_strerror,
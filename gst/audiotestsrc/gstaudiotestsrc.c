@@ -45,6 +45,7 @@
 #include <string.h>
 
 #include "gstaudiotestsrc.h"
+#include "gstaudiotestsrcorc.h"
 
 
 #define M_PI_M2 ( G_PI + G_PI )
@@ -56,11 +57,15 @@ GST_DEBUG_CATEGORY_STATIC (audio_test_src_debug);
 #define DEFAULT_WAVE                 GST_AUDIO_TEST_SRC_WAVE_SINE
 #define DEFAULT_FREQ                 440.0
 #define DEFAULT_VOLUME               0.8
+#define DEFAULT_BAND_LIMITED         FALSE
 #define DEFAULT_IS_LIVE              FALSE
 #define DEFAULT_TIMESTAMP_OFFSET     G_GINT64_CONSTANT (0)
 #define DEFAULT_CAN_ACTIVATE_PUSH    TRUE
 #define DEFAULT_CAN_ACTIVATE_PULL    FALSE
 
+/* number of samples generated and converted at once */
+#define BLOCK_SAMPLES                2048
+
 enum
 {
   PROP_0,
@@ -72,6 +77,7 @@ enum
   PROP_TIMESTAMP_OFFSET,
   PROP_CAN_ACTIVATE_PUSH,
   PROP_CAN_ACTIVATE_PULL,
+  PROP_BAND_LIMITED,
   PROP_LAST
 };
 
@@ -90,7 +96,7 @@ GST_STATIC_PAD_TEMPLATE ("src",
     GST_STATIC_CAPS ("audio/x-raw, "
         "format = (string) " FORMAT_STR ", "
         "layout = (string) interleaved, "
-        "rate = (int) [ 1, MAX ], " "channels = (int) [ 1, 2]")
+        "rate = (int) [ 1, MAX ], " "channels = (int) [ 1, MAX ]")
     );
 
 #define gst_audio_test_src_parent_class parent_class
@@ -202,6 +208,22 @@ gst_audio_test_src_class_init (GstAudioTestSrcClass * klass)
       g_param_spec_boolean ("can-activate-pull", "Can activate pull",
           "Can activate in pull mode", DEFAULT_CAN_ACTIVATE_PULL,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstAudioTestSrc:band-limited:
+   *
+   * Whether to band-limit the square, saw and triangle waves. Their
+   * discontinuities are then smoothed with polynomial corrections (PolyBLEP
+   * and PolyBLAMP), which removes most of the aliasing of the harmonics
+   * above half the sample rate at the cost of a few more operations per
+   * sample. The other waveforms are not affected.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_BAND_LIMITED,
+      g_param_spec_boolean ("band-limited", "Band-limited",
+          "Suppress the aliasing of the square, saw and triangle waves",
+          DEFAULT_BAND_LIMITED,
+          G_PARAM_READWRITE | GST_PARAM_CONTROLLABLE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_audio_test_src_src_template));
@@ -228,6 +250,7 @@ gst_audio_test_src_init (GstAudioTestSrc * src)
 {
   src->volume = DEFAULT_VOLUME;
   src->freq = DEFAULT_FREQ;
+  src->band_limited = DEFAULT_BAND_LIMITED;
 
   /* we operate in time */
   gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
@@ -239,6 +262,7 @@ gst_audio_test_src_init (GstAudioTestSrc * src)
   src->can_activate_pull = DEFAULT_CAN_ACTIVATE_PULL;
 
   src->gen = NULL;
+  src->block = NULL;
 
   src->wave = DEFAULT_WAVE;
   gst_base_src_set_blocksize (GST_BASE_SRC (src), -1);
@@ -253,6 +277,9 @@ gst_audio_test_src_finalize (GObject * object)
     g_rand_free (src->gen);
   src->gen = NULL;
 
+  g_free (src->block);
+  src->block = NULL;
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -261,6 +288,7 @@ gst_audio_test_src_fixate (GstBaseSrc * bsrc, GstCaps * caps)
 {
   GstAudioTestSrc *src = GST_AUDIO_TEST_SRC (bsrc);
   GstStructure *structure;
+  gint channels;
 
   caps = gst_caps_make_writable (caps);
 
@@ -276,6 +304,14 @@ gst_audio_test_src_fixate (GstBaseSrc * bsrc, GstCaps * caps)
   /* fixate to mono unless downstream requires stereo, for backwards compat */
   gst_structure_fixate_field_nearest_int (structure, "channels", 1);
 
+  /* more than two channels need a layout, leave them unpositioned unless
+   * downstream asked for one */
+  if (gst_structure_get_int (structure, "channels", &channels) && channels > 2
+      && !gst_structure_has_field_typed (structure, "channel-mask",
+          GST_TYPE_BITMASK))
+    gst_structure_set (structure, "channel-mask", GST_TYPE_BITMASK,
+        G_GUINT64_CONSTANT (0), NULL);
+
   caps = GST_BASE_SRC_CLASS (parent_class)->fixate (bsrc, caps);
 
   return caps;
@@ -294,6 +330,11 @@ gst_audio_test_src_setcaps (GstBaseSrc * basesrc, GstCaps * caps)
 
   src->info = info;
 
+  src->block_frames = MAX (1, BLOCK_SAMPLES / GST_AUDIO_INFO_CHANNELS (&info));
+  g_free (src->block);
+  src->block =
+      g_new (gdouble, src->block_frames * GST_AUDIO_INFO_CHANNELS (&info));
+
   gst_base_src_set_blocksize (basesrc,
       GST_AUDIO_INFO_BPF (&info) * src->samples_per_buffer);
   gst_audio_test_src_change_wave (src);
@@ -355,202 +396,250 @@ error:
   }
 }
 
-#define DEFINE_SINE(type,scale) \
-static void \
-gst_audio_test_src_create_sine_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble step, amp; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
-  amp = src->volume * scale; \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    for (c = 0; c < channels; ++c) { \
-      samples[i++] = (g##type) (sin (src->accumulator) * amp); \
-    } \
-  } \
+/* The waveforms are generated in blocks of values between -1.0 and 1.0,
+ * which are then scaled by the volume and converted to the output format in
+ * one pass. Periodic waveforms compute one value per frame and copy it to
+ * all channels, noise is generated for every sample. */
+
+/*
+ * gst_audio_test_src_advance_phase:
+ * Store the phase, in periods, of the next @n frames in @values and return
+ * the phase increment per frame.
+ */
+static gdouble
+gst_audio_test_src_advance_phase (GstAudioTestSrc * src, gdouble * values,
+    gint n)
+{
+  gdouble phase, step;
+  gint i;
+
+  phase = src->accumulator;
+  step = src->freq / GST_AUDIO_INFO_RATE (&src->info);
+
+  for (i = 0; i < n; i++) {
+    phase += step;
+    if (phase >= 1.0)
+      phase -= floor (phase);
+    values[i] = phase;
+  }
+  src->accumulator = phase;
+
+  return step;
 }
 
-DEFINE_SINE (int16, 32767.0);
-DEFINE_SINE (int32, 2147483647.0);
-DEFINE_SINE (float, 1.0);
-DEFINE_SINE (double, 1.0);
+/*
+ * gst_audio_test_src_spread:
+ * Copy the first @n values to all channels of @n interleaved frames. This
+ * starts at the last frame so that no value is overwritten before it was
+ * copied.
+ */
+static void
+gst_audio_test_src_spread (GstAudioTestSrc * src, gdouble * values, gint n)
+{
+  gint i, c, channels;
 
-static const ProcessFunc sine_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_sine_int16,
-  (ProcessFunc) gst_audio_test_src_create_sine_int32,
-  (ProcessFunc) gst_audio_test_src_create_sine_float,
-  (ProcessFunc) gst_audio_test_src_create_sine_double
-};
+  channels = GST_AUDIO_INFO_CHANNELS (&src->info);
+  if (channels == 1)
+    return;
 
-#define DEFINE_SQUARE(type,scale) \
-static void \
-gst_audio_test_src_create_square_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble step, amp; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
-  amp = src->volume * scale; \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    for (c = 0; c < channels; ++c) { \
-      samples[i++] = (g##type) ((src->accumulator < G_PI) ? amp : -amp); \
-    } \
-  } \
+  for (i = n - 1; i >= 0; i--) {
+    gdouble value = values[i];
+    gdouble *frame = values + i * channels;
+
+    for (c = 0; c < channels; c++)
+      frame[c] = value;
+  }
 }
 
-DEFINE_SQUARE (int16, 32767.0);
-DEFINE_SQUARE (int32, 2147483647.0);
-DEFINE_SQUARE (float, 1.0);
-DEFINE_SQUARE (double, 1.0);
+/* sin (2 * pi * t) for a phase t in [0, 1). The phase is folded into
+ * [-0.25, 0.25], where the Taylor series up to x^17 is accurate to better
+ * than 1e-13. There are no branches so that loops over it get vectorized. */
+static inline gdouble
+gst_audio_test_src_sin (gdouble t)
+{
+  gdouble x, x2;
+
+  x = 0.5 - t;
+  x = (x > 0.25) ? 0.5 - x : ((x < -0.25) ? -0.5 - x : x);
+  x *= M_PI_M2;
+  x2 = x * x;
+
+  return x * (1.0 + x2 * (-1.0 / 6.0 + x2 * (1.0 / 120.0 +
+              x2 * (-1.0 / 5040.0 + x2 * (1.0 / 362880.0 +
+                      x2 * (-1.0 / 39916800.0 + x2 * (1.0 / 6227020800.0 +
+                              x2 * (-1.0 / 1307674368000.0 +
+                                  x2 / 355687428096000.0))))))));
+}
 
-static const ProcessFunc square_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_square_int16,
-  (ProcessFunc) gst_audio_test_src_create_square_int32,
-  (ProcessFunc) gst_audio_test_src_create_square_float,
-  (ProcessFunc) gst_audio_test_src_create_square_double
-};
+static void
+gst_audio_test_src_generate_sine (GstAudioTestSrc * src, gdouble * values,
+    gint offset, gint n)
+{
+  gint i;
 
-#define DEFINE_SAW(type,scale) \
-static void \
-gst_audio_test_src_create_saw_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble step, amp; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
-  amp = (src->volume * scale) / G_PI; \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    if (src->accumulator < G_PI) { \
-      for (c = 0; c < channels; ++c) \
-        samples[i++] = (g##type) (src->accumulator * amp); \
-    } else { \
-      for (c = 0; c < channels; ++c) \
-        samples[i++] = (g##type) ((M_PI_M2 - src->accumulator) * -amp); \
-    } \
-  } \
+  gst_audio_test_src_advance_phase (src, values, n);
+  for (i = 0; i < n; i++)
+    values[i] = gst_audio_test_src_sin (values[i]);
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_SAW (int16, 32767.0);
-DEFINE_SAW (int32, 2147483647.0);
-DEFINE_SAW (float, 1.0);
-DEFINE_SAW (double, 1.0);
+/* Band-limited square, saw and triangle waves: the naive waveforms are
+ * corrected around their discontinuities with the two sample polynomial
+ * residuals of a band-limited step (PolyBLEP) and, for the corners of the
+ * triangle, of a band-limited ramp (PolyBLAMP). @t is the phase, @dt the
+ * phase increment per frame. */
+static inline gdouble
+gst_audio_test_src_poly_blep (gdouble t, gdouble dt)
+{
+  if (t < dt) {
+    t /= dt;
+    return t + t - t * t - 1.0;
+  } else if (t > 1.0 - dt) {
+    t = (t - 1.0) / dt;
+    return t * t + t + t + 1.0;
+  }
+  return 0.0;
+}
 
-static const ProcessFunc saw_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_saw_int16,
-  (ProcessFunc) gst_audio_test_src_create_saw_int32,
-  (ProcessFunc) gst_audio_test_src_create_saw_float,
-  (ProcessFunc) gst_audio_test_src_create_saw_double
-};
+/* @d is the distance from the corner in periods, between -0.5 and 0.5 */
+static inline gdouble
+gst_audio_test_src_poly_blamp (gdouble d, gdouble dt)
+{
+  d = 1.0 - fabs (d) / dt;
 
-#define DEFINE_TRIANGLE(type,scale) \
-static void \
-gst_audio_test_src_create_triangle_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble step, amp; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
-  amp = (src->volume * scale) / G_PI_2; \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    if (src->accumulator < (G_PI_2)) { \
-      for (c = 0; c < channels; ++c) \
-        samples[i++] = (g##type) (src->accumulator * amp); \
-    } else if (src->accumulator < (G_PI * 1.5)) { \
-      for (c = 0; c < channels; ++c) \
-        samples[i++] = (g##type) ((src->accumulator - G_PI) * -amp); \
-    } else { \
-      for (c = 0; c < channels; ++c) \
-        samples[i++] = (g##type) ((M_PI_M2 - src->accumulator) * -amp); \
-    } \
-  } \
+  return (d > 0.0) ? d * d * d * (1.0 / 6.0) : 0.0;
+}
+
+static void
+gst_audio_test_src_generate_square (GstAudioTestSrc * src, gdouble * values,
+    gint offset, gint n)
+{
+  gdouble dt;
+  gint i;
+
+  dt = gst_audio_test_src_advance_phase (src, values, n);
+  dt = MIN (dt, 0.5);
+
+  if (src->band_limited) {
+    for (i = 0; i < n; i++) {
+      gdouble t = values[i];
+      gdouble u = (t < 0.5) ? t + 0.5 : t - 0.5;
+
+      values[i] = ((t < 0.5) ? 1.0 : -1.0) +
+          gst_audio_test_src_poly_blep (t, dt) -
+          gst_audio_test_src_poly_blep (u, dt);
+    }
+  } else {
+    for (i = 0; i < n; i++)
+      values[i] = (values[i] < 0.5) ? 1.0 : -1.0;
+  }
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_TRIANGLE (int16, 32767.0);
-DEFINE_TRIANGLE (int32, 2147483647.0);
-DEFINE_TRIANGLE (float, 1.0);
-DEFINE_TRIANGLE (double, 1.0);
+static void
+gst_audio_test_src_generate_saw (GstAudioTestSrc * src, gdouble * values,
+    gint offset, gint n)
+{
+  gdouble dt;
+  gint i;
 
-static const ProcessFunc triangle_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_triangle_int16,
-  (ProcessFunc) gst_audio_test_src_create_triangle_int32,
-  (ProcessFunc) gst_audio_test_src_create_triangle_float,
-  (ProcessFunc) gst_audio_test_src_create_triangle_double
-};
+  dt = gst_audio_test_src_advance_phase (src, values, n);
+  dt = MIN (dt, 0.5);
 
-#define DEFINE_SILENCE(type) \
-static void \
-gst_audio_test_src_create_silence_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  memset (samples, 0, src->generate_samples_per_buffer * sizeof (g##type) * src->info.channels); \
+  /* the saw starts at 0 and jumps from 1 to -1 at half the period */
+  if (src->band_limited) {
+    for (i = 0; i < n; i++) {
+      gdouble u = (values[i] < 0.5) ? values[i] + 0.5 : values[i] - 0.5;
+
+      values[i] = u + u - 1.0 - gst_audio_test_src_poly_blep (u, dt);
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      gdouble u = (values[i] < 0.5) ? values[i] + 0.5 : values[i] - 0.5;
+
+      values[i] = u + u - 1.0;
+    }
+  }
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_SILENCE (int16);
-DEFINE_SILENCE (int32);
-DEFINE_SILENCE (float);
-DEFINE_SILENCE (double);
+static void
+gst_audio_test_src_generate_triangle (GstAudioTestSrc * src, gdouble * values,
+    gint offset, gint n)
+{
+  gdouble dt;
+  gint i;
 
-static const ProcessFunc silence_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_silence_int16,
-  (ProcessFunc) gst_audio_test_src_create_silence_int32,
-  (ProcessFunc) gst_audio_test_src_create_silence_float,
-  (ProcessFunc) gst_audio_test_src_create_silence_double
-};
+  dt = gst_audio_test_src_advance_phase (src, values, n);
+  dt = MIN (dt, 0.5);
 
-#define DEFINE_WHITE_NOISE(type,scale) \
-static void \
-gst_audio_test_src_create_white_noise_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c; \
-  gdouble amp = (src->volume * scale); \
-  gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    for (c = 0; c < channels; ++c) \
-      samples[i++] = (g##type) (amp * g_rand_double_range (src->gen, -1.0, 1.0)); \
-  } \
+  /* the triangle starts at 0, the peak is at a quarter of the period where
+   * u is 0.5 and the trough at three quarters where u is 0 */
+  if (src->band_limited) {
+    for (i = 0; i < n; i++) {
+      gdouble u = (values[i] < 0.75) ? values[i] + 0.25 : values[i] - 0.75;
+
+      values[i] = 1.0 - 4.0 * fabs (u - 0.5) + 8.0 * dt *
+          (gst_audio_test_src_poly_blamp ((u < 0.5) ? u : u - 1.0, dt) -
+          gst_audio_test_src_poly_blamp (u - 0.5, dt));
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      gdouble u = (values[i] < 0.75) ? values[i] + 0.25 : values[i] - 0.75;
+
+      values[i] = 1.0 - 4.0 * fabs (u - 0.5);
+    }
+  }
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_WHITE_NOISE (int16, 32767.0);
-DEFINE_WHITE_NOISE (int32, 2147483647.0);
-DEFINE_WHITE_NOISE (float, 1.0);
-DEFINE_WHITE_NOISE (double, 1.0);
+/* Noise is generated with an inline xorshift64* generator that is seeded
+ * from the GRand, which is much faster than calling into GRand for every
+ * sample */
+static void
+gst_audio_test_src_init_random (GstAudioTestSrc * src)
+{
+  if (!(src->gen))
+    src->gen = g_rand_new ();
+
+  /* the state must not be 0 */
+  src->rand_state = ((guint64) g_rand_int (src->gen) << 32) |
+      g_rand_int (src->gen) | 1;
+}
 
-static const ProcessFunc white_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_white_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_white_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_white_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_white_noise_double
-};
+static inline guint64
+gst_audio_test_src_random (guint64 * state)
+{
+  guint64 x = *state;
+
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *state = x;
+
+  return x * G_GUINT64_CONSTANT (0x2545F4914F6CDD1D);
+}
+
+/* uniformly distributed in [-1.0, 1.0) */
+static inline gdouble
+gst_audio_test_src_random_double (guint64 * state)
+{
+  return ((gint64) gst_audio_test_src_random (state) >> 11) *
+      (1.0 / 4503599627370496.0);
+}
+
+static void
+gst_audio_test_src_generate_white_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  guint64 state = src->rand_state;
+  gint i;
+
+  n *= GST_AUDIO_INFO_CHANNELS (&src->info);
+  for (i = 0; i < n; i++)
+    values[i] = gst_audio_test_src_random_double (&state);
+  src->rand_state = state;
+}
 
 /* pink noise calculation is based on
  * http://www.firstpr.com.au/dsp/pink-noise/phil_burk_19990905_patest_pink.c
@@ -576,313 +665,232 @@ gst_audio_test_src_init_pink_noise (GstAudioTestSrc * src)
   src->pink.running_sum = 0;
 }
 
-/* Generate Pink noise values between -1.0 and +1.0 */
-static gdouble
-gst_audio_test_src_generate_pink_noise_value (GstAudioTestSrc * src)
+/* signed random value of PINK_RANDOM_BITS bits */
+#define PINK_RANDOM(state) \
+  ((glong) ((gint32) (gst_audio_test_src_random (state) >> 32) >> \
+      (32 - PINK_RANDOM_BITS)))
+
+static void
+gst_audio_test_src_generate_pink_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
 {
   GstPinkNoise *pink = &src->pink;
+  guint64 state = src->rand_state;
   glong new_random;
-  glong sum;
-
-  /* Increment and mask index. */
-  pink->index = (pink->index + 1) & pink->index_mask;
-
-  /* If index is zero, don't update any random values. */
-  if (pink->index != 0) {
-    /* Determine how many trailing zeros in PinkIndex. */
-    /* This algorithm will hang if n==0 so test first. */
-    gint num_zeros = 0;
-    gint n = pink->index;
+  gint i;
 
-    while ((n & 1) == 0) {
-      n = n >> 1;
-      num_zeros++;
+  n *= GST_AUDIO_INFO_CHANNELS (&src->info);
+  for (i = 0; i < n; i++) {
+    /* Increment and mask index. */
+    pink->index = (pink->index + 1) & pink->index_mask;
+
+    /* If index is zero, don't update any random values. */
+    if (pink->index != 0) {
+      /* Replace the row indexed by the number of trailing zeros of the
+       * index. Subtract and add back to RunningSum instead of adding all the
+       * random values together. Only one changes each time.
+       */
+      gint num_zeros = g_bit_nth_lsf (pink->index, -1);
+
+      pink->running_sum -= pink->rows[num_zeros];
+      new_random = PINK_RANDOM (&state);
+      pink->running_sum += new_random;
+      pink->rows[num_zeros] = new_random;
     }
 
-    /* Replace the indexed ROWS random value.
-     * Subtract and add back to RunningSum instead of adding all the random
-     * values together. Only one changes each time.
-     */
-    pink->running_sum -= pink->rows[num_zeros];
-    new_random = 32768.0 - (65536.0 * (gulong) g_rand_int (src->gen)
-        / (G_MAXUINT32 + 1.0));
-    pink->running_sum += new_random;
-    pink->rows[num_zeros] = new_random;
+    /* Add extra white noise value and scale to range of -1.0 to 0.9999. */
+    new_random = PINK_RANDOM (&state);
+    values[i] = pink->scalar * (pink->running_sum + new_random);
   }
-
-  /* Add extra white noise value. */
-  new_random = 32768.0 - (65536.0 * (gulong) g_rand_int (src->gen)
-      / (G_MAXUINT32 + 1.0));
-  sum = pink->running_sum + new_random;
-
-  /* Scale to range of -1.0 to 0.9999. */
-  return (pink->scalar * sum);
+  src->rand_state = state;
 }
 
-#define DEFINE_PINK(type, scale) \
-static void \
-gst_audio_test_src_create_pink_noise_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble amp; \
-  \
-  amp = src->volume * scale; \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    for (c = 0; c < channels; ++c) { \
-      samples[i++] = \
-        (g##type) (gst_audio_test_src_generate_pink_noise_value (src) * \
-        amp); \
-    } \
-  } \
-}
-
-DEFINE_PINK (int16, 32767.0);
-DEFINE_PINK (int32, 2147483647.0);
-DEFINE_PINK (float, 1.0);
-DEFINE_PINK (double, 1.0);
-
-static const ProcessFunc pink_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_pink_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_pink_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_pink_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_pink_noise_double
-};
-
 static void
 gst_audio_test_src_init_sine_table (GstAudioTestSrc * src)
 {
   gint i;
   gdouble ang = 0.0;
   gdouble step = M_PI_M2 / 1024.0;
-  gdouble amp = src->volume;
 
   for (i = 0; i < 1024; i++) {
-    src->wave_table[i] = sin (ang) * amp;
+    src->wave_table[i] = sin (ang);
     ang += step;
   }
 }
 
-#define DEFINE_SINE_TABLE(type,scale) \
-static void \
-gst_audio_test_src_create_sine_table_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels; \
-  gdouble step, scl; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
-  scl = 1024.0 / M_PI_M2; \
-  \
-  i = 0; \
-  while (i < (src->generate_samples_per_buffer * channels)) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    for (c = 0; c < channels; ++c) \
-      samples[i++] = (g##type) scale * src->wave_table[(gint) (src->accumulator * scl)]; \
-  } \
+static void
+gst_audio_test_src_generate_sine_table (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  gint i;
+
+  gst_audio_test_src_advance_phase (src, values, n);
+  for (i = 0; i < n; i++)
+    values[i] = src->wave_table[(gint) (values[i] * 1024.0)];
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_SINE_TABLE (int16, 32767.0);
-DEFINE_SINE_TABLE (int32, 2147483647.0);
-DEFINE_SINE_TABLE (float, 1.0);
-DEFINE_SINE_TABLE (double, 1.0);
+static void
+gst_audio_test_src_generate_ticks (GstAudioTestSrc * src, gdouble * values,
+    gint offset, gint n)
+{
+  gint i, samplerate;
 
-static const ProcessFunc sine_table_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_sine_table_int16,
-  (ProcessFunc) gst_audio_test_src_create_sine_table_int32,
-  (ProcessFunc) gst_audio_test_src_create_sine_table_float,
-  (ProcessFunc) gst_audio_test_src_create_sine_table_double
-};
+  samplerate = GST_AUDIO_INFO_RATE (&src->info);
 
-#define DEFINE_TICKS(type,scale) \
-static void \
-gst_audio_test_src_create_tick_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c, channels, samplerate; \
-  gdouble step, scl; \
-  \
-  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  samplerate = GST_AUDIO_INFO_RATE (&src->info); \
-  step = M_PI_M2 * src->freq / samplerate; \
-  scl = 1024.0 / M_PI_M2; \
-  \
-  for (i = 0; i < src->generate_samples_per_buffer; i++) { \
-    src->accumulator += step; \
-    if (src->accumulator >= M_PI_M2) \
-      src->accumulator -= M_PI_M2; \
-    \
-    if ((src->next_sample + i)%samplerate < 1600) { \
-      for (c = 0; c < channels; ++c) \
-        samples[(i * channels) + c] = (g##type) scale * src->wave_table[(gint) (src->accumulator * scl)]; \
-    } else { \
-      for (c = 0; c < channels; ++c) \
-        samples[(i * channels) + c] = 0; \
-    } \
-  } \
+  gst_audio_test_src_advance_phase (src, values, n);
+  for (i = 0; i < n; i++) {
+    if ((src->next_sample + offset + i) % samplerate < 1600)
+      values[i] = src->wave_table[(gint) (values[i] * 1024.0)];
+    else
+      values[i] = 0.0;
+  }
+  gst_audio_test_src_spread (src, values, n);
 }
 
-DEFINE_TICKS (int16, 32767.0);
-DEFINE_TICKS (int32, 2147483647.0);
-DEFINE_TICKS (float, 1.0);
-DEFINE_TICKS (double, 1.0);
-
-static const ProcessFunc tick_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_tick_int16,
-  (ProcessFunc) gst_audio_test_src_create_tick_int32,
-  (ProcessFunc) gst_audio_test_src_create_tick_float,
-  (ProcessFunc) gst_audio_test_src_create_tick_double
-};
-
 /* Gaussian white noise using Box-Muller algorithm.  unit variance
  * normally-distributed random numbers are generated in pairs as the real
  * and imaginary parts of a compex random variable with
  * uniformly-distributed argument and \chi^{2}-distributed modulus.
  */
+static void
+gst_audio_test_src_generate_gaussian_white_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  guint64 state = src->rand_state;
+  gint i;
 
-#define DEFINE_GAUSSIAN_WHITE_NOISE(type,scale) \
-static void \
-gst_audio_test_src_create_gaussian_white_noise_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c; \
-  gdouble amp = (src->volume * scale); \
-  gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  \
-  for (i = 0; i < src->generate_samples_per_buffer * channels; ) { \
-    for (c = 0; c < channels; ++c) { \
-      gdouble mag = sqrt (-2 * log (1.0 - g_rand_double (src->gen))); \
-      gdouble phs = g_rand_double_range (src->gen, 0.0, M_PI_M2); \
-      \
-      samples[i++] = (g##type) (amp * mag * cos (phs)); \
-      if (++c >= channels) \
-        break; \
-      samples[i++] = (g##type) (amp * mag * sin (phs)); \
-    } \
-  } \
+  n *= GST_AUDIO_INFO_CHANNELS (&src->info);
+  for (i = 0; i < n; i += 2) {
+    /* both uniformly distributed in [0.0, 1.0) */
+    gdouble u = (gst_audio_test_src_random (&state) >> 11) *
+        (1.0 / 9007199254740992.0);
+    gdouble phs = (gst_audio_test_src_random (&state) >> 11) *
+        (1.0 / 9007199254740992.0);
+    gdouble mag = sqrt (-2 * log (1.0 - u));
+
+    /* cos (x) is sin (x + pi / 2) */
+    values[i] = mag * gst_audio_test_src_sin ((phs < 0.75) ? phs + 0.25 :
+        phs - 0.75);
+    if (i + 1 < n)
+      values[i + 1] = mag * gst_audio_test_src_sin (phs);
+  }
+  src->rand_state = state;
 }
 
-DEFINE_GAUSSIAN_WHITE_NOISE (int16, 32767.0);
-DEFINE_GAUSSIAN_WHITE_NOISE (int32, 2147483647.0);
-DEFINE_GAUSSIAN_WHITE_NOISE (float, 1.0);
-DEFINE_GAUSSIAN_WHITE_NOISE (double, 1.0);
-
-static const ProcessFunc gaussian_white_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_gaussian_white_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_gaussian_white_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_gaussian_white_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_gaussian_white_noise_double
-};
-
 /* Brownian (Red) Noise: noise where the power density decreases by 6 dB per
  * octave with increasing frequency
  *
  * taken from http://vellocet.com/dsp/noise/VRand.html
  * by Andrew Simper of Vellocet (andy@vellocet.com)
  */
+static void
+gst_audio_test_src_generate_red_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  guint64 state = src->rand_state;
+  gdouble red = src->red.state;
+  gint i;
 
-#define DEFINE_RED_NOISE(type,scale) \
-static void \
-gst_audio_test_src_create_red_noise_##type (GstAudioTestSrc * src, g##type * samples) \
-{ \
-  gint i, c; \
-  gdouble amp = (src->volume * scale); \
-  gdouble state = src->red.state; \
-  gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  \
-  for (i = 0; i < src->generate_samples_per_buffer * channels; ) { \
-    for (c = 0; c < channels; ++c) { \
-      while (TRUE) { \
-        gdouble r = g_rand_double_range (src->gen, -1.0, 1.0); \
-        state += r; \
-        if (state < -8.0f || state > 8.0f) state -= r; \
-        else break; \
-      } \
-      samples[i++] = (g##type) (amp * state * 0.0625f); /* /16.0 */ \
-    } \
-  } \
-  src->red.state = state; \
+  n *= GST_AUDIO_INFO_CHANNELS (&src->info);
+  for (i = 0; i < n; i++) {
+    while (TRUE) {
+      gdouble r = gst_audio_test_src_random_double (&state);
+
+      red += r;
+      if (red < -8.0f || red > 8.0f)
+        red -= r;
+      else
+        break;
+    }
+    values[i] = red * 0.0625f;  /* /16.0 */
+  }
+  src->red.state = red;
+  src->rand_state = state;
 }
 
-DEFINE_RED_NOISE (int16, 32767.0);
-DEFINE_RED_NOISE (int32, 2147483647.0);
-DEFINE_RED_NOISE (float, 1.0);
-DEFINE_RED_NOISE (double, 1.0);
+/* Blue and violet noise: apply spectral inversion to pink and red noise by
+ * flipping the sign of every other frame */
+static void
+gst_audio_test_src_invert_spectrum (GstAudioTestSrc * src, gdouble * values,
+    gint n)
+{
+  gint i, c, channels;
 
-static const ProcessFunc red_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_red_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_red_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_red_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_red_noise_double
-};
+  channels = GST_AUDIO_INFO_CHANNELS (&src->info);
 
-/* Blue Noise: apply spectral inversion to pink noise */
+  for (i = 0; i < n; i++) {
+    for (c = 0; c < channels; c++)
+      *values++ *= src->flip;
+    src->flip = -src->flip;
+  }
+}
 
-#define DEFINE_BLUE_NOISE(type) \
+static void
+gst_audio_test_src_generate_blue_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  gst_audio_test_src_generate_pink_noise (src, values, offset, n);
+  gst_audio_test_src_invert_spectrum (src, values, n);
+}
+
+static void
+gst_audio_test_src_generate_violet_noise (GstAudioTestSrc * src,
+    gdouble * values, gint offset, gint n)
+{
+  gst_audio_test_src_generate_red_noise (src, values, offset, n);
+  gst_audio_test_src_invert_spectrum (src, values, n);
+}
+
+#define DEFINE_PROCESS(type,fmt,scale) \
 static void \
-gst_audio_test_src_create_blue_noise_##type (GstAudioTestSrc * src, g##type * samples) \
+gst_audio_test_src_process_##type (GstAudioTestSrc * src, g##type * samples) \
 { \
-  gint i, c; \
-  static gdouble flip=1.0; \
-  gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
+  gint i, n, channels; \
+  gdouble amp; \
+  \
+  channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
+  amp = src->volume * scale; \
   \
-  gst_audio_test_src_create_pink_noise_##type (src, samples); \
-  for (i = 0; i < src->generate_samples_per_buffer * channels; ) { \
-    for (c = 0; c < channels; ++c) { \
-      samples[i++] *= flip; \
-    } \
-    flip *= -1.0; \
+  for (i = 0; i < src->generate_samples_per_buffer; i += n) { \
+    n = MIN (src->block_frames, src->generate_samples_per_buffer - i); \
+    src->generate (src, src->block, i, n); \
+    audiotestsrc_orc_scale_f64_##fmt (samples, src->block, amp, n * channels); \
+    samples += n * channels; \
   } \
 }
 
-DEFINE_BLUE_NOISE (int16);
-DEFINE_BLUE_NOISE (int32);
-DEFINE_BLUE_NOISE (float);
-DEFINE_BLUE_NOISE (double);
+DEFINE_PROCESS (int16, s16, 32767.0);
+DEFINE_PROCESS (int32, s32, 2147483647.0);
+DEFINE_PROCESS (float, f32, 1.0);
+DEFINE_PROCESS (double, f64, 1.0);
 
-static const ProcessFunc blue_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_blue_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_blue_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_blue_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_blue_noise_double
+static const ProcessFunc process_funcs[] = {
+  (ProcessFunc) gst_audio_test_src_process_int16,
+  (ProcessFunc) gst_audio_test_src_process_int32,
+  (ProcessFunc) gst_audio_test_src_process_float,
+  (ProcessFunc) gst_audio_test_src_process_double
 };
 
-
-/* Violet Noise: apply spectral inversion to red noise */
-
-#define DEFINE_VIOLET_NOISE(type) \
+#define DEFINE_SILENCE(type) \
 static void \
-gst_audio_test_src_create_violet_noise_##type (GstAudioTestSrc * src, g##type * samples) \
+gst_audio_test_src_create_silence_##type (GstAudioTestSrc * src, g##type * samples) \
 { \
-  gint i, c; \
-  static gdouble flip=1.0; \
-  gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
-  \
-  gst_audio_test_src_create_red_noise_##type (src, samples); \
-  for (i = 0; i < src->generate_samples_per_buffer * channels; ) { \
-    for (c = 0; c < channels; ++c) { \
-      samples[i++] *= flip; \
-    } \
-    flip *= -1.0; \
-  } \
+  memset (samples, 0, src->generate_samples_per_buffer * sizeof (g##type) * src->info.channels); \
 }
 
-DEFINE_VIOLET_NOISE (int16);
-DEFINE_VIOLET_NOISE (int32);
-DEFINE_VIOLET_NOISE (float);
-DEFINE_VIOLET_NOISE (double);
+DEFINE_SILENCE (int16);
+DEFINE_SILENCE (int32);
+DEFINE_SILENCE (float);
+DEFINE_SILENCE (double);
 
-static const ProcessFunc violet_noise_funcs[] = {
-  (ProcessFunc) gst_audio_test_src_create_violet_noise_int16,
-  (ProcessFunc) gst_audio_test_src_create_violet_noise_int32,
-  (ProcessFunc) gst_audio_test_src_create_violet_noise_float,
-  (ProcessFunc) gst_audio_test_src_create_violet_noise_double
+static const ProcessFunc silence_funcs[] = {
+  (ProcessFunc) gst_audio_test_src_create_silence_int16,
+  (ProcessFunc) gst_audio_test_src_create_silence_int32,
+  (ProcessFunc) gst_audio_test_src_create_silence_float,
+  (ProcessFunc) gst_audio_test_src_create_silence_double
 };
 
-
 /*
  * gst_audio_test_src_change_wave:
  * Assign function pointer of wave generator.
@@ -916,63 +924,61 @@ gst_audio_test_src_change_wave (GstAudioTestSrc * src)
       return;
   }
 
+  src->process = process_funcs[idx];
+
   switch (src->wave) {
     case GST_AUDIO_TEST_SRC_WAVE_SINE:
-      src->process = sine_funcs[idx];
+      src->generate = gst_audio_test_src_generate_sine;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_SQUARE:
-      src->process = square_funcs[idx];
+      src->generate = gst_audio_test_src_generate_square;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_SAW:
-      src->process = saw_funcs[idx];
+      src->generate = gst_audio_test_src_generate_saw;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_TRIANGLE:
-      src->process = triangle_funcs[idx];
+      src->generate = gst_audio_test_src_generate_triangle;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_SILENCE:
       src->process = silence_funcs[idx];
       break;
     case GST_AUDIO_TEST_SRC_WAVE_WHITE_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
-      src->process = white_noise_funcs[idx];
+      gst_audio_test_src_init_random (src);
+      src->generate = gst_audio_test_src_generate_white_noise;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_PINK_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
+      gst_audio_test_src_init_random (src);
       gst_audio_test_src_init_pink_noise (src);
-      src->process = pink_noise_funcs[idx];
+      src->generate = gst_audio_test_src_generate_pink_noise;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_SINE_TAB:
       gst_audio_test_src_init_sine_table (src);
-      src->process = sine_table_funcs[idx];
+      src->generate = gst_audio_test_src_generate_sine_table;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_TICKS:
       gst_audio_test_src_init_sine_table (src);
-      src->process = tick_funcs[idx];
+      src->generate = gst_audio_test_src_generate_ticks;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_GAUSSIAN_WHITE_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
-      src->process = gaussian_white_noise_funcs[idx];
+      gst_audio_test_src_init_random (src);
+      src->generate = gst_audio_test_src_generate_gaussian_white_noise;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_RED_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
+      gst_audio_test_src_init_random (src);
       src->red.state = 0.0;
-      src->process = red_noise_funcs[idx];
+      src->generate = gst_audio_test_src_generate_red_noise;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_BLUE_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
+      gst_audio_test_src_init_random (src);
       gst_audio_test_src_init_pink_noise (src);
-      src->process = blue_noise_funcs[idx];
+      src->flip = 1.0;
+      src->generate = gst_audio_test_src_generate_blue_noise;
       break;
     case GST_AUDIO_TEST_SRC_WAVE_VIOLET_NOISE:
-      if (!(src->gen))
-        src->gen = g_rand_new ();
+      gst_audio_test_src_init_random (src);
       src->red.state = 0.0;
-      src->process = violet_noise_funcs[idx];
+      src->flip = 1.0;
+      src->generate = gst_audio_test_src_generate_violet_noise;
       break;
     default:
       GST_ERROR ("invalid wave-form");
@@ -980,22 +986,6 @@ gst_audio_test_src_change_wave (GstAudioTestSrc * src)
   }
 }
 
-/*
- * gst_audio_test_src_change_volume:
- * Recalc wave tables for precalculated waves.
- */
-static void
-gst_audio_test_src_change_volume (GstAudioTestSrc * src)
-{
-  switch (src->wave) {
-    case GST_AUDIO_TEST_SRC_WAVE_SINE_TAB:
-      gst_audio_test_src_init_sine_table (src);
-      break;
-    default:
-      break;
-  }
-}
-
 static void
 gst_audio_test_src_get_times (GstBaseSrc * basesrc, GstBuffer * buffer,
     GstClockTime * start, GstClockTime * end)
@@ -1243,7 +1233,6 @@ gst_audio_test_src_set_property (GObject * object, guint prop_id,
       break;
     case PROP_VOLUME:
       src->volume = g_value_get_double (value);
-      gst_audio_test_src_change_volume (src);
       break;
     case PROP_IS_LIVE:
       gst_base_src_set_live (GST_BASE_SRC (src), g_value_get_boolean (value));
@@ -1257,6 +1246,9 @@ gst_audio_test_src_set_property (GObject * object, guint prop_id,
     case PROP_CAN_ACTIVATE_PULL:
       src->can_activate_pull = g_value_get_boolean (value);
       break;
+    case PROP_BAND_LIMITED:
+      src->band_limited = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1294,6 +1286,9 @@ gst_audio_test_src_get_property (GObject * object, guint prop_id,
     case PROP_CAN_ACTIVATE_PULL:
       g_value_set_boolean (value, src->can_activate_pull);
       break;
+    case PROP_BAND_LIMITED:
+      g_value_set_boolean (value, src->band_limited);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -94,6 +94,7 @@ typedef struct _GstAudioTestSrc GstAudioTestSrc;
 typedef struct _GstAudioTestSrcClass GstAudioTestSrcClass;
 
 typedef void (*ProcessFunc) (GstAudioTestSrc*, guint8 *);
+typedef void (*GenerateFunc) (GstAudioTestSrc*, gdouble *, gint, gint);
 
 /**
  * GstAudioTestSrc:
@@ -104,11 +105,13 @@ struct _GstAudioTestSrc {
   GstBaseSrc parent;
 
   ProcessFunc process;
+  GenerateFunc generate;
 
   /* parameters */
   GstAudioTestSrcWave wave;
   gdouble volume;
   gdouble freq;
+  gboolean band_limited;
 
   /* audio parameters */
   GstAudioInfo info;
@@ -129,10 +132,16 @@ struct _GstAudioTestSrc {
 
   /* waveform specific context data */
   GRand *gen;               /* random number generator */
-  gdouble accumulator;			/* phase angle */
+  guint64 rand_state;       /* fast generator, seeded from gen */
+  gdouble accumulator;			/* phase, in periods */
   GstPinkNoise pink;
   GstRedNoise red;
+  gdouble flip;             /* sign for the spectral inversion */
   gdouble wave_table[1024];
+
+  /* block of samples before conversion to the output format */
+  gdouble *block;
+  gint block_frames;
 };
 
 struct _GstAudioTestSrcClass {
@@ -23,8 +23,13 @@
  * This element takes an incoming stream of timestamped video frames.
  * It will produce a perfect stream that matches the source pad's framerate.
  *
- * The correction is performed by dropping and duplicating frames, no fancy
- * algorithm is used to interpolate frames (yet).
+ * The correction is performed by dropping and duplicating frames. For raw
+ * video with 8 bits per component, the #GstVideoRate:interpolation property
+ * can be set to blend, in which case the output frames that fall between two
+ * input frames are synthesized by blending the two input frames weighted by
+ * their distance to the output timestamp. This reduces judder when converting
+ * between unrelated framerates (such as 24 to 60 fps). The blending can be
+ * spread over several threads with the #GstVideoRate:n-threads property.
  *
  * By default the element will simply negotiate the same framerate on its
  * source and sink pad.
@@ -76,6 +81,7 @@
 #endif
 
 #include "gstvideorate.h"
+#include "gstvideorateorc.h"
 
 GST_DEBUG_CATEGORY_STATIC (video_rate_debug);
 #define GST_CAT_DEFAULT video_rate_debug
@@ -94,6 +100,8 @@ enum
 #define DEFAULT_AVERAGE_PERIOD  0
 #define DEFAULT_MAX_RATE        G_MAXINT
 #define DEFAULT_RATE            1.0
+#define DEFAULT_INTERPOLATION   GST_VIDEO_RATE_INTERPOLATION_NONE
+#define DEFAULT_N_THREADS       1
 
 enum
 {
@@ -108,9 +116,30 @@ enum
   PROP_DROP_ONLY,
   PROP_AVERAGE_PERIOD,
   PROP_MAX_RATE,
-  PROP_RATE
+  PROP_RATE,
+  PROP_INTERPOLATION,
+  PROP_N_THREADS
 };
 
+#define GST_TYPE_VIDEO_RATE_INTERPOLATION (gst_video_rate_interpolation_get_type ())
+static GType
+gst_video_rate_interpolation_get_type (void)
+{
+  static GType video_rate_interpolation_type = 0;
+  static const GEnumValue interpolation_types[] = {
+    {GST_VIDEO_RATE_INTERPOLATION_NONE, "Duplicate and drop frames", "none"},
+    {GST_VIDEO_RATE_INTERPOLATION_BLEND, "Blend neighbouring frames", "blend"},
+    {0, NULL, NULL}
+  };
+
+  if (!video_rate_interpolation_type) {
+    video_rate_interpolation_type =
+        g_enum_register_static ("GstVideoRateInterpolation",
+        interpolation_types);
+  }
+  return video_rate_interpolation_type;
+}
+
 static GstStaticPadTemplate gst_video_rate_src_template =
     GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
@@ -148,6 +177,7 @@ static gboolean gst_video_rate_start (GstBaseTransform * trans);
 static gboolean gst_video_rate_stop (GstBaseTransform * trans);
 
 
+static void gst_video_rate_finalize (GObject * object);
 static void gst_video_rate_set_property (GObject * object,
     guint prop_id, const GValue * value, GParamSpec * pspec);
 static void gst_video_rate_get_property (GObject * object,
@@ -166,6 +196,7 @@ gst_video_rate_class_init (GstVideoRateClass * klass)
   GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
   GstBaseTransformClass *base_class = GST_BASE_TRANSFORM_CLASS (klass);
 
+  object_class->finalize = gst_video_rate_finalize;
   object_class->set_property = gst_video_rate_set_property;
   object_class->get_property = gst_video_rate_get_property;
 
@@ -267,6 +298,34 @@ gst_video_rate_class_init (GstVideoRateClass * klass)
           "Factor of speed for frame displaying", 0.0, G_MAXDOUBLE,
           DEFAULT_RATE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstVideoRate:interpolation:
+   *
+   * How to produce output frames that fall between two input frames. Blending
+   * is only done for progressive raw video with 8 bits per component, other
+   * streams fall back to duplicating and dropping.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (object_class, PROP_INTERPOLATION,
+      g_param_spec_enum ("interpolation", "Interpolation",
+          "How to produce frames in between input frames",
+          GST_TYPE_VIDEO_RATE_INTERPOLATION, DEFAULT_INTERPOLATION,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstVideoRate:n-threads:
+   *
+   * Number of threads used to blend a frame, each thread processing a band
+   * of lines. Only used when #GstVideoRate:interpolation is blend.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (object_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads used for blending frames", 1, 64,
+          DEFAULT_N_THREADS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "Video rate adjuster", "Filter/Effect/Video",
       "Drops/duplicates/adjusts timestamps on video frames to make a perfect stream",
@@ -513,6 +572,25 @@ gst_video_rate_setcaps (GstBaseTransform * trans, GstCaps * in_caps,
   videorate->from_rate_numerator = rate_numerator;
   videorate->from_rate_denominator = rate_denominator;
 
+  /* see if we can blend frames of this format, we need raw progressive video
+   * where every component is a full byte */
+  videorate->can_blend = FALSE;
+  if (gst_structure_has_name (structure, "video/x-raw") &&
+      gst_video_info_from_caps (&videorate->vinfo, in_caps)) {
+    const GstVideoFormatInfo *finfo = videorate->vinfo.finfo;
+    gint i;
+
+    videorate->can_blend = !GST_VIDEO_FORMAT_INFO_HAS_PALETTE (finfo) &&
+        !GST_VIDEO_FORMAT_INFO_IS_COMPLEX (finfo) &&
+        GST_VIDEO_INFO_INTERLACE_MODE (&videorate->vinfo) ==
+        GST_VIDEO_INTERLACE_MODE_PROGRESSIVE;
+    for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (finfo); i++) {
+      if (GST_VIDEO_FORMAT_INFO_DEPTH (finfo, i) != 8)
+        videorate->can_blend = FALSE;
+    }
+  }
+  GST_DEBUG_OBJECT (videorate, "can blend frames: %d", videorate->can_blend);
+
   structure = gst_caps_get_structure (out_caps, 0);
   if (!gst_structure_get_fraction (structure, "framerate",
           &rate_numerator, &rate_denominator))
@@ -586,6 +664,11 @@ gst_video_rate_init (GstVideoRate * videorate)
   videorate->average_period_set = DEFAULT_AVERAGE_PERIOD;
   videorate->max_rate = DEFAULT_MAX_RATE;
   videorate->rate = DEFAULT_RATE;
+  videorate->interpolation = DEFAULT_INTERPOLATION;
+  videorate->n_threads = DEFAULT_N_THREADS;
+
+  g_mutex_init (&videorate->blend_lock);
+  g_cond_init (&videorate->blend_cond);
 
   videorate->from_rate_numerator = 0;
   videorate->from_rate_denominator = 0;
@@ -595,20 +678,27 @@ gst_video_rate_init (GstVideoRate * videorate)
   gst_base_transform_set_gap_aware (GST_BASE_TRANSFORM (videorate), TRUE);
 }
 
-/* flush the oldest buffer */
+static void
+gst_video_rate_finalize (GObject * object)
+{
+  GstVideoRate *videorate = GST_VIDEO_RATE (object);
+
+  if (videorate->blend_pool)
+    g_thread_pool_free (videorate->blend_pool, TRUE, TRUE);
+  g_mutex_clear (&videorate->blend_lock);
+  g_cond_clear (&videorate->blend_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/* stamp @outbuf with the next output timestamp and push it */
 static GstFlowReturn
-gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate)
+gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
+    gboolean duplicate)
 {
   GstFlowReturn res;
-  GstBuffer *outbuf;
   GstClockTime push_ts;
 
-  if (!videorate->prevbuf)
-    goto eos_before_buffers;
-
-  /* make sure we can write to the metadata */
-  outbuf = gst_buffer_make_writable (gst_buffer_ref (videorate->prevbuf));
-
   GST_BUFFER_OFFSET (outbuf) = videorate->out;
   GST_BUFFER_OFFSET_END (outbuf) = videorate->out + 1;
 
@@ -651,6 +741,48 @@ gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate)
   res = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (videorate), outbuf);
 
   return res;
+}
+
+/* Make a new buffer with the metadata of @buffer that references the memory
+ * of @buffer instead of copying it. We always hold a ref to prevbuf, so
+ * gst_buffer_make_writable() would have to copy the buffer for every frame
+ * we push out. Like gst_buffer_copy(), memory that isn't allowed to be
+ * shared is still copied. */
+static GstBuffer *
+gst_video_rate_share_buffer (GstBuffer * buffer)
+{
+  GstBuffer *outbuf;
+  guint i, n;
+
+  outbuf = gst_buffer_new ();
+  gst_buffer_copy_into (outbuf, buffer, GST_BUFFER_COPY_METADATA, 0, -1);
+
+  n = gst_buffer_n_memory (buffer);
+  for (i = 0; i < n; i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buffer, i);
+
+    if (GST_MEMORY_IS_NO_SHARE (mem))
+      mem = gst_memory_copy (mem, 0, -1);
+    else
+      mem = gst_memory_ref (mem);
+    gst_buffer_append_memory (outbuf, mem);
+  }
+
+  return outbuf;
+}
+
+/* flush the oldest buffer */
+static GstFlowReturn
+gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate)
+{
+  GstBuffer *outbuf;
+
+  if (!videorate->prevbuf)
+    goto eos_before_buffers;
+
+  outbuf = gst_video_rate_share_buffer (videorate->prevbuf);
+
+  return gst_video_rate_push_buffer (videorate, outbuf, duplicate);
 
   /* WARNINGS */
 eos_before_buffers:
@@ -660,6 +792,168 @@ eos_before_buffers:
   }
 }
 
+typedef struct
+{
+  GstVideoRate *videorate;
+  GstVideoFrame *out, *prev, *next;
+  gint weight;
+  guint band, n_bands;
+} GstVideoRateBlendJob;
+
+/* blend one horizontal band of every plane of @job->prev and @job->next into
+ * @job->out. Bands are split per plane so that subsampled planes are divided
+ * the same way as the luma plane. */
+static void
+gst_video_rate_blend_band (GstVideoRateBlendJob * job)
+{
+  gint plane_width[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint plane_height[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint i, p, y, width, start, end;
+
+  for (i = 0; i < GST_VIDEO_FRAME_N_COMPONENTS (job->out); i++) {
+    p = GST_VIDEO_FRAME_COMP_PLANE (job->out, i);
+    width = GST_VIDEO_FRAME_COMP_POFFSET (job->out, i) +
+        GST_VIDEO_FRAME_COMP_WIDTH (job->out, i) *
+        GST_VIDEO_FRAME_COMP_PSTRIDE (job->out, i);
+    plane_width[p] = MAX (plane_width[p], width);
+    plane_height[p] = MAX (plane_height[p],
+        GST_VIDEO_FRAME_COMP_HEIGHT (job->out, i));
+  }
+
+  for (p = 0; p < GST_VIDEO_FRAME_N_PLANES (job->out); p++) {
+    gint dstride = GST_VIDEO_FRAME_PLANE_STRIDE (job->out, p);
+    gint pstride = GST_VIDEO_FRAME_PLANE_STRIDE (job->prev, p);
+    gint nstride = GST_VIDEO_FRAME_PLANE_STRIDE (job->next, p);
+    guint8 *d = GST_VIDEO_FRAME_PLANE_DATA (job->out, p);
+    const guint8 *s1 = GST_VIDEO_FRAME_PLANE_DATA (job->prev, p);
+    const guint8 *s2 = GST_VIDEO_FRAME_PLANE_DATA (job->next, p);
+
+    /* packed formats can have components ending beyond the last pixel */
+    width = MIN (plane_width[p], MIN (dstride, MIN (pstride, nstride)));
+    start = plane_height[p] * job->band / job->n_bands;
+    end = plane_height[p] * (job->band + 1) / job->n_bands;
+
+    for (y = start; y < end; y++) {
+      video_rate_orc_merge_linear_u8 (d + y * dstride, s1 + y * pstride,
+          s2 + y * nstride, job->weight, width);
+    }
+  }
+}
+
+static void
+gst_video_rate_blend_func (gpointer data, gpointer user_data)
+{
+  GstVideoRateBlendJob *job = data;
+  GstVideoRate *videorate = job->videorate;
+
+  gst_video_rate_blend_band (job);
+
+  g_mutex_lock (&videorate->blend_lock);
+  if (--videorate->blend_pending == 0)
+    g_cond_signal (&videorate->blend_cond);
+  g_mutex_unlock (&videorate->blend_lock);
+}
+
+/* blend @out = prev + (next - prev) * weight / 256, dispatching the bands to
+ * the thread pool and processing the first band on the streaming thread */
+static void
+gst_video_rate_blend_frames (GstVideoRate * videorate, GstVideoFrame * out,
+    GstVideoFrame * prev, GstVideoFrame * next, gint weight, guint n_threads)
+{
+  GstVideoRateBlendJob jobs[64];
+  guint i;
+
+  n_threads = CLAMP (n_threads, 1, G_N_ELEMENTS (jobs));
+  n_threads = MIN (n_threads, (guint) GST_VIDEO_FRAME_HEIGHT (out));
+
+  for (i = 0; i < n_threads; i++) {
+    jobs[i].videorate = videorate;
+    jobs[i].out = out;
+    jobs[i].prev = prev;
+    jobs[i].next = next;
+    jobs[i].weight = weight;
+    jobs[i].band = i;
+    jobs[i].n_bands = n_threads;
+  }
+
+  if (n_threads > 1) {
+    if (videorate->blend_pool == NULL) {
+      videorate->blend_pool = g_thread_pool_new (gst_video_rate_blend_func,
+          NULL, n_threads - 1, FALSE, NULL);
+    } else if (g_thread_pool_get_max_threads (videorate->blend_pool) !=
+        n_threads - 1) {
+      g_thread_pool_set_max_threads (videorate->blend_pool, n_threads - 1,
+          NULL);
+    }
+
+    videorate->blend_pending = n_threads - 1;
+    for (i = 1; i < n_threads; i++)
+      g_thread_pool_push (videorate->blend_pool, &jobs[i], NULL);
+  }
+
+  gst_video_rate_blend_band (&jobs[0]);
+
+  if (n_threads > 1) {
+    g_mutex_lock (&videorate->blend_lock);
+    while (videorate->blend_pending > 0)
+      g_cond_wait (&videorate->blend_cond, &videorate->blend_lock);
+    g_mutex_unlock (&videorate->blend_lock);
+  }
+}
+
+/* push a new frame interpolated between prevbuf and @buffer */
+static GstFlowReturn
+gst_video_rate_flush_blend (GstVideoRate * videorate, GstBuffer * buffer,
+    gint weight)
+{
+  GstVideoFrame out_frame, prev_frame, next_frame;
+  GstBuffer *outbuf;
+  guint n_threads;
+
+  GST_OBJECT_LOCK (videorate);
+  n_threads = videorate->n_threads;
+  GST_OBJECT_UNLOCK (videorate);
+
+  outbuf = gst_buffer_new_allocate (NULL,
+      GST_VIDEO_INFO_SIZE (&videorate->vinfo), NULL);
+  /* only the flags, a video meta of prevbuf would not describe our memory */
+  gst_buffer_copy_into (outbuf, videorate->prevbuf, GST_BUFFER_COPY_FLAGS, 0,
+      -1);
+
+  if (!gst_video_frame_map (&prev_frame, &videorate->vinfo,
+          videorate->prevbuf, GST_MAP_READ))
+    goto map_failed;
+  if (!gst_video_frame_map (&next_frame, &videorate->vinfo, buffer,
+          GST_MAP_READ)) {
+    gst_video_frame_unmap (&prev_frame);
+    goto map_failed;
+  }
+  if (!gst_video_frame_map (&out_frame, &videorate->vinfo, outbuf,
+          GST_MAP_WRITE)) {
+    gst_video_frame_unmap (&next_frame);
+    gst_video_frame_unmap (&prev_frame);
+    goto map_failed;
+  }
+
+  GST_LOG_OBJECT (videorate, "blending frames with weight %d", weight);
+  gst_video_rate_blend_frames (videorate, &out_frame, &prev_frame,
+      &next_frame, weight, n_threads);
+
+  gst_video_frame_unmap (&out_frame);
+  gst_video_frame_unmap (&next_frame);
+  gst_video_frame_unmap (&prev_frame);
+
+  return gst_video_rate_push_buffer (videorate, outbuf, FALSE);
+
+map_failed:
+  {
+    /* not fatal, fall back to duplicating the old frame */
+    GST_WARNING_OBJECT (videorate, "could not map frames for blending");
+    gst_buffer_unref (outbuf);
+    return gst_video_rate_flush_prev (videorate, TRUE);
+  }
+}
+
 static void
 gst_video_rate_swap_prev (GstVideoRate * videorate, GstBuffer * buffer,
     gint64 time)
@@ -992,6 +1286,7 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
   GstFlowReturn res = GST_BASE_TRANSFORM_FLOW_DROPPED;
   GstClockTime intime, in_ts, in_dur;
   GstClockTime avg_period;
+  GstVideoRateInterpolation interpolation;
   gboolean skip = FALSE;
 
   videorate = GST_VIDEO_RATE (trans);
@@ -1003,6 +1298,7 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
 
   GST_OBJECT_LOCK (videorate);
   avg_period = videorate->average_period_set;
+  interpolation = videorate->interpolation;
   GST_OBJECT_UNLOCK (videorate);
 
   /* MT-safe switching between modes */
@@ -1096,6 +1392,46 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
       goto done;
     }
 
+    if (interpolation == GST_VIDEO_RATE_INTERPOLATION_BLEND &&
+        videorate->can_blend && !videorate->drop_only &&
+        videorate->to_rate_numerator != 0) {
+      gint blended = 0;
+
+      /* every output timestamp before the new buffer is synthesized from the
+       * two buffers around it, outputs at or before prevtime are plain
+       * copies of the old buffer */
+      while (TRUE) {
+        GstClockTime outtime = videorate->next_ts * videorate->rate;
+        GstFlowReturn r;
+        gint weight;
+
+        if (outtime >= intime)
+          break;
+
+        if (outtime <= prevtime)
+          weight = 0;
+        else
+          weight = gst_util_uint64_scale (outtime - prevtime, 256,
+              intime - prevtime);
+
+        if (weight == 0) {
+          count++;
+          r = gst_video_rate_flush_prev (videorate, count > 1);
+        } else {
+          blended++;
+          r = gst_video_rate_flush_blend (videorate, buffer, weight);
+        }
+        if (r != GST_FLOW_OK) {
+          res = r;
+          goto done;
+        }
+      }
+      /* the old buffer contributed to the blended frames, it wasn't dropped */
+      if (count == 0 && blended > 0)
+        count = 1;
+      goto counted;
+    }
+
     /* got 2 buffers, see which one is the best */
     do {
 
@@ -1135,6 +1471,7 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
     }
     while (diff1 < diff2);
 
+  counted:
     /* if we outputed the first buffer more then once, we have dups */
     if (count > 1) {
       videorate->dup += count - 1;
@@ -1153,11 +1490,10 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
           GST_TIME_FORMAT, GST_TIME_ARGS (videorate->next_ts));
     }
     GST_LOG_OBJECT (videorate,
-        "END, putting new in old, diff1 %" GST_TIME_FORMAT
-        ", diff2 %" GST_TIME_FORMAT ", next_ts %" GST_TIME_FORMAT
+        "END, putting new in old, next_ts %" GST_TIME_FORMAT
         ", in %" G_GUINT64_FORMAT ", out %" G_GUINT64_FORMAT ", drop %"
-        G_GUINT64_FORMAT ", dup %" G_GUINT64_FORMAT, GST_TIME_ARGS (diff1),
-        GST_TIME_ARGS (diff2), GST_TIME_ARGS (videorate->next_ts),
+        G_GUINT64_FORMAT ", dup %" G_GUINT64_FORMAT,
+        GST_TIME_ARGS (videorate->next_ts),
         videorate->in, videorate->out, videorate->drop, videorate->dup);
 
     /* swap in new one when it's the best */
@@ -1193,7 +1529,14 @@ gst_video_rate_start (GstBaseTransform * trans)
 static gboolean
 gst_video_rate_stop (GstBaseTransform * trans)
 {
-  gst_video_rate_reset (GST_VIDEO_RATE (trans));
+  GstVideoRate *videorate = GST_VIDEO_RATE (trans);
+
+  gst_video_rate_reset (videorate);
+  videorate->can_blend = FALSE;
+  if (videorate->blend_pool) {
+    g_thread_pool_free (videorate->blend_pool, FALSE, TRUE);
+    videorate->blend_pool = NULL;
+  }
   return TRUE;
 }
 
@@ -1243,6 +1586,14 @@ gst_video_rate_set_property (GObject * object,
       GST_OBJECT_UNLOCK (videorate);
       gst_videorate_update_duration (videorate);
       break;
+    case PROP_INTERPOLATION:
+      videorate->interpolation = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (videorate);
+      break;
+    case PROP_N_THREADS:
+      videorate->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (videorate);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       GST_OBJECT_UNLOCK (videorate);
@@ -1296,6 +1647,12 @@ gst_video_rate_get_property (GObject * object,
     case PROP_RATE:
       g_value_set_double (value, videorate->rate);
       break;
+    case PROP_INTERPOLATION:
+      g_value_set_enum (value, videorate->interpolation);
+      break;
+    case PROP_N_THREADS:
+      g_value_set_uint (value, videorate->n_threads);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
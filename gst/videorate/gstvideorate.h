@@ -22,6 +22,7 @@
 
 #include <gst/gst.h>
 #include <gst/base/gstbasetransform.h>
+#include <gst/video/video.h>
 
 G_BEGIN_DECLS
 #define GST_TYPE_VIDEO_RATE \
@@ -37,6 +38,19 @@ G_BEGIN_DECLS
 typedef struct _GstVideoRate GstVideoRate;
 typedef struct _GstVideoRateClass GstVideoRateClass;
 
+/**
+ * GstVideoRateInterpolation:
+ * @GST_VIDEO_RATE_INTERPOLATION_NONE: duplicate and drop frames
+ * @GST_VIDEO_RATE_INTERPOLATION_BLEND: synthesize intermediate frames by
+ *     blending the two surrounding input frames
+ *
+ * How output frames that fall between two input frames are produced.
+ */
+typedef enum {
+  GST_VIDEO_RATE_INTERPOLATION_NONE,
+  GST_VIDEO_RATE_INTERPOLATION_BLEND
+} GstVideoRateInterpolation;
+
 /**
  * GstVideoRate:
  *
@@ -77,6 +91,16 @@ struct _GstVideoRate
 
   volatile int max_rate;
   gdouble rate;
+  GstVideoRateInterpolation interpolation;
+  guint n_threads;
+
+  /* frame blending */
+  GstVideoInfo vinfo;
+  gboolean can_blend;           /* negotiated raw format we know how to blend */
+  GThreadPool *blend_pool;
+  GMutex blend_lock;
+  GCond blend_cond;
+  guint blend_pending;
 };
 
 struct _GstVideoRateClass
@@ -30,6 +30,10 @@
  * |[
  * gst-launch -v videotestsrc pattern=snow ! ximagesink
  * ]| Shows random noise in an X window.
+ * |[
+ * gst-launch -v videotestsrc cache-static=true ! video/x-raw,width=1920,height=1080 ! fakesink
+ * ]| Render the SMPTE bars once and push the same image as fast as possible,
+ * useful as a load generator.
  * </refsect2>
  */
 
@@ -53,6 +57,8 @@ GST_DEBUG_CATEGORY_STATIC (video_test_src_debug);
 #define DEFAULT_FOREGROUND_COLOR   0xffffffff
 #define DEFAULT_BACKGROUND_COLOR   0xff000000
 #define DEFAULT_HORIZONTAL_SPEED   0
+#define DEFAULT_CACHE_STATIC       FALSE
+#define DEFAULT_N_THREADS          1
 
 enum
 {
@@ -75,6 +81,8 @@ enum
   PROP_FOREGROUND_COLOR,
   PROP_BACKGROUND_COLOR,
   PROP_HORIZONTAL_SPEED,
+  PROP_CACHE_STATIC,
+  PROP_N_THREADS,
   PROP_LAST
 };
 
@@ -98,6 +106,7 @@ G_DEFINE_TYPE (GstVideoTestSrc, gst_video_test_src, GST_TYPE_PUSH_SRC);
 
 static void gst_video_test_src_set_pattern (GstVideoTestSrc * videotestsrc,
     int pattern_type);
+static void gst_video_test_src_finalize (GObject * object);
 static void gst_video_test_src_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_video_test_src_get_property (GObject * object, guint prop_id,
@@ -118,6 +127,8 @@ static gboolean gst_video_test_src_decide_allocation (GstBaseSrc * bsrc,
     GstQuery * query);
 static GstFlowReturn gst_video_test_src_fill (GstPushSrc * psrc,
     GstBuffer * buffer);
+static GstFlowReturn gst_video_test_src_create (GstPushSrc * psrc,
+    GstBuffer ** buffer);
 static gboolean gst_video_test_src_start (GstBaseSrc * basesrc);
 static gboolean gst_video_test_src_stop (GstBaseSrc * basesrc);
 
@@ -172,6 +183,7 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
   gstbasesrc_class = (GstBaseSrcClass *) klass;
   gstpushsrc_class = (GstPushSrcClass *) klass;
 
+  gobject_class->finalize = gst_video_test_src_finalize;
   gobject_class->set_property = gst_video_test_src_set_property;
   gobject_class->get_property = gst_video_test_src_get_property;
 
@@ -271,6 +283,36 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
           G_MININT32, G_MAXINT32, DEFAULT_HORIZONTAL_SPEED,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstVideoTestSrc:cache-static
+   *
+   * Render patterns that don't change over time only once and push buffers
+   * that share the memory of this one image. The memory of the pushed
+   * buffers is not writable, elements modifying it will have to make a copy.
+   * Patterns that change from frame to frame are always rendered.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_STATIC,
+      g_param_spec_boolean ("cache-static", "Cache static patterns",
+          "Render static patterns only once and reuse the image",
+          DEFAULT_CACHE_STATIC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstVideoTestSrc:n-threads
+   *
+   * Number of threads used to render a frame, each thread painting a band
+   * of lines. Only the zone plate, chroma zone plate, circular and gamut
+   * patterns are rendered in bands, and only for formats without vertical
+   * chroma subsampling. The output does not depend on the number of threads.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads used for rendering the patterns", 1, 64,
+          DEFAULT_N_THREADS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (gstelement_class,
       "Video test source", "Source/Video",
       "Creates a test video stream", "David A. Schleef <ds@schleef.org>");
@@ -288,6 +330,7 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
   gstbasesrc_class->stop = gst_video_test_src_stop;
   gstbasesrc_class->decide_allocation = gst_video_test_src_decide_allocation;
 
+  gstpushsrc_class->create = gst_video_test_src_create;
   gstpushsrc_class->fill = gst_video_test_src_fill;
 }
 
@@ -300,12 +343,42 @@ gst_video_test_src_init (GstVideoTestSrc * src)
   src->foreground_color = DEFAULT_FOREGROUND_COLOR;
   src->background_color = DEFAULT_BACKGROUND_COLOR;
   src->horizontal_speed = DEFAULT_HORIZONTAL_SPEED;
+  src->cache_static = DEFAULT_CACHE_STATIC;
+  src->n_threads = DEFAULT_N_THREADS;
+  g_mutex_init (&src->band_lock);
+  g_cond_init (&src->band_cond);
 
   /* we operate in time */
   gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
   gst_base_src_set_live (GST_BASE_SRC (src), DEFAULT_IS_LIVE);
 }
 
+static void
+gst_video_test_src_finalize (GObject * object)
+{
+  GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (object);
+
+  gst_buffer_replace (&src->cached_frame, NULL);
+
+  if (src->band_pool)
+    g_thread_pool_free (src->band_pool, TRUE, TRUE);
+  g_free (src->band_scratch);
+  g_mutex_clear (&src->band_lock);
+  g_cond_clear (&src->band_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/* the cached image has to be rendered again after a change of a property
+ * that affects the pattern */
+static void
+gst_video_test_src_clear_cache (GstVideoTestSrc * src)
+{
+  GST_OBJECT_LOCK (src);
+  gst_buffer_replace (&src->cached_frame, NULL);
+  GST_OBJECT_UNLOCK (src);
+}
+
 static GstCaps *
 gst_video_test_src_src_fixate (GstBaseSrc * bsrc, GstCaps * caps)
 {
@@ -422,6 +495,16 @@ gst_video_test_src_set_property (GObject * object, guint prop_id,
     case PROP_PATTERN:
       gst_video_test_src_set_pattern (src, g_value_get_enum (value));
       break;
+    case PROP_CACHE_STATIC:
+      GST_OBJECT_LOCK (src);
+      src->cache_static = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (src);
+      src->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (src);
+      break;
     case PROP_TIMESTAMP_OFFSET:
       src->timestamp_offset = g_value_get_int64 (value);
       break;
@@ -472,9 +555,14 @@ gst_video_test_src_set_property (GObject * object, guint prop_id,
       break;
     case PROP_HORIZONTAL_SPEED:
       src->horizontal_speed = g_value_get_int (value);
+      break;
     default:
       break;
   }
+
+  if (prop_id != PROP_TIMESTAMP_OFFSET && prop_id != PROP_IS_LIVE &&
+      prop_id != PROP_CACHE_STATIC && prop_id != PROP_N_THREADS)
+    gst_video_test_src_clear_cache (src);
 }
 
 static void
@@ -538,6 +626,16 @@ gst_video_test_src_get_property (GObject * object, guint prop_id,
     case PROP_HORIZONTAL_SPEED:
       g_value_set_int (value, src->horizontal_speed);
       break;
+    case PROP_CACHE_STATIC:
+      GST_OBJECT_LOCK (src);
+      g_value_set_boolean (value, src->cache_static);
+      GST_OBJECT_UNLOCK (src);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (src);
+      g_value_set_uint (value, src->n_threads);
+      GST_OBJECT_UNLOCK (src);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -723,10 +821,14 @@ gst_video_test_src_setcaps (GstBaseSrc * bsrc, GstCaps * caps)
   g_free (videotestsrc->tmpline2);
   g_free (videotestsrc->tmpline_u8);
   g_free (videotestsrc->tmpline_u16);
+  g_free (videotestsrc->xphase);
   videotestsrc->tmpline_u8 = g_malloc (info.width + 8);
   videotestsrc->tmpline = g_malloc ((info.width + 8) * 4);
   videotestsrc->tmpline2 = g_malloc ((info.width + 8) * 4);
   videotestsrc->tmpline_u16 = g_malloc ((info.width + 16) * 8);
+  videotestsrc->xphase = g_malloc ((info.width + 8) * sizeof (gint));
+
+  gst_video_test_src_clear_cache (videotestsrc);
 
   videotestsrc->accum_rtime += videotestsrc->running_time;
   videotestsrc->accum_frames += videotestsrc->n_frames;
@@ -835,17 +937,17 @@ gst_video_test_src_is_seekable (GstBaseSrc * psrc)
   return TRUE;
 }
 
+/* timestamp @buffer for the next frame and, if @render is set, paint the
+ * pattern in it */
 static GstFlowReturn
-gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
+gst_video_test_src_fill_frame (GstVideoTestSrc * src, GstBuffer * buffer,
+    gboolean render)
 {
-  GstVideoTestSrc *src;
   GstClockTime next_time;
   GstVideoFrame frame;
   gconstpointer pal;
   gsize palsize;
 
-  src = GST_VIDEO_TEST_SRC (psrc);
-
   if (G_UNLIKELY (GST_VIDEO_INFO_FORMAT (&src->info) ==
           GST_VIDEO_FORMAT_UNKNOWN))
     goto not_negotiated;
@@ -857,23 +959,26 @@ gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
   GST_LOG_OBJECT (src,
       "creating buffer from pool for frame %d", (gint) src->n_frames);
 
-  if (!gst_video_frame_map (&frame, &src->info, buffer, GST_MAP_WRITE))
+  if (render && !gst_video_frame_map (&frame, &src->info, buffer,
+          GST_MAP_WRITE))
     goto invalid_frame;
 
   GST_BUFFER_DTS (buffer) =
       src->accum_rtime + src->timestamp_offset + src->running_time;
   GST_BUFFER_PTS (buffer) = GST_BUFFER_DTS (buffer);
 
-  gst_object_sync_values (GST_OBJECT (psrc), GST_BUFFER_DTS (buffer));
+  gst_object_sync_values (GST_OBJECT (src), GST_BUFFER_DTS (buffer));
 
-  src->make_image (src, &frame);
+  if (render) {
+    src->make_image (src, &frame);
 
-  if ((pal = gst_video_format_get_palette (GST_VIDEO_FRAME_FORMAT (&frame),
-              &palsize))) {
-    memcpy (GST_VIDEO_FRAME_PLANE_DATA (&frame, 1), pal, palsize);
-  }
+    if ((pal = gst_video_format_get_palette (GST_VIDEO_FRAME_FORMAT (&frame),
+                &palsize))) {
+      memcpy (GST_VIDEO_FRAME_PLANE_DATA (&frame, 1), pal, palsize);
+    }
 
-  gst_video_frame_unmap (&frame);
+    gst_video_frame_unmap (&frame);
+  }
 
   GST_DEBUG_OBJECT (src, "Timestamp: %" GST_TIME_FORMAT " = accumulated %"
       GST_TIME_FORMAT " + offset: %"
@@ -916,6 +1021,106 @@ invalid_frame:
   }
 }
 
+static GstFlowReturn
+gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
+{
+  return gst_video_test_src_fill_frame (GST_VIDEO_TEST_SRC (psrc), buffer,
+      TRUE);
+}
+
+/* check if the current pattern renders the same image for every frame */
+static gboolean
+gst_video_test_src_is_static (GstVideoTestSrc * src)
+{
+  /* controlled properties can change the image at any time */
+  if (gst_object_has_active_control_bindings (GST_OBJECT (src)))
+    return FALSE;
+
+  switch (src->pattern_type) {
+    case GST_VIDEO_TEST_SRC_SNOW:
+    case GST_VIDEO_TEST_SRC_BLINK:
+    case GST_VIDEO_TEST_SRC_BALL:
+      return FALSE;
+    case GST_VIDEO_TEST_SRC_ZONE_PLATE:
+    case GST_VIDEO_TEST_SRC_CHROMA_ZONE_PLATE:
+      return src->kt == 0 && src->kxt == 0 && src->kyt == 0 && src->kt2 == 0;
+    default:
+      /* scrolling only affects the patterns drawn through the tmpline, but
+       * keep it simple */
+      return src->horizontal_speed == 0;
+  }
+}
+
+static GstFlowReturn
+gst_video_test_src_create (GstPushSrc * psrc, GstBuffer ** buffer)
+{
+  GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (psrc);
+  GstBaseSrc *bsrc = GST_BASE_SRC (psrc);
+  GstBuffer *cached = NULL, *outbuf;
+  GstFlowReturn ret;
+  gboolean cache;
+
+  GST_OBJECT_LOCK (src);
+  cache = src->cache_static;
+  if (cache && src->cached_frame)
+    cached = gst_buffer_ref (src->cached_frame);
+  GST_OBJECT_UNLOCK (src);
+
+  if (cache && !gst_video_test_src_is_static (src)) {
+    cache = FALSE;
+    if (cached) {
+      gst_buffer_unref (cached);
+      cached = NULL;
+    }
+  }
+
+  if (!cache) {
+    /* the regular path: a buffer from the pool that is painted every time */
+    ret = GST_BASE_SRC_CLASS (parent_class)->alloc (bsrc, -1,
+        src->info.size, &outbuf);
+    if (ret != GST_FLOW_OK)
+      return ret;
+
+    ret = gst_video_test_src_fill_frame (src, outbuf, TRUE);
+    if (ret != GST_FLOW_OK) {
+      gst_buffer_unref (outbuf);
+      return ret;
+    }
+    *buffer = outbuf;
+    return GST_FLOW_OK;
+  }
+
+  if (cached == NULL) {
+    /* paint the image once in memory we own, pool memory can't be shared
+     * between buffers */
+    GST_DEBUG_OBJECT (src, "rendering static pattern");
+    cached = gst_buffer_new_allocate (NULL, src->info.size, NULL);
+    ret = gst_video_test_src_fill_frame (src, cached, TRUE);
+    if (ret != GST_FLOW_OK) {
+      gst_buffer_unref (cached);
+      return ret;
+    }
+    outbuf = gst_buffer_copy (cached);
+
+    GST_OBJECT_LOCK (src);
+    gst_buffer_replace (&src->cached_frame, cached);
+    GST_OBJECT_UNLOCK (src);
+  } else {
+    outbuf = gst_buffer_new ();
+    gst_buffer_copy_into (outbuf, cached, GST_BUFFER_COPY_MEMORY, 0, -1);
+    ret = gst_video_test_src_fill_frame (src, outbuf, FALSE);
+    if (ret != GST_FLOW_OK) {
+      gst_buffer_unref (outbuf);
+      gst_buffer_unref (cached);
+      return ret;
+    }
+  }
+  gst_buffer_unref (cached);
+
+  *buffer = outbuf;
+  return GST_FLOW_OK;
+}
+
 static gboolean
 gst_video_test_src_start (GstBaseSrc * basesrc)
 {
@@ -943,6 +1148,16 @@ gst_video_test_src_stop (GstBaseSrc * basesrc)
   src->tmpline_u8 = NULL;
   g_free (src->tmpline_u16);
   src->tmpline_u16 = NULL;
+  g_free (src->xphase);
+  src->xphase = NULL;
+  g_free (src->band_scratch);
+  src->band_scratch = NULL;
+  src->band_scratch_size = 0;
+  if (src->band_pool) {
+    g_thread_pool_free (src->band_pool, FALSE, TRUE);
+    src->band_pool = NULL;
+  }
+  gst_video_test_src_clear_cache (src);
   if (src->subsample)
     gst_video_chroma_resample_free (src->subsample);
   src->subsample = NULL;
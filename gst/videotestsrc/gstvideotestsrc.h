@@ -162,6 +162,11 @@ struct _GstVideoTestSrc {
   gint horizontal_offset;
   gint horizontal_speed;
 
+  /* static patterns are rendered once and their memory reused, protected
+   * with the object lock */
+  gboolean cache_static;
+  GstBuffer *cached_frame;
+
   void (*make_image) (GstVideoTestSrc *v, GstVideoFrame *frame);
 
   /* temporary AYUV/ARGB scanline */
@@ -169,10 +174,22 @@ struct _GstVideoTestSrc {
   guint8 *tmpline;
   guint8 *tmpline2;
   guint16 *tmpline_u16;
+  /* per column phase table of the zoneplates */
+  gint *xphase;
 
   guint n_lines;
   gint offset;
   gpointer *lines;
+
+  /* rendering in bands of lines */
+  guint n_threads;
+  GThreadPool *band_pool;
+  GMutex band_lock;
+  GCond band_cond;
+  guint bands_pending;
+  /* scratch lines of all bands but the first one */
+  guint8 *band_scratch;
+  gsize band_scratch_size;
 };
 
 struct _GstVideoTestSrcClass {
@@ -315,6 +315,120 @@ videotestsrc_blend_line (GstVideoTestSrc * v, guint8 * dest, guint8 * src,
 #undef BLEND
 }
 
+/* paint lines [@y0, @y1) of a pattern with the scratch lines of @p */
+typedef void (*VtsPaintLinesFunc) (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, gpointer user_data, int y0, int y1);
+
+typedef struct
+{
+  GstVideoTestSrc *v;
+  paintinfo p;
+  gpointer lines[4];
+  GstVideoFrame *frame;
+  VtsPaintLinesFunc func;
+  gpointer user_data;
+  int y0, y1;
+} VtsBandJob;
+
+static void
+videotestsrc_band_func (gpointer data, gpointer user_data)
+{
+  VtsBandJob *job = data;
+  GstVideoTestSrc *v = job->v;
+
+  job->func (v, &job->p, job->frame, job->user_data, job->y0, job->y1);
+
+  g_mutex_lock (&v->band_lock);
+  if (--v->bands_pending == 0)
+    g_cond_signal (&v->band_cond);
+  g_mutex_unlock (&v->band_lock);
+}
+
+/* Paint all lines of @frame with @func, split in bands over the thread pool
+ * when more than one thread is configured. Every band gets its own scratch
+ * lines, so the patterns must not carry state from one line to the next.
+ * Vertically subsampled formats are packed in groups of n_lines lines that
+ * start at a multiple of n_lines, so bands start on such a multiple and
+ * every group is painted and packed by one thread. */
+static void
+videotestsrc_paint_bands (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, VtsPaintLinesFunc func, gpointer user_data)
+{
+  VtsBandJob jobs[64];
+  int w = frame->info.width, h = frame->info.height;
+  guint n_lines = p->n_lines;
+  gsize line_size, band_size;
+  guint i, j, n_bands, n_threads;
+
+  GST_OBJECT_LOCK (v);
+  n_threads = v->n_threads;
+  GST_OBJECT_UNLOCK (v);
+
+  n_bands = CLAMP (n_threads, 1, G_N_ELEMENTS (jobs));
+  n_bands = MIN (n_bands, (h + n_lines - 1) / n_lines);
+  /* the lines of a group would be split over two bands */
+  if (p->offset != 0 || n_lines > G_N_ELEMENTS (jobs[0].lines))
+    n_bands = 1;
+
+  if (n_bands == 1) {
+    func (v, p, frame, user_data, 0, h);
+    return;
+  }
+
+  /* tmpline_u8, tmpline, tmpline2, tmpline_u16 and the lines to pack, sized
+   * like the ones allocated in setcaps */
+  line_size = GST_ROUND_UP_16 ((w + 16) * 8);
+  band_size = (4 + n_lines) * line_size;
+  if (v->band_scratch_size < band_size * (n_bands - 1)) {
+    g_free (v->band_scratch);
+    v->band_scratch_size = band_size * (n_bands - 1);
+    v->band_scratch = g_malloc (v->band_scratch_size);
+  }
+
+  for (i = 0; i < n_bands; i++) {
+    VtsBandJob *job = &jobs[i];
+
+    job->v = v;
+    job->p = *p;
+    job->frame = frame;
+    job->func = func;
+    job->user_data = user_data;
+    job->y0 = MIN (GST_ROUND_UP_N (h * i / n_bands, n_lines), h);
+    job->y1 = i == n_bands - 1 ? h :
+        MIN (GST_ROUND_UP_N (h * (i + 1) / n_bands, n_lines), h);
+
+    if (i > 0) {
+      guint8 *scratch = v->band_scratch + (i - 1) * band_size;
+
+      job->p.tmpline_u8 = scratch;
+      job->p.tmpline = scratch + line_size;
+      job->p.tmpline2 = scratch + 2 * line_size;
+      job->p.tmpline_u16 = (guint16 *) (scratch + 3 * line_size);
+      for (j = 0; j < n_lines; j++)
+        job->lines[j] = scratch + (4 + j) * line_size;
+      job->p.lines = job->lines;
+    }
+  }
+
+  if (v->band_pool == NULL) {
+    v->band_pool = g_thread_pool_new (videotestsrc_band_func, NULL,
+        n_bands - 1, FALSE, NULL);
+  } else if (g_thread_pool_get_max_threads (v->band_pool) != n_bands - 1) {
+    g_thread_pool_set_max_threads (v->band_pool, n_bands - 1, NULL);
+  }
+
+  v->bands_pending = n_bands - 1;
+  for (i = 1; i < n_bands; i++)
+    g_thread_pool_push (v->band_pool, &jobs[i], NULL);
+
+  func (v, &jobs[0].p, frame, user_data, jobs[0].y0, jobs[0].y1);
+
+  g_mutex_lock (&v->band_lock);
+  while (v->bands_pending > 0)
+    g_cond_wait (&v->band_cond, &v->band_lock);
+  g_mutex_unlock (&v->band_lock);
+}
+
 void
 gst_video_test_src_smpte (GstVideoTestSrc * v, GstVideoFrame * frame)
 {
@@ -745,37 +859,92 @@ static const guint8 sine_table[256] = {
 };
 
 
-void
-gst_video_test_src_zoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
+/* Fill @xphase with the terms of the zoneplate equation that only depend on
+ * the column (and the frame), these are the same for every line:
+ *
+ *   xphase[i] = k0 + kx*i + kt*t + kxt*i*t + kx2*x*x + kt2*t*t
+ */
+static void
+videotestsrc_zoneplate_xphase (GstVideoTestSrc * v, int *xphase, int w,
+    int t, int xreset)
+{
+  int i, x;
+  int accum_kx = 0;
+  int accum_kxt = 0;
+  int delta_kxt = v->kxt * t;
+  int scale_kx2 = 0xffff / w;
+  int base = v->k0 + v->kt * t + ((v->kt2 * t * t) >> 1);
+
+  for (i = 0, x = xreset; i < w; i++, x++) {
+    /* first order */
+    accum_kx += v->kx;
+    /* cross term */
+    accum_kxt += delta_kxt;
+    /* second order, normalised to the rate of change of phase at the
+     * picture edge */
+    xphase[i] = base + accum_kx + accum_kxt +
+        ((v->kx2 * x * x * scale_kx2) >> 16);
+  }
+}
+
+static void
+paint_zoneplate_lines (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, gpointer user_data, int y0, int y1)
 {
   int i;
   int j;
-  paintinfo pi = PAINT_INFO_INIT;
-  paintinfo *p = &pi;
-  struct vts_color_struct color;
   int t = v->n_frames;
   int w = frame->info.width, h = frame->info.height;
   int xreset = -(w / 2) - v->xoffset;   /* starting values for x^2 and y^2, centering the ellipse */
   int yreset = -(h / 2) - v->yoffset;
 
-  int x, y;
-  int accum_kx;
-  int accum_kxt;
+  int y;
   int accum_ky;
   int accum_kyt;
   int accum_kxy;
-  int kt;
-  int kt2;
   int ky2;
-  int delta_kxt = v->kxt * t;
+  int line_phase;
   int delta_kxy;
   int scale_kxy = 0xffff / (w / 2);
-  int scale_kx2 = 0xffff / w;
+  int *xphase = v->xphase;
 
-  videotestsrc_setup_paintinfo (v, p, w, h);
+  /* the first order and cross terms accumulated over the lines before y0 */
+  accum_ky = v->ky * y0;
+  accum_kyt = v->kyt * t * y0;
+  for (j = y0, y = yreset + y0; j < y1; j++, y++) {
+    accum_ky += v->ky;
+    accum_kyt += v->kyt * t;
+    delta_kxy = v->kxy * y * scale_kxy;
+    accum_kxy = delta_kxy * xreset;
+    ky2 = (v->ky2 * y * y) / h;
+    line_phase = accum_ky + accum_kyt + ky2;
+    for (i = 0; i < w; i++) {
+      int phase;
 
-  color = p->colors[COLOR_BLACK];
-  p->color = &color;
+      /* phase = phase + (v->kxy * x * y) / (w/2); */
+      /* phase = phase + accum_kxy / (w/2); */
+      accum_kxy += delta_kxy;
+
+      phase = xphase[i] + line_phase + (accum_kxy >> 16);
+
+      p->tmpline_u8[i] = sine_table[phase & 0xff];
+    }
+    videotestsrc_blend_line (v, p->tmpline, p->tmpline_u8,
+        &p->foreground_color, &p->background_color, w);
+    videotestsrc_convert_tmpline (p, frame, j);
+  }
+}
+
+void
+gst_video_test_src_zoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
+{
+  paintinfo pi = PAINT_INFO_INIT;
+  paintinfo *p = &pi;
+  int t = v->n_frames;
+  int w = frame->info.width, h = frame->info.height;
+  int xreset = -(w / 2) - v->xoffset;   /* starting values for x^2 and y^2, centering the ellipse */
+
+  videotestsrc_setup_paintinfo (v, p, w, h);
 
   /* Zoneplate equation:
    *
@@ -814,59 +983,19 @@ gst_video_test_src_zoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
   }
 #endif
 
-  /* optimised version, with original code shown in comments */
-  accum_ky = 0;
-  accum_kyt = 0;
-  kt = v->kt * t;
-  kt2 = v->kt2 * t * t;
-  for (j = 0, y = yreset; j < h; j++, y++) {
-    accum_kx = 0;
-    accum_kxt = 0;
-    accum_ky += v->ky;
-    accum_kyt += v->kyt * t;
-    delta_kxy = v->kxy * y * scale_kxy;
-    accum_kxy = delta_kxy * xreset;
-    ky2 = (v->ky2 * y * y) / h;
-    for (i = 0, x = xreset; i < w; i++, x++) {
-
-      /* zero order */
-      int phase = v->k0;
-
-      /* first order */
-      accum_kx += v->kx;
-      /* phase = phase + (v->kx * i) + (v->ky * j) + (v->kt * t); */
-      phase = phase + accum_kx + accum_ky + kt;
+  /* optimised version, the terms that only depend on x are computed once
+   * for all lines */
+  videotestsrc_zoneplate_xphase (v, v->xphase, w, t, xreset);
 
-      /* cross term */
-      accum_kxt += delta_kxt;
-      accum_kxy += delta_kxy;
-      /* phase = phase + (v->kxt * i * t) + (v->kyt * j * t); */
-      phase = phase + accum_kxt + accum_kyt;
-
-      /* phase = phase + (v->kxy * x * y) / (w/2); */
-      /* phase = phase + accum_kxy / (w/2); */
-      phase = phase + (accum_kxy >> 16);
-
-      /*second order */
-      /*normalise x/y terms to rate of change of phase at the picture edge */
-      /*phase = phase + ((v->kx2 * x * x)/w) + ((v->ky2 * y * y)/h) + ((v->kt2 * t * t)>>1); */
-      phase = phase + ((v->kx2 * x * x * scale_kx2) >> 16) + ky2 + (kt2 >> 1);
-
-      p->tmpline_u8[i] = sine_table[phase & 0xff];
-    }
-    videotestsrc_blend_line (v, p->tmpline, p->tmpline_u8,
-        &p->foreground_color, &p->background_color, w);
-    videotestsrc_convert_tmpline (p, frame, j);
-  }
+  videotestsrc_paint_bands (v, p, frame, paint_zoneplate_lines, NULL);
 }
 
-void
-gst_video_test_src_chromazoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
+static void
+paint_chromazoneplate_lines (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, gpointer user_data, int y0, int y1)
 {
   int i;
   int j;
-  paintinfo pi = PAINT_INFO_INIT;
-  paintinfo *p = &pi;
   struct vts_color_struct color;
   int t = v->n_frames;
   int w = frame->info.width, h = frame->info.height;
@@ -874,69 +1003,37 @@ gst_video_test_src_chromazoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
   int xreset = -(w / 2) - v->xoffset;   /* starting values for x^2 and y^2, centering the ellipse */
   int yreset = -(h / 2) - v->yoffset;
 
-  int x, y;
-  int accum_kx;
-  int accum_kxt;
+  int y;
   int accum_ky;
   int accum_kyt;
   int accum_kxy;
-  int kt;
-  int kt2;
   int ky2;
-  int delta_kxt = v->kxt * t;
+  int line_phase;
   int delta_kxy;
   int scale_kxy = 0xffff / (w / 2);
-  int scale_kx2 = 0xffff / w;
-
-  videotestsrc_setup_paintinfo (v, p, w, h);
+  int *xphase = v->xphase;
 
   color = p->colors[COLOR_BLACK];
   p->color = &color;
 
-  /* Zoneplate equation:
-   *
-   * phase = k0 + kx*x + ky*y + kt*t
-   *       + kxt*x*t + kyt*y*t + kxy*x*y
-   *       + kx2*x*x + ky2*y*y + Kt2*t*t
-   */
-
-  /* optimised version, with original code shown in comments */
-  accum_ky = 0;
-  accum_kyt = 0;
-  kt = v->kt * t;
-  kt2 = v->kt2 * t * t;
-  for (j = 0, y = yreset; j < h; j++, y++) {
-    accum_kx = 0;
-    accum_kxt = 0;
+  /* the first order and cross terms accumulated over the lines before y0 */
+  accum_ky = v->ky * y0;
+  accum_kyt = v->kyt * t * y0;
+  for (j = y0, y = yreset + y0; j < y1; j++, y++) {
     accum_ky += v->ky;
     accum_kyt += v->kyt * t;
     delta_kxy = v->kxy * y * scale_kxy;
     accum_kxy = delta_kxy * xreset;
     ky2 = (v->ky2 * y * y) / h;
-    for (i = 0, x = xreset; i < w; i++, x++) {
-
-      /* zero order */
-      int phase = v->k0;
-
-      /* first order */
-      accum_kx += v->kx;
-      /* phase = phase + (v->kx * i) + (v->ky * j) + (v->kt * t); */
-      phase = phase + accum_kx + accum_ky + kt;
-
-      /* cross term */
-      accum_kxt += delta_kxt;
-      accum_kxy += delta_kxy;
-      /* phase = phase + (v->kxt * i * t) + (v->kyt * j * t); */
-      phase = phase + accum_kxt + accum_kyt;
+    line_phase = accum_ky + accum_kyt + ky2;
+    for (i = 0; i < w; i++) {
+      int phase;
 
       /* phase = phase + (v->kxy * x * y) / (w/2); */
       /* phase = phase + accum_kxy / (w/2); */
-      phase = phase + (accum_kxy >> 16);
+      accum_kxy += delta_kxy;
 
-      /*second order */
-      /*normalise x/y terms to rate of change of phase at the picture edge */
-      /*phase = phase + ((v->kx2 * x * x)/w) + ((v->ky2 * y * y)/h) + ((v->kt2 * t * t)>>1); */
-      phase = phase + ((v->kx2 * x * x * scale_kx2) >> 16) + ky2 + (kt2 >> 1);
+      phase = xphase[i] + line_phase + (accum_kxy >> 16);
 
       color.Y = 128;
       color.U = sine_table[phase & 0xff];
@@ -953,26 +1050,45 @@ gst_video_test_src_chromazoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
   }
 }
 
-#undef SCALE_AMPLITUDE
 void
-gst_video_test_src_circular (GstVideoTestSrc * v, GstVideoFrame * frame)
+gst_video_test_src_chromazoneplate (GstVideoTestSrc * v, GstVideoFrame * frame)
 {
-  int i;
-  int j;
   paintinfo pi = PAINT_INFO_INIT;
   paintinfo *p = &pi;
-  double freq[8];
+  int t = v->n_frames;
   int w = frame->info.width, h = frame->info.height;
 
-  int d;
+  int xreset = -(w / 2) - v->xoffset;   /* starting values for x^2 and y^2, centering the ellipse */
 
   videotestsrc_setup_paintinfo (v, p, w, h);
 
-  for (i = 1; i < 8; i++) {
-    freq[i] = 200 * pow (2.0, -(i - 1) / 4.0);
-  }
+  /* Zoneplate equation:
+   *
+   * phase = k0 + kx*x + ky*y + kt*t
+   *       + kxt*x*t + kyt*y*t + kxy*x*y
+   *       + kx2*x*x + ky2*y*y + Kt2*t*t
+   */
 
-  for (j = 0; j < h; j++) {
+  /* optimised version, the terms that only depend on x are computed once
+   * for all lines */
+  videotestsrc_zoneplate_xphase (v, v->xphase, w, t, xreset);
+
+  videotestsrc_paint_bands (v, p, frame, paint_chromazoneplate_lines, NULL);
+}
+
+#undef SCALE_AMPLITUDE
+static void
+paint_circular_lines (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, gpointer user_data, int y0, int y1)
+{
+  int i;
+  int j;
+  const double *freq = user_data;
+  int w = frame->info.width, h = frame->info.height;
+
+  int d;
+
+  for (j = y0; j < y1; j++) {
     for (i = 0; i < w; i++) {
       double dist;
       int seg;
@@ -995,18 +1111,33 @@ gst_video_test_src_circular (GstVideoTestSrc * v, GstVideoFrame * frame)
 }
 
 void
-gst_video_test_src_gamut (GstVideoTestSrc * v, GstVideoFrame * frame)
+gst_video_test_src_circular (GstVideoTestSrc * v, GstVideoFrame * frame)
 {
-  int x, y;
+  int i;
   paintinfo pi = PAINT_INFO_INIT;
   paintinfo *p = &pi;
-  struct vts_color_struct yuv_primary;
-  struct vts_color_struct yuv_secondary;
+  double freq[8];
   int w = frame->info.width, h = frame->info.height;
 
   videotestsrc_setup_paintinfo (v, p, w, h);
 
-  for (y = 0; y < h; y++) {
+  for (i = 1; i < 8; i++) {
+    freq[i] = 200 * pow (2.0, -(i - 1) / 4.0);
+  }
+
+  videotestsrc_paint_bands (v, p, frame, paint_circular_lines, freq);
+}
+
+static void
+paint_gamut_lines (GstVideoTestSrc * v, paintinfo * p,
+    GstVideoFrame * frame, gpointer user_data, int y0, int y1)
+{
+  int x, y;
+  struct vts_color_struct yuv_primary;
+  struct vts_color_struct yuv_secondary;
+  int w = frame->info.width, h = frame->info.height;
+
+  for (y = y0; y < y1; y++) {
     int region = (y * 4) / h;
 
     switch (region) {
@@ -1046,6 +1177,18 @@ gst_video_test_src_gamut (GstVideoTestSrc * v, GstVideoFrame * frame)
   }
 }
 
+void
+gst_video_test_src_gamut (GstVideoTestSrc * v, GstVideoFrame * frame)
+{
+  paintinfo pi = PAINT_INFO_INIT;
+  paintinfo *p = &pi;
+  int w = frame->info.width, h = frame->info.height;
+
+  videotestsrc_setup_paintinfo (v, p, w, h);
+
+  videotestsrc_paint_bands (v, p, frame, paint_gamut_lines, NULL);
+}
+
 void
 gst_video_test_src_ball (GstVideoTestSrc * v, GstVideoFrame * frame)
 {
@@ -42,6 +42,7 @@
 #endif
 
 #include <string.h>
+#include <math.h>
 #include <gst/gst.h>
 #include <gst/base/gstbasetransform.h>
 #include <gst/audio/audio.h>
@@ -90,18 +91,46 @@ enum
 
 #define DEFAULT_PROP_MUTE       FALSE
 #define DEFAULT_PROP_VOLUME     1.0
+#define DEFAULT_PROP_RAMP       GST_VOLUME_RAMP_NONE
+
+/* number of frames that the controlled volume is computed for at once */
+#define VOLUME_CONTROL_BLOCK    64
 
 enum
 {
   PROP_0,
   PROP_MUTE,
-  PROP_VOLUME
+  PROP_VOLUME,
+  PROP_RAMP
 };
 
+/* i / VOLUME_CONTROL_BLOCK, for interpolating over a block */
+static gdouble volume_ramp[VOLUME_CONTROL_BLOCK];
+
+#define GST_TYPE_VOLUME_RAMP (gst_volume_ramp_get_type())
+static GType
+gst_volume_ramp_get_type (void)
+{
+  static GType volume_ramp_type = 0;
+  static const GEnumValue volume_ramps[] = {
+    {GST_VOLUME_RAMP_NONE, "Get the controlled volume for every sample",
+        "none"},
+    {GST_VOLUME_RAMP_LINEAR, "Interpolate linearly between blocks", "linear"},
+    {GST_VOLUME_RAMP_EXPONENTIAL, "Interpolate exponentially between blocks",
+        "exponential"},
+    {0, NULL, NULL},
+  };
+
+  if (G_UNLIKELY (volume_ramp_type == 0)) {
+    volume_ramp_type = g_enum_register_static ("GstVolumeRamp", volume_ramps);
+  }
+  return volume_ramp_type;
+}
+
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 #define ALLOWED_CAPS \
     GST_AUDIO_CAPS_MAKE ("{ F32LE, F64LE, S8, S16LE, S24LE, S32LE }") \
-    ", layout = (string) interleaved"
+    ", layout = (string) { interleaved, non-interleaved }"
 #else
 #define ALLOWED_CAPS \
     GST_AUDIO_CAPS_MAKE ("{ F32BE, F64BE, S8, S16BE, S24BE, S32BE }") \
@@ -122,7 +151,6 @@ static void volume_before_transform (GstBaseTransform * base,
     GstBuffer * buffer);
 static GstFlowReturn volume_transform_ip (GstBaseTransform * base,
     GstBuffer * outbuf);
-static gboolean volume_stop (GstBaseTransform * base);
 static gboolean volume_setup (GstAudioFilter * filter,
     const GstAudioInfo * info);
 
@@ -298,6 +326,7 @@ gst_volume_class_init (GstVolumeClass * klass)
   GstBaseTransformClass *trans_class;
   GstAudioFilterClass *filter_class;
   GstCaps *caps;
+  gint i;
 
   gobject_class = (GObjectClass *) klass;
   element_class = (GstElementClass *) klass;
@@ -318,6 +347,28 @@ gst_volume_class_init (GstVolumeClass * klass)
           0.0, VOLUME_MAX_DOUBLE, DEFAULT_PROP_VOLUME,
           G_PARAM_READWRITE | GST_PARAM_CONTROLLABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstVolume:ramp:
+   *
+   * How the volume is computed when the volume or mute property is
+   * controlled. By default the control bindings are asked for the value of
+   * every sample. With a ramp they are only asked for the value every 64
+   * samples and the volume is interpolated in between, which is much
+   * faster for automated volumes. Exponential ramps are linear in dB and
+   * fall back to linear ramps from and to silence. A controlled mute then
+   * fades out and in over the block.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_RAMP,
+      g_param_spec_enum ("ramp", "Ramp",
+          "Interpolation of the controlled volume between blocks of samples",
+          GST_TYPE_VOLUME_RAMP, DEFAULT_PROP_RAMP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  for (i = 0; i < VOLUME_CONTROL_BLOCK; i++)
+    volume_ramp[i] = i / (gdouble) VOLUME_CONTROL_BLOCK;
+
   gst_element_class_set_static_metadata (element_class, "Volume",
       "Filter/Effect/Audio",
       "Set volume on audio/raw streams", "Andy Wingo <wingo@pobox.com>");
@@ -328,7 +379,6 @@ gst_volume_class_init (GstVolumeClass * klass)
 
   trans_class->before_transform = GST_DEBUG_FUNCPTR (volume_before_transform);
   trans_class->transform_ip = GST_DEBUG_FUNCPTR (volume_transform_ip);
-  trans_class->stop = GST_DEBUG_FUNCPTR (volume_stop);
   trans_class->transform_ip_on_passthrough = FALSE;
 
   filter_class->setup = GST_DEBUG_FUNCPTR (volume_setup);
@@ -339,6 +389,7 @@ gst_volume_init (GstVolume * self)
 {
   self->mute = DEFAULT_PROP_MUTE;;
   self->volume = DEFAULT_PROP_VOLUME;
+  self->ramp = DEFAULT_PROP_RAMP;
 
   self->tracklist = NULL;
   self->negotiated = FALSE;
@@ -660,23 +711,6 @@ volume_setup (GstAudioFilter * filter, const GstAudioInfo * info)
   return res;
 }
 
-static gboolean
-volume_stop (GstBaseTransform * base)
-{
-  GstVolume *self = GST_VOLUME (base);
-
-  g_free (self->volumes);
-  self->volumes = NULL;
-  self->volumes_count = 0;
-
-  g_free (self->mutes);
-  self->mutes = NULL;
-  self->mutes_count = 0;
-
-  return GST_CALL_PARENT_WITH_DEFAULT (GST_BASE_TRANSFORM_CLASS, stop, (base),
-      TRUE);
-}
-
 static void
 volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
 {
@@ -708,6 +742,124 @@ volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
   }
 }
 
+/* gain at @ts, or 0.0 if the controlled mute is set */
+static gdouble
+volume_get_controlled_gain (GstVolume * self, GstClockTime ts,
+    GstControlBinding * volume_cb, GstControlBinding * mute_cb)
+{
+  gdouble volume;
+  gboolean mute;
+
+  if (!volume_cb || !gst_control_binding_get_value_array (volume_cb, ts, 0, 1,
+          (gpointer) & volume))
+    volume = self->current_volume;
+
+  if (mute_cb && gst_control_binding_get_value_array (mute_cb, ts, 0, 1,
+          (gpointer) & mute) && mute)
+    return 0.0;
+
+  return volume;
+}
+
+/* interpolates @n gains from @start up to, but not including, @end */
+static void
+volume_compute_ramp (GstVolumeRamp ramp, gdouble * volumes, gdouble start,
+    gdouble end, guint n)
+{
+  if (ramp == GST_VOLUME_RAMP_EXPONENTIAL && start > 0.0 && end > 0.0
+      && start != end) {
+    gdouble factor = pow (end / start, 1.0 / n);
+    guint i;
+
+    volumes[0] = start;
+    for (i = 1; i < n; i++)
+      volumes[i] = volumes[i - 1] * factor;
+  } else {
+    /* the ramp table goes from 0.0 to 1.0 over a full block */
+    volume_orc_ramp_f64 (volumes, volume_ramp, start,
+        (end - start) * VOLUME_CONTROL_BLOCK / n, n);
+  }
+}
+
+/* applies @volumes to @n_frames frames starting at frame @offset */
+static void
+volume_apply_controlled (GstVolume * self, GstMapInfo * map,
+    gdouble * volumes, guint offset, guint n_frames)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (self);
+  gint width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
+  gint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+
+  if (GST_AUDIO_INFO_LAYOUT (&filter->info) == GST_AUDIO_LAYOUT_NON_INTERLEAVED) {
+    gsize plane_size = map->size / channels;
+    gint c;
+
+    /* every channel is a separate plane that gets the same volumes */
+    for (c = 0; c < channels; c++)
+      self->process_controlled (self,
+          map->data + c * plane_size + offset * width, volumes, 1,
+          n_frames * width);
+  } else {
+    self->process_controlled (self, map->data + offset * width * channels,
+        volumes, channels, n_frames * width * channels);
+  }
+}
+
+/* Applies the controlled volume in blocks of VOLUME_CONTROL_BLOCK frames,
+ * so the gains fit on the stack. Without a ramp the control bindings are
+ * asked for the value of every frame, otherwise only for the value at the
+ * end of every block and the gains in between are interpolated. */
+static void
+volume_process_controlled_buffer (GstVolume * self, GstMapInfo * map,
+    GstClockTime ts, GstControlBinding * volume_cb,
+    GstControlBinding * mute_cb)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (self);
+  gint rate = GST_AUDIO_INFO_RATE (&filter->info);
+  gint width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
+  gint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  guint nsamples = map->size / (width * channels);
+  GstClockTime interval = gst_util_uint64_scale_int (1, GST_SECOND, rate);
+  gdouble volumes[VOLUME_CONTROL_BLOCK];
+  gboolean mutes[VOLUME_CONTROL_BLOCK];
+  GstVolumeRamp ramp;
+  gdouble gain = 0.0;
+  guint offset, n;
+
+  GST_OBJECT_LOCK (self);
+  ramp = self->ramp;
+  GST_OBJECT_UNLOCK (self);
+
+  if (ramp != GST_VOLUME_RAMP_NONE)
+    gain = volume_get_controlled_gain (self, ts, volume_cb, mute_cb);
+
+  for (offset = 0; offset < nsamples; offset += n) {
+    GstClockTime block_ts = ts + offset * interval;
+
+    n = MIN (nsamples - offset, VOLUME_CONTROL_BLOCK);
+
+    if (ramp == GST_VOLUME_RAMP_NONE) {
+      if (!volume_cb
+          || !gst_control_binding_get_value_array (volume_cb, block_ts,
+              interval, n, (gpointer) volumes))
+        volume_orc_memset_f64 (volumes, self->current_volume, n);
+
+      if (mute_cb && gst_control_binding_get_value_array (mute_cb, block_ts,
+              interval, n, (gpointer) mutes))
+        volume_orc_prepare_volumes (volumes, mutes, n);
+    } else {
+      gdouble next;
+
+      next = volume_get_controlled_gain (self, block_ts + n * interval,
+          volume_cb, mute_cb);
+      volume_compute_ramp (ramp, volumes, gain, next, n);
+      gain = next;
+    }
+
+    volume_apply_controlled (self, map, volumes, offset, n);
+  }
+}
+
 /* call the plugged-in process function for this instance
  * needs to be done with this indirection since volume_transform is
  * a class-global method
@@ -715,7 +867,6 @@ volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
 static GstFlowReturn
 volume_transform_ip (GstBaseTransform * base, GstBuffer * outbuf)
 {
-  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (base);
   GstVolume *self = GST_VOLUME (base);
   GstMapInfo map;
   GstClockTime ts;
@@ -738,49 +889,12 @@ volume_transform_ip (GstBaseTransform * base, GstBuffer * outbuf)
     volume_cb = gst_object_get_control_binding (GST_OBJECT (self), "volume");
 
     if (mute_cb || (volume_cb && !self->current_mute)) {
-      gint rate = GST_AUDIO_INFO_RATE (&filter->info);
-      gint width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
-      gint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
-      guint nsamples = map.size / (width * channels);
-      GstClockTime interval = gst_util_uint64_scale_int (1, GST_SECOND, rate);
-      gboolean have_mutes = FALSE;
-      gboolean have_volumes = FALSE;
-
-      if (self->mutes_count < nsamples && mute_cb) {
-        self->mutes = g_realloc (self->mutes, sizeof (gboolean) * nsamples);
-        self->mutes_count = nsamples;
-      }
+      volume_process_controlled_buffer (self, &map, ts, volume_cb, mute_cb);
 
-      if (self->volumes_count < nsamples) {
-        self->volumes = g_realloc (self->volumes, sizeof (gdouble) * nsamples);
-        self->volumes_count = nsamples;
-      }
-
-      if (volume_cb) {
-        have_volumes =
-            gst_control_binding_get_value_array (volume_cb, ts, interval,
-            nsamples, (gpointer) self->volumes);
-        gst_object_replace ((GstObject **) & volume_cb, NULL);
-      }
-      if (!have_volumes) {
-        volume_orc_memset_f64 (self->volumes, self->current_volume, nsamples);
-      }
-
-      if (mute_cb) {
-        have_mutes = gst_control_binding_get_value_array (mute_cb, ts, interval,
-            nsamples, (gpointer) self->mutes);
-        gst_object_replace ((GstObject **) & mute_cb, NULL);
-      }
-      if (have_mutes) {
-        volume_orc_prepare_volumes (self->volumes, self->mutes, nsamples);
-      } else {
-        g_free (self->mutes);
-        self->mutes = NULL;
-        self->mutes_count = 0;
-      }
-
-      self->process_controlled (self, map.data, self->volumes, channels,
-          map.size);
+      if (volume_cb)
+        gst_object_unref (volume_cb);
+      if (mute_cb)
+        gst_object_unref (mute_cb);
 
       goto done;
     } else if (volume_cb) {
@@ -826,6 +940,11 @@ volume_set_property (GObject * object, guint prop_id, const GValue * value,
       self->volume = g_value_get_double (value);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_RAMP:
+      GST_OBJECT_LOCK (self);
+      self->ramp = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -849,6 +968,11 @@ volume_get_property (GObject * object, guint prop_id, GValue * value,
       g_value_set_double (value, self->volume);
       GST_OBJECT_UNLOCK (self);
       break;
+    case PROP_RAMP:
+      GST_OBJECT_LOCK (self);
+      g_value_set_enum (value, self->ramp);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -46,6 +46,22 @@ G_BEGIN_DECLS
 typedef struct _GstVolume GstVolume;
 typedef struct _GstVolumeClass GstVolumeClass;
 
+/**
+ * GstVolumeRamp:
+ * @GST_VOLUME_RAMP_NONE: get the controlled volume for every sample
+ * @GST_VOLUME_RAMP_LINEAR: get the controlled volume for blocks of samples
+ *   and interpolate linearly in between
+ * @GST_VOLUME_RAMP_EXPONENTIAL: get the controlled volume for blocks of
+ *   samples and interpolate exponentially in between
+ *
+ * How the volume is computed when it is controlled.
+ */
+typedef enum {
+  GST_VOLUME_RAMP_NONE,
+  GST_VOLUME_RAMP_LINEAR,
+  GST_VOLUME_RAMP_EXPONENTIAL
+} GstVolumeRamp;
+
 /**
  * GstVolume:
  *
@@ -71,10 +87,7 @@ struct _GstVolume {
   GList *tracklist;
   gboolean negotiated;
 
-  gboolean *mutes;
-  guint mutes_count;
-  gdouble *volumes;
-  guint volumes_count;
+  GstVolumeRamp ramp;
 };
 
 struct _GstVolumeClass {
@@ -123,6 +123,8 @@ void volume_orc_process_controlled_int8_1ch (gint8 * ORC_RESTRICT d1,
     const gdouble * ORC_RESTRICT s1, int n);
 void volume_orc_process_controlled_int8_2ch (gint8 * ORC_RESTRICT d1,
     const gdouble * ORC_RESTRICT s1, int n);
+void volume_orc_ramp_f64 (gdouble * ORC_RESTRICT d1,
+    const gdouble * ORC_RESTRICT s1, double p1, double p2, int n);
 
 
 /* begin Orc C target preamble */
@@ -3057,3 +3059,191 @@ volume_orc_process_controlled_int8_2ch (gint8 * ORC_RESTRICT d1,
   func (ex);
 }
 #endif
+
+
+/* volume_orc_ramp_f64 */
+#ifdef DISABLE_ORC
+void
+volume_orc_ramp_f64 (gdouble * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1,
+    double p1, double p2, int n)
+{
+  int i;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union64 var33;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+
+  ptr0 = (orc_union64 *) d1;
+  ptr4 = (orc_union64 *) s1;
+
+  /* 1: loadpq */
+  var33.f = p2;
+  /* 5: loadpq */
+  var36.f = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 2: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var32.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var33.i);
+      _dest1.f = _src1.f * _src2.f;
+      var34.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 3: storeq */
+    ptr0[i] = var34;
+    /* 4: loadq */
+    var35 = ptr0[i];
+    /* 6: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _dest1.f = _src1.f + _src2.f;
+      var37.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 7: storeq */
+    ptr0[i] = var37;
+  }
+
+}
+
+#else
+static void
+_backup_volume_orc_ramp_f64 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 *ORC_RESTRICT ptr0;
+  const orc_union64 *ORC_RESTRICT ptr4;
+  orc_union64 var32;
+  orc_union64 var33;
+  orc_union64 var34;
+  orc_union64 var35;
+  orc_union64 var36;
+  orc_union64 var37;
+
+  ptr0 = (orc_union64 *) ex->arrays[0];
+  ptr4 = (orc_union64 *) ex->arrays[4];
+
+  /* 1: loadpq */
+  var33.i =
+      (ex->params[25] & 0xffffffff) | ((orc_uint64) (ex->params[25 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+  /* 5: loadpq */
+  var36.i =
+      (ex->params[24] & 0xffffffff) | ((orc_uint64) (ex->params[24 +
+              (ORC_VAR_T1 - ORC_VAR_P1)]) << 32);
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var32 = ptr4[i];
+    /* 2: muld */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var32.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var33.i);
+      _dest1.f = _src1.f * _src2.f;
+      var34.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 3: storeq */
+    ptr0[i] = var34;
+    /* 4: loadq */
+    var35 = ptr0[i];
+    /* 6: addd */
+    {
+      orc_union64 _src1;
+      orc_union64 _src2;
+      orc_union64 _dest1;
+      _src1.i = ORC_DENORMAL_DOUBLE (var35.i);
+      _src2.i = ORC_DENORMAL_DOUBLE (var36.i);
+      _dest1.f = _src1.f + _src2.f;
+      var37.i = ORC_DENORMAL_DOUBLE (_dest1.i);
+    }
+    /* 7: storeq */
+    ptr0[i] = var37;
+  }
+
+}
+
+void
+volume_orc_ramp_f64 (gdouble * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1,
+    double p1, double p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 19, 118, 111, 108, 117, 109, 101, 95, 111, 114, 99, 95, 114, 97,
+        109, 112, 95, 102, 54, 52, 11, 8, 8, 12, 8, 8, 18, 8, 18, 8,
+        214, 0, 4, 25, 212, 0, 0, 24, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p, _backup_volume_orc_ramp_f64);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "volume_orc_ramp_f64");
+      orc_program_set_backup_function (p, _backup_volume_orc_ramp_f64);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_parameter_double (p, 8, "p1");
+      orc_program_add_parameter_double (p, 8, "p2");
+
+      orc_program_append_2 (p, "muld", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addd", 0, ORC_VAR_D1, ORC_VAR_D1, ORC_VAR_P1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  {
+    orc_union64 tmp;
+    tmp.f = p1;
+    ex->params[ORC_VAR_P1] = tmp.x2[0];
+    ex->params[ORC_VAR_T1] = tmp.x2[1];
+  }
+  {
+    orc_union64 tmp;
+    tmp.f = p2;
+    ex->params[ORC_VAR_P2] = tmp.x2[0];
+    ex->params[ORC_VAR_T2] = tmp.x2[1];
+  }
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
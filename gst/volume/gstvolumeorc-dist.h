@@ -98,6 +98,7 @@ void volume_orc_process_controlled_int16_1ch (gint16 * ORC_RESTRICT d1, const gd
 void volume_orc_process_controlled_int16_2ch (gint16 * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1, int n);
 void volume_orc_process_controlled_int8_1ch (gint8 * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1, int n);
 void volume_orc_process_controlled_int8_2ch (gint8 * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1, int n);
+void volume_orc_ramp_f64 (gdouble * ORC_RESTRICT d1, const gdouble * ORC_RESTRICT s1, double p1, double p2, int n);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,135 @@
+/* GStreamer
+ *
+ * audiotestsrc.c: generation speed of the audiotestsrc waveforms
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gst/gst.h>
+
+#include "benchmark.h"
+
+/* waveforms that have a band-limited variant */
+static gboolean
+has_band_limited (const gchar * wave)
+{
+  return !strcmp (wave, "square") || !strcmp (wave, "saw") ||
+      !strcmp (wave, "triangle");
+}
+
+static gboolean
+run (const gchar * format, const gchar * wave, gboolean band_limited,
+    gint n_buffers, gint samples, gint channels)
+{
+  BenchmarkResult result;
+  gchar *desc, *params;
+  gboolean ret;
+
+  desc = g_strdup_printf ("audiotestsrc num-buffers=%d wave=%s "
+      "band-limited=%s samplesperbuffer=%d ! "
+      "audio/x-raw,format=%s,rate=48000,channels=%d ! fakesink name=sink",
+      n_buffers, wave, band_limited ? "true" : "false", samples, format,
+      channels);
+  params = g_strdup_printf ("%s %s%s %dch", format, wave,
+      band_limited ? " band-limited" : "", channels);
+
+  ret = benchmark_run_pipeline (desc, &result);
+  if (ret)
+    benchmark_print_result ("audiotestsrc", params, &result,
+        (guint64) samples * channels);
+
+  g_free (params);
+  g_free (desc);
+
+  return ret;
+}
+
+int
+main (int argc, char **argv)
+{
+  GError *err = NULL;
+  GOptionContext *ctx;
+  gint n_buffers = 100, samples = 1024, channels = 256;
+  gchar *only = NULL;
+  gchar **formats;
+  GstElement *audiotestsrc;
+  GParamSpec *pspec;
+  GEnumClass *waves;
+  guint f, w;
+  gint ret = 0;
+  GOptionEntry options[] = {
+    {"buffers", 'n', 0, G_OPTION_ARG_INT, &n_buffers,
+        "number of buffers to generate per waveform", NULL},
+    {"samples", 's', 0, G_OPTION_ARG_INT, &samples,
+        "number of samples per channel in each buffer", NULL},
+    {"channels", 'c', 0, G_OPTION_ARG_INT, &channels,
+        "number of channels", NULL},
+    {"formats", 'f', 0, G_OPTION_ARG_STRING, &only,
+        "comma separated list of formats (default: all)", NULL},
+    {NULL}
+  };
+
+  ctx = g_option_context_new ("- audiotestsrc benchmark");
+  g_option_context_add_main_entries (ctx, options, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_print ("Error initializing: %s\n", GST_STR_NULL (err->message));
+    exit (1);
+  }
+  g_option_context_free (ctx);
+
+  audiotestsrc = gst_element_factory_make ("audiotestsrc", NULL);
+  if (audiotestsrc == NULL) {
+    g_printerr ("audiotestsrc not found\n");
+    return 1;
+  }
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (audiotestsrc),
+      "wave");
+  waves = G_ENUM_CLASS (g_type_class_ref (pspec->value_type));
+  gst_object_unref (audiotestsrc);
+
+  if (only)
+    formats = g_strsplit (only, ",", -1);
+  else
+    formats = benchmark_get_formats ("audiotestsrc", GST_PAD_SRC);
+
+  benchmark_print_header ("sample");
+
+  for (f = 0; formats[f]; f++) {
+    for (w = 0; w < waves->n_values; w++) {
+      const gchar *wave = waves->values[w].value_nick;
+
+      if (!run (formats[f], wave, FALSE, n_buffers, samples, channels))
+        ret = 1;
+      if (has_band_limited (wave) &&
+          !run (formats[f], wave, TRUE, n_buffers, samples, channels))
+        ret = 1;
+    }
+  }
+
+  g_type_class_unref (waves);
+  g_strfreev (formats);
+  g_free (only);
+
+  return ret;
+}
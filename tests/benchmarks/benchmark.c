@@ -0,0 +1,192 @@
+/* GStreamer
+ *
+ * benchmark.c: helpers shared by the element benchmarks
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "benchmark.h"
+
+/* The results are printed as comma separated values, one line per run, so
+ * that they can be compared between builds with a script. */
+
+static guint64
+benchmark_read_cycles (void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+  guint32 lo, hi;
+
+  __asm__ __volatile__ ("rdtsc":"=a" (lo), "=d" (hi));
+  return ((guint64) hi << 32) | lo;
+#else
+  return 0;
+#endif
+}
+
+static void
+handoff_cb (GstElement * sink, GstBuffer * buffer, GstPad * pad,
+    BenchmarkResult * result)
+{
+  result->n_buffers++;
+  result->n_bytes += gst_buffer_get_size (buffer);
+}
+
+/* Run the pipeline in @description until EOS. The pipeline must end in a
+ * fakesink named "sink". Returns FALSE when the pipeline could not be
+ * created or posted an error. */
+gboolean
+benchmark_run_pipeline (const gchar * description, BenchmarkResult * result)
+{
+  GstElement *pipeline, *sink;
+  GstBus *bus;
+  GstMessage *msg;
+  GError *err = NULL;
+  GstClockTime start;
+  guint64 start_cycles;
+  gboolean ret;
+
+  memset (result, 0, sizeof (BenchmarkResult));
+
+  pipeline = gst_parse_launch (description, &err);
+  if (pipeline == NULL) {
+    g_printerr ("could not create pipeline '%s': %s\n", description,
+        GST_STR_NULL (err ? err->message : NULL));
+    g_clear_error (&err);
+    return FALSE;
+  }
+  /* a recoverable error, like an unknown property */
+  g_clear_error (&err);
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "sink");
+  g_assert (sink != NULL);
+  g_object_set (sink, "signal-handoffs", TRUE, "sync", FALSE, NULL);
+  g_signal_connect (sink, "handoff", G_CALLBACK (handoff_cb), result);
+
+  bus = gst_element_get_bus (pipeline);
+
+  start = gst_util_get_timestamp ();
+  start_cycles = benchmark_read_cycles ();
+
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+
+  result->cycles = benchmark_read_cycles () - start_cycles;
+  result->elapsed = gst_util_get_timestamp () - start;
+
+  ret = GST_MESSAGE_TYPE (msg) == GST_MESSAGE_EOS;
+  if (!ret) {
+    gchar *debug = NULL;
+
+    gst_message_parse_error (msg, &err, &debug);
+    g_printerr ("error running '%s': %s\n%s\n", description,
+        GST_STR_NULL (err->message), GST_STR_NULL (debug));
+    g_clear_error (&err);
+    g_free (debug);
+  }
+  gst_message_unref (msg);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (bus);
+  gst_object_unref (sink);
+  gst_object_unref (pipeline);
+
+  return ret;
+}
+
+void
+benchmark_print_header (const gchar * unit)
+{
+  g_print ("element,parameters,buffers,seconds,buffers_per_second,"
+      "bytes_per_second,cycles_per_%s\n", unit);
+}
+
+/* @units_per_buffer is the number of pixels or samples in each buffer, used
+ * for the cycle count per unit */
+void
+benchmark_print_result (const gchar * element, const gchar * parameters,
+    const BenchmarkResult * result, guint64 units_per_buffer)
+{
+  gdouble secs, cycles_per_unit = 0.0;
+  gchar cycles[G_ASCII_DTOSTR_BUF_SIZE] = "";
+
+  secs = (gdouble) result->elapsed / GST_SECOND;
+  if (secs <= 0.0)
+    secs = 1e-9;
+
+  if (result->cycles && result->n_buffers && units_per_buffer) {
+    cycles_per_unit = (gdouble) result->cycles /
+        (result->n_buffers * units_per_buffer);
+    g_ascii_formatd (cycles, sizeof (cycles), "%.3f", cycles_per_unit);
+  }
+
+  g_print ("%s,%s,%" G_GUINT64_FORMAT ",%.6f,%.3f,%.0f,%s\n", element,
+      parameters, result->n_buffers, secs, result->n_buffers / secs,
+      result->n_bytes / secs, cycles);
+}
+
+/* Get the formats in the "format" field of the always pad template of
+ * @factory_name in @direction. Free with g_strfreev(). */
+gchar **
+benchmark_get_formats (const gchar * factory_name, GstPadDirection direction)
+{
+  GstElementFactory *factory;
+  const GList *l;
+  GPtrArray *formats;
+
+  formats = g_ptr_array_new ();
+
+  factory = gst_element_factory_find (factory_name);
+  if (factory == NULL)
+    goto done;
+
+  for (l = gst_element_factory_get_static_pad_templates (factory); l;
+      l = l->next) {
+    GstStaticPadTemplate *templ = l->data;
+    GstCaps *caps;
+    const GValue *list;
+    guint i;
+
+    if (templ->direction != direction || templ->presence != GST_PAD_ALWAYS)
+      continue;
+
+    caps = gst_static_pad_template_get_caps (templ);
+    list = gst_structure_get_value (gst_caps_get_structure (caps, 0),
+        "format");
+    if (list && GST_VALUE_HOLDS_LIST (list)) {
+      for (i = 0; i < gst_value_list_get_size (list); i++) {
+        const GValue *v = gst_value_list_get_value (list, i);
+
+        g_ptr_array_add (formats, g_value_dup_string (v));
+      }
+    } else if (list && G_VALUE_HOLDS_STRING (list)) {
+      g_ptr_array_add (formats, g_value_dup_string (list));
+    }
+    gst_caps_unref (caps);
+    break;
+  }
+  gst_object_unref (factory);
+
+done:
+  g_ptr_array_add (formats, NULL);
+  return (gchar **) g_ptr_array_free (formats, FALSE);
+}
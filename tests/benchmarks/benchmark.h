@@ -0,0 +1,53 @@
+/* GStreamer
+ *
+ * benchmark.h: helpers shared by the element benchmarks
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+typedef struct
+{
+  /* buffers and bytes that arrived in the sink */
+  guint64 n_buffers;
+  guint64 n_bytes;
+  /* wall clock time and reference cycles (0 when not available) from
+   * PLAYING to EOS */
+  GstClockTime elapsed;
+  guint64 cycles;
+} BenchmarkResult;
+
+gboolean  benchmark_run_pipeline   (const gchar * description,
+                                    BenchmarkResult * result);
+
+void      benchmark_print_header   (const gchar * unit);
+void      benchmark_print_result   (const gchar * element,
+                                    const gchar * parameters,
+                                    const BenchmarkResult * result,
+                                    guint64 units_per_buffer);
+
+gchar **  benchmark_get_formats    (const gchar * factory_name,
+                                    GstPadDirection direction);
+
+G_END_DECLS
+
+#endif /* __BENCHMARK_H__ */
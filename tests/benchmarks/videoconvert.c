@@ -0,0 +1,104 @@
+/* GStreamer
+ *
+ * videoconvert.c: throughput of videoconvert for all format pairs
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gst/gst.h>
+
+#include "benchmark.h"
+
+int
+main (int argc, char **argv)
+{
+  GError *err = NULL;
+  GOptionContext *ctx;
+  gint n_buffers = 50, width = 640, height = 480;
+  gchar *only = NULL;
+  gchar **formats, **in_formats;
+  guint i, j;
+  gint ret = 0;
+  GOptionEntry options[] = {
+    {"buffers", 'n', 0, G_OPTION_ARG_INT, &n_buffers,
+        "number of frames to convert per format pair", NULL},
+    {"width", 0, 0, G_OPTION_ARG_INT, &width, "width of the frames", NULL},
+    {"height", 0, 0, G_OPTION_ARG_INT, &height, "height of the frames",
+        NULL},
+    {"formats", 'f', 0, G_OPTION_ARG_STRING, &only,
+        "comma separated list of input formats (default: all)", NULL},
+    {NULL}
+  };
+
+  ctx = g_option_context_new ("- videoconvert benchmark");
+  g_option_context_add_main_entries (ctx, options, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_print ("Error initializing: %s\n", GST_STR_NULL (err->message));
+    exit (1);
+  }
+  g_option_context_free (ctx);
+
+  formats = benchmark_get_formats ("videoconvert", GST_PAD_SRC);
+  if (formats[0] == NULL) {
+    g_printerr ("videoconvert not found\n");
+    return 1;
+  }
+  in_formats = only ? g_strsplit (only, ",", -1) : g_strdupv (formats);
+
+  benchmark_print_header ("pixel");
+
+  for (i = 0; in_formats[i]; i++) {
+    for (j = 0; formats[j]; j++) {
+      BenchmarkResult result;
+      gchar *desc, *params;
+
+      /* same formats are passed through */
+      if (!strcmp (in_formats[i], formats[j]))
+        continue;
+
+      /* the input frame is rendered once, we only measure the conversion */
+      desc = g_strdup_printf ("videotestsrc num-buffers=%d cache-static=true "
+          "! video/x-raw,format=%s,width=%d,height=%d,framerate=30/1 "
+          "! videoconvert ! video/x-raw,format=%s ! fakesink name=sink",
+          n_buffers, in_formats[i], width, height, formats[j]);
+      params = g_strdup_printf ("%s>%s %dx%d", in_formats[i], formats[j],
+          width, height);
+
+      if (benchmark_run_pipeline (desc, &result))
+        benchmark_print_result ("videoconvert", params, &result,
+            (guint64) width * height);
+      else
+        ret = 1;
+
+      g_free (params);
+      g_free (desc);
+    }
+  }
+
+  g_strfreev (in_formats);
+  g_strfreev (formats);
+  g_free (only);
+
+  return ret;
+}
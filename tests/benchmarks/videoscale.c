@@ -0,0 +1,124 @@
+/* GStreamer
+ *
+ * videoscale.c: throughput of videoscale for all methods
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <gst/gst.h>
+
+#include "benchmark.h"
+
+static const struct
+{
+  gint in_width, in_height;
+  gint out_width, out_height;
+} sizes[] = {
+  {
+  320, 240, 640, 480}, {
+  640, 480, 320, 240}, {
+  640, 480, 1280, 720}, {
+  1280, 720, 1920, 1080}, {
+  1920, 1080, 1280, 720}, {
+  1920, 1080, 3840, 2160}, {
+  3840, 2160, 1920, 1080}
+};
+
+int
+main (int argc, char **argv)
+{
+  GError *err = NULL;
+  GOptionContext *ctx;
+  gint n_buffers = 20;
+  gchar *only = NULL;
+  gchar **formats;
+  GstElement *videoscale;
+  GParamSpec *pspec;
+  GEnumClass *methods;
+  guint f, m, s;
+  gint ret = 0;
+  GOptionEntry options[] = {
+    {"buffers", 'n', 0, G_OPTION_ARG_INT, &n_buffers,
+        "number of frames to scale per run", NULL},
+    {"formats", 'f', 0, G_OPTION_ARG_STRING, &only,
+        "comma separated list of formats (default: I420,AYUV)", NULL},
+    {NULL}
+  };
+
+  ctx = g_option_context_new ("- videoscale benchmark");
+  g_option_context_add_main_entries (ctx, options, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_print ("Error initializing: %s\n", GST_STR_NULL (err->message));
+    exit (1);
+  }
+  g_option_context_free (ctx);
+
+  videoscale = gst_element_factory_make ("videoscale", NULL);
+  if (videoscale == NULL) {
+    g_printerr ("videoscale not found\n");
+    return 1;
+  }
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (videoscale),
+      "method");
+  methods = G_ENUM_CLASS (g_type_class_ref (pspec->value_type));
+  gst_object_unref (videoscale);
+
+  formats = g_strsplit (only ? only : "I420,AYUV", ",", -1);
+
+  benchmark_print_header ("pixel");
+
+  for (f = 0; formats[f]; f++) {
+    for (m = 0; m < methods->n_values; m++) {
+      for (s = 0; s < G_N_ELEMENTS (sizes); s++) {
+        BenchmarkResult result;
+        gchar *desc, *params;
+
+        desc = g_strdup_printf ("videotestsrc num-buffers=%d "
+            "cache-static=true ! video/x-raw,format=%s,width=%d,height=%d,"
+            "framerate=30/1 ! videoscale method=%s ! "
+            "video/x-raw,width=%d,height=%d ! fakesink name=sink", n_buffers,
+            formats[f], sizes[s].in_width, sizes[s].in_height,
+            methods->values[m].value_nick, sizes[s].out_width,
+            sizes[s].out_height);
+        params = g_strdup_printf ("%s %s %dx%d>%dx%d", formats[f],
+            methods->values[m].value_nick, sizes[s].in_width,
+            sizes[s].in_height, sizes[s].out_width, sizes[s].out_height);
+
+        if (benchmark_run_pipeline (desc, &result))
+          benchmark_print_result ("videoscale", params, &result,
+              (guint64) sizes[s].out_width * sizes[s].out_height);
+        else
+          ret = 1;
+
+        g_free (params);
+        g_free (desc);
+      }
+    }
+  }
+
+  g_type_class_unref (methods);
+  g_strfreev (formats);
+  g_free (only);
+
+  return ret;
+}
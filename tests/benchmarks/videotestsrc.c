@@ -0,0 +1,110 @@
+/* GStreamer
+ *
+ * videotestsrc.c: rendering speed of the videotestsrc patterns
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <gst/gst.h>
+
+#include "benchmark.h"
+
+int
+main (int argc, char **argv)
+{
+  GError *err = NULL;
+  GOptionContext *ctx;
+  gint n_buffers = 50, width = 1920, height = 1080, n_threads = 1;
+  gchar *only = NULL;
+  gchar **formats;
+  GstElement *videotestsrc;
+  GParamSpec *pspec;
+  GEnumClass *patterns;
+  guint f, p;
+  gint ret = 0;
+  GOptionEntry options[] = {
+    {"buffers", 'n', 0, G_OPTION_ARG_INT, &n_buffers,
+        "number of frames to render per pattern", NULL},
+    {"width", 0, 0, G_OPTION_ARG_INT, &width, "width of the frames", NULL},
+    {"height", 0, 0, G_OPTION_ARG_INT, &height, "height of the frames",
+        NULL},
+    {"threads", 't', 0, G_OPTION_ARG_INT, &n_threads,
+        "number of rendering threads", NULL},
+    {"formats", 'f', 0, G_OPTION_ARG_STRING, &only,
+        "comma separated list of formats (default: I420,AYUV,RGBx)", NULL},
+    {NULL}
+  };
+
+  ctx = g_option_context_new ("- videotestsrc benchmark");
+  g_option_context_add_main_entries (ctx, options, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_print ("Error initializing: %s\n", GST_STR_NULL (err->message));
+    exit (1);
+  }
+  g_option_context_free (ctx);
+
+  videotestsrc = gst_element_factory_make ("videotestsrc", NULL);
+  if (videotestsrc == NULL) {
+    g_printerr ("videotestsrc not found\n");
+    return 1;
+  }
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (videotestsrc),
+      "pattern");
+  patterns = G_ENUM_CLASS (g_type_class_ref (pspec->value_type));
+  gst_object_unref (videotestsrc);
+
+  formats = g_strsplit (only ? only : "I420,AYUV,RGBx", ",", -1);
+
+  benchmark_print_header ("pixel");
+
+  for (f = 0; formats[f]; f++) {
+    for (p = 0; p < patterns->n_values; p++) {
+      BenchmarkResult result;
+      gchar *desc, *params;
+
+      /* animate the zone plates so that they are rendered for every frame */
+      desc = g_strdup_printf ("videotestsrc num-buffers=%d pattern=%s "
+          "n-threads=%d kx2=20 ky2=20 kt=1 ! "
+          "video/x-raw,format=%s,width=%d,height=%d,framerate=30/1 ! "
+          "fakesink name=sink", n_buffers, patterns->values[p].value_nick,
+          n_threads, formats[f], width, height);
+      params = g_strdup_printf ("%s %s %dx%d threads=%d", formats[f],
+          patterns->values[p].value_nick, width, height, n_threads);
+
+      if (benchmark_run_pipeline (desc, &result))
+        benchmark_print_result ("videotestsrc", params, &result,
+            (guint64) width * height);
+      else
+        ret = 1;
+
+      g_free (params);
+      g_free (desc);
+    }
+  }
+
+  g_type_class_unref (patterns);
+  g_strfreev (formats);
+  g_free (only);
+
+  return ret;
+}
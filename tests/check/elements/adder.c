@@ -1248,6 +1248,528 @@ GST_START_TEST (test_flush_start_flush_stop)
 GST_END_TEST;
 
 
+static void
+fill_buffer_cb (GstElement * fakesrc, GstBuffer * buffer, GstPad * pad,
+    gpointer user_data)
+{
+  gint16 value = GPOINTER_TO_INT (user_data);
+  GstMapInfo map;
+  gint16 *samples;
+  guint i;
+
+  gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+  samples = (gint16 *) map.data;
+  for (i = 0; i < map.size / sizeof (gint16); i++)
+    samples[i] = value;
+  gst_buffer_unmap (buffer, &map);
+}
+
+static gint16 expected_sample;
+static guint mixed_buffers;
+static guint64 skipped_buffers, passthrough_buffers;
+
+static void
+check_mixed_buffer_cb (GstElement * fakesink, GstBuffer * buffer,
+    GstPad * pad, gpointer user_data)
+{
+  GstMapInfo map;
+  gint16 *samples;
+  guint i;
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  for (i = 0; i < map.size / sizeof (gint16); i++)
+    fail_unless_equals_int (samples[i], expected_sample);
+  gst_buffer_unmap (buffer, &map);
+  mixed_buffers++;
+}
+
+/* mixes constant S16 streams with the given values and pad volumes and
+ * checks that every output sample is @expected */
+static void
+run_mix_test (const gint16 * values, const gdouble * volumes, guint n_srcs,
+    gboolean float_accumulator, gint16 expected)
+{
+  GstElement *bin, *adder, *sink;
+  GstBus *bus;
+  GstCaps *caps;
+  GstStateChangeReturn state_res;
+  guint i;
+
+  bin = gst_pipeline_new ("pipeline");
+  bus = gst_element_get_bus (bin);
+  gst_bus_add_signal_watch_full (bus, G_PRIORITY_HIGH);
+
+  adder = gst_element_factory_make ("adder", "adder");
+  g_object_set (adder, "float-accumulator", float_accumulator, NULL);
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) check_mixed_buffer_cb, NULL);
+  gst_bin_add_many (GST_BIN (bin), adder, sink, NULL);
+  fail_unless (gst_element_link (adder, sink));
+
+  caps = gst_caps_new_simple ("audio/x-raw",
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+      "format", G_TYPE_STRING, "S16BE",
+#else
+      "format", G_TYPE_STRING, "S16LE",
+#endif
+      "layout", G_TYPE_STRING, "interleaved",
+      "rate", G_TYPE_INT, 8000, "channels", G_TYPE_INT, 1, NULL);
+
+  for (i = 0; i < n_srcs; i++) {
+    GstElement *src, *capsfilter;
+    GstPad *srcpad, *sinkpad;
+
+    src = gst_element_factory_make ("fakesrc", NULL);
+    g_object_set (src, "num-buffers", 5, "sizetype", 2, "sizemax", 800,
+        "format", GST_FORMAT_TIME, "signal-handoffs", TRUE, NULL);
+    g_signal_connect (src, "handoff", (GCallback) fill_buffer_cb,
+        GINT_TO_POINTER (values[i]));
+    capsfilter = gst_element_factory_make ("capsfilter", NULL);
+    g_object_set (capsfilter, "caps", caps, NULL);
+    gst_bin_add_many (GST_BIN (bin), src, capsfilter, NULL);
+    fail_unless (gst_element_link (src, capsfilter));
+
+    sinkpad = gst_element_get_request_pad (adder, "sink_%u");
+    fail_if (sinkpad == NULL);
+    g_object_set (sinkpad, "volume", volumes[i], NULL);
+    srcpad = gst_element_get_static_pad (capsfilter, "src");
+    fail_unless (gst_pad_link (srcpad, sinkpad) == GST_PAD_LINK_OK);
+    gst_object_unref (srcpad);
+    gst_object_unref (sinkpad);
+  }
+  gst_caps_unref (caps);
+
+  main_loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (bus, "message::error", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::warning", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::eos", (GCallback) message_received, bin);
+
+  expected_sample = expected;
+  mixed_buffers = 0;
+
+  state_res = gst_element_set_state (bin, GST_STATE_PLAYING);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  g_main_loop_run (main_loop);
+
+  /* 5 buffers of 400 samples from every source */
+  ck_assert_int_eq (mixed_buffers, 5);
+
+  g_object_get (adder, "skipped-buffers", &skipped_buffers,
+      "passthrough-buffers", &passthrough_buffers, NULL);
+
+  state_res = gst_element_set_state (bin, GST_STATE_NULL);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  g_main_loop_unref (main_loop);
+  gst_bus_remove_signal_watch (bus);
+  gst_object_unref (bus);
+  gst_object_unref (bin);
+}
+
+/* check that mixing more streams than are added in one pass works, with
+ * and without volume */
+GST_START_TEST (test_mix_many)
+{
+  const gint16 values[] = { 100, -200, 300, 400, 500, -600, 700, 800, 900 };
+  const gdouble volumes[] = { 1.0, 0.5, 1.0, 2.0, 1.0, 1.0, 0.5, 1.0, 1.0 };
+  guint n;
+
+  /* the first stream becomes the output buffer, then one group of four and
+   * up to four streams that are added one by one */
+  for (n = 1; n <= G_N_ELEMENTS (values); n++) {
+    gint expected = 0;
+    guint i;
+
+    for (i = 0; i < n; i++)
+      expected += values[i] * volumes[i];
+
+    GST_INFO ("mixing %u streams", n);
+    run_mix_test (values, volumes, n, FALSE, expected);
+  }
+}
+
+GST_END_TEST;
+
+/* with the float accumulator only the final sum is clipped */
+GST_START_TEST (test_float_accumulator)
+{
+  const gint16 values[] = { 30000, 30000, -30000, 10000, -10000, -5000 };
+  const gdouble volumes[] = { 1.0, 1.0, 1.0, 1.0, 1.0, 2.0 };
+
+  run_mix_test (values, volumes, 3, TRUE, 30000);
+  run_mix_test (values, volumes, 6, TRUE, 20000);
+}
+
+GST_END_TEST;
+
+/* silent streams are skipped and a single stream with sound is pushed
+ * without mixing */
+GST_START_TEST (test_skip_silence)
+{
+  const gint16 values[] = { 0, 1000, 0, -300 };
+  const gdouble volumes[] = { 1.0, 1.0, 1.0, 1.0 };
+  const gdouble half_volumes[] = { 1.0, 0.5, 1.0, 1.0 };
+
+  run_mix_test (values, volumes, 2, FALSE, 1000);
+  ck_assert_int_eq (skipped_buffers, 5);
+  ck_assert_int_eq (passthrough_buffers, 5);
+
+  /* the volume still has to be applied */
+  run_mix_test (values, half_volumes, 2, FALSE, 500);
+  ck_assert_int_eq (skipped_buffers, 5);
+  ck_assert_int_eq (passthrough_buffers, 0);
+
+  run_mix_test (values, volumes, 4, FALSE, 700);
+  ck_assert_int_eq (skipped_buffers, 10);
+  ck_assert_int_eq (passthrough_buffers, 0);
+
+  /* only silence, one of the inputs is pushed as a GAP buffer */
+  run_mix_test (values, volumes, 1, FALSE, 0);
+  ck_assert_int_eq (skipped_buffers, 5);
+  ck_assert_int_eq (passthrough_buffers, 5);
+}
+
+GST_END_TEST;
+
+static void
+fill_planar_buffer_cb (GstElement * fakesrc, GstBuffer * buffer, GstPad * pad,
+    gpointer user_data)
+{
+  const gint16 *values = user_data;
+  GstMapInfo map;
+  gint16 *samples;
+  guint i, n;
+
+  gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+  samples = (gint16 *) map.data;
+  n = map.size / sizeof (gint16);
+  for (i = 0; i < n; i++)
+    samples[i] = values[i < n / 2 ? 0 : 1];
+  gst_buffer_unmap (buffer, &map);
+}
+
+static gint16 expected_planes[2];
+static guint mixed_frames;
+
+static void
+check_planar_buffer_cb (GstElement * fakesink, GstBuffer * buffer,
+    GstPad * pad, gpointer user_data)
+{
+  GstMapInfo map;
+  gint16 *samples;
+  guint i, n;
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  n = map.size / sizeof (gint16);
+  for (i = 0; i < n; i++)
+    fail_unless_equals_int (samples[i], expected_planes[i < n / 2 ? 0 : 1]);
+  gst_buffer_unmap (buffer, &map);
+  mixed_frames += n / 2;
+}
+
+/* mixes two non-interleaved stereo streams with differently sized buffers,
+ * every output plane must only contain the sum of the input planes */
+GST_START_TEST (test_non_interleaved)
+{
+  const gint16 values[2][2] = { {100, -200}, {1000, 3000} };
+  /* 6 buffers of 200 and 4 buffers of 300 frames */
+  const gint sizes[2] = { 800, 1200 }, n_buffers[2] = { 6, 4 };
+  GstElement *bin, *adder, *sink;
+  GstBus *bus;
+  GstCaps *caps;
+  GstStateChangeReturn state_res;
+  guint i;
+
+  bin = gst_pipeline_new ("pipeline");
+  bus = gst_element_get_bus (bin);
+  gst_bus_add_signal_watch_full (bus, G_PRIORITY_HIGH);
+
+  adder = gst_element_factory_make ("adder", "adder");
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) check_planar_buffer_cb, NULL);
+  gst_bin_add_many (GST_BIN (bin), adder, sink, NULL);
+  fail_unless (gst_element_link (adder, sink));
+
+  caps = gst_caps_new_simple ("audio/x-raw",
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+      "format", G_TYPE_STRING, "S16BE",
+#else
+      "format", G_TYPE_STRING, "S16LE",
+#endif
+      "layout", G_TYPE_STRING, "non-interleaved",
+      "rate", G_TYPE_INT, 8000, "channels", G_TYPE_INT, 2, NULL);
+
+  for (i = 0; i < 2; i++) {
+    GstElement *src, *capsfilter;
+    GstPad *srcpad, *sinkpad;
+
+    src = gst_element_factory_make ("fakesrc", NULL);
+    g_object_set (src, "num-buffers", n_buffers[i], "sizetype", 2,
+        "sizemax", sizes[i], "format", GST_FORMAT_TIME, "signal-handoffs",
+        TRUE, NULL);
+    g_signal_connect (src, "handoff", (GCallback) fill_planar_buffer_cb,
+        (gpointer) values[i]);
+    capsfilter = gst_element_factory_make ("capsfilter", NULL);
+    g_object_set (capsfilter, "caps", caps, NULL);
+    gst_bin_add_many (GST_BIN (bin), src, capsfilter, NULL);
+    fail_unless (gst_element_link (src, capsfilter));
+
+    sinkpad = gst_element_get_request_pad (adder, "sink_%u");
+    fail_if (sinkpad == NULL);
+    srcpad = gst_element_get_static_pad (capsfilter, "src");
+    fail_unless (gst_pad_link (srcpad, sinkpad) == GST_PAD_LINK_OK);
+    gst_object_unref (srcpad);
+    gst_object_unref (sinkpad);
+  }
+  gst_caps_unref (caps);
+
+  main_loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (bus, "message::error", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::warning", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::eos", (GCallback) message_received, bin);
+
+  expected_planes[0] = values[0][0] + values[1][0];
+  expected_planes[1] = values[0][1] + values[1][1];
+  mixed_frames = 0;
+
+  state_res = gst_element_set_state (bin, GST_STATE_PLAYING);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  g_main_loop_run (main_loop);
+
+  ck_assert_int_eq (mixed_frames, 1200);
+
+  state_res = gst_element_set_state (bin, GST_STATE_NULL);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  g_main_loop_unref (main_loop);
+  gst_bus_remove_signal_watch (bus);
+  gst_object_unref (bus);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
+static guint timeout_buffers;
+
+static void
+count_timeout_buffer_cb (GstElement * fakesink, GstBuffer * buffer,
+    GstPad * pad, gpointer user_data)
+{
+  if (++timeout_buffers == 10)
+    g_main_loop_quit (main_loop);
+}
+
+/* with the latency set, a pad that never gets data does not stall a live
+ * pipeline */
+GST_START_TEST (test_live_timeout)
+{
+  GstElement *bin, *src, *adder, *sink;
+  GstPad *idlepad;
+  GstBus *bus;
+  GstStateChangeReturn state_res;
+  guint64 missed;
+
+  bin = gst_pipeline_new ("pipeline");
+  bus = gst_element_get_bus (bin);
+  gst_bus_add_signal_watch_full (bus, G_PRIORITY_HIGH);
+
+  src = gst_element_factory_make ("audiotestsrc", "src");
+  g_object_set (src, "is-live", TRUE, "samplesperbuffer", 441, NULL);
+  adder = gst_element_factory_make ("adder", "adder");
+  g_object_set (adder, "latency", 20 * GST_MSECOND, NULL);
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) count_timeout_buffer_cb,
+      NULL);
+  gst_bin_add_many (GST_BIN (bin), src, adder, sink, NULL);
+  fail_unless (gst_element_link_many (src, adder, sink, NULL));
+
+  /* this pad never gets any data */
+  idlepad = gst_element_get_request_pad (adder, "sink_%u");
+  fail_if (idlepad == NULL);
+
+  main_loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (bus, "message::error", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::warning", (GCallback) message_received, bin);
+
+  timeout_buffers = 0;
+  state_res = gst_element_set_state (bin, GST_STATE_PLAYING);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  g_main_loop_run (main_loop);
+  fail_unless (timeout_buffers >= 10);
+
+  g_object_get (idlepad, "missed-deadlines", &missed, NULL);
+  fail_unless (missed > 0);
+
+  state_res = gst_element_set_state (bin, GST_STATE_NULL);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  gst_element_release_request_pad (adder, idlepad);
+  gst_object_unref (idlepad);
+
+  g_main_loop_unref (main_loop);
+  gst_bus_remove_signal_watch (bus);
+  gst_object_unref (bus);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+#define LATE_FORMAT "S16BE"
+#else
+#define LATE_FORMAT "S16LE"
+#endif
+
+#define LATE_CAPS_STRING \
+    "audio/x-raw, format = (string) " LATE_FORMAT ", " \
+    "layout = (string) interleaved, rate = (int) 44100, channels = (int) 1"
+
+static gint late_output_buffers;
+static gboolean late_data_mixed;
+
+static void
+check_late_buffer_cb (GstElement * fakesink, GstBuffer * buffer,
+    GstPad * pad, gpointer user_data)
+{
+  GstMapInfo map;
+  gint16 *samples;
+  guint i;
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  for (i = 0; i < map.size / sizeof (gint16); i++) {
+    if (samples[i] == 1000)
+      late_data_mixed = TRUE;
+    else
+      fail_unless_equals_int (samples[i], 0);
+  }
+  gst_buffer_unmap (buffer, &map);
+
+  if (g_atomic_int_add (&late_output_buffers, 1) + 1 == 40)
+    g_main_loop_quit (main_loop);
+}
+
+/* waits until the adder mixed a while without the late pad, then pushes
+ * data for the late pad starting at running time 0 */
+static gpointer
+push_late_data (gpointer user_data)
+{
+  GstPad *srcpad = user_data;
+  GstSegment segment;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  GstMapInfo map;
+  gint16 *samples;
+  guint i, j;
+
+  while (g_atomic_int_get (&late_output_buffers) < 5)
+    g_usleep (G_USEC_PER_SEC / 1000);
+
+  gst_pad_push_event (srcpad, gst_event_new_stream_start ("late"));
+  caps = gst_caps_from_string (LATE_CAPS_STRING);
+  gst_pad_push_event (srcpad, gst_event_new_caps (caps));
+  gst_caps_unref (caps);
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  gst_pad_push_event (srcpad, gst_event_new_segment (&segment));
+
+  /* 100ms buffers, the first one is completely or partially late */
+  for (j = 0; j < 3; j++) {
+    buffer = gst_buffer_new_and_alloc (4410 * sizeof (gint16));
+    gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+    samples = (gint16 *) map.data;
+    for (i = 0; i < 4410; i++)
+      samples[i] = 1000;
+    gst_buffer_unmap (buffer, &map);
+    GST_BUFFER_TIMESTAMP (buffer) = j * 100 * GST_MSECOND;
+    GST_BUFFER_DURATION (buffer) = 100 * GST_MSECOND;
+
+    if (gst_pad_push (srcpad, buffer) != GST_FLOW_OK)
+      break;
+  }
+
+  return NULL;
+}
+
+/* a pad that missed deadlines and delivers data later only gets the part
+ * mixed that was not output yet */
+GST_START_TEST (test_live_timeout_late_data)
+{
+  GstElement *bin, *src, *capsfilter, *adder, *sink;
+  GstPad *latepad, *srcpad;
+  GstBus *bus;
+  GstCaps *caps;
+  GstStateChangeReturn state_res;
+  GThread *thread;
+  guint64 missed, late;
+
+  bin = gst_pipeline_new ("pipeline");
+  bus = gst_element_get_bus (bin);
+  gst_bus_add_signal_watch_full (bus, G_PRIORITY_HIGH);
+
+  src = gst_element_factory_make ("audiotestsrc", "src");
+  g_object_set (src, "is-live", TRUE, "samplesperbuffer", 441, NULL);
+  gst_util_set_object_arg (G_OBJECT (src), "wave", "silence");
+  capsfilter = gst_element_factory_make ("capsfilter", NULL);
+  caps = gst_caps_from_string (LATE_CAPS_STRING);
+  g_object_set (capsfilter, "caps", caps, NULL);
+  gst_caps_unref (caps);
+  adder = gst_element_factory_make ("adder", "adder");
+  g_object_set (adder, "latency", 20 * GST_MSECOND, NULL);
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) check_late_buffer_cb, NULL);
+  gst_bin_add_many (GST_BIN (bin), src, capsfilter, adder, sink, NULL);
+  fail_unless (gst_element_link_many (src, capsfilter, adder, sink, NULL));
+
+  latepad = gst_element_get_request_pad (adder, "sink_%u");
+  fail_if (latepad == NULL);
+  srcpad = gst_pad_new ("src", GST_PAD_SRC);
+  gst_pad_set_active (srcpad, TRUE);
+  fail_unless (gst_pad_link (srcpad, latepad) == GST_PAD_LINK_OK);
+
+  main_loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (bus, "message::error", (GCallback) message_received, bin);
+  g_signal_connect (bus, "message::warning", (GCallback) message_received, bin);
+
+  late_output_buffers = 0;
+  late_data_mixed = FALSE;
+  state_res = gst_element_set_state (bin, GST_STATE_PLAYING);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+
+  thread = g_thread_new ("late", push_late_data, srcpad);
+  g_main_loop_run (main_loop);
+
+  state_res = gst_element_set_state (bin, GST_STATE_NULL);
+  ck_assert_int_ne (state_res, GST_STATE_CHANGE_FAILURE);
+  g_thread_join (thread);
+
+  g_object_get (latepad, "missed-deadlines", &missed, "late-buffers", &late,
+      NULL);
+  fail_unless (missed > 0);
+  fail_unless (late > 0);
+  fail_unless (late_data_mixed);
+
+  gst_pad_unlink (srcpad, latepad);
+  gst_object_unref (srcpad);
+  gst_element_release_request_pad (adder, latepad);
+  gst_object_unref (latepad);
+
+  g_main_loop_unref (main_loop);
+  gst_bus_remove_signal_watch (bus);
+  gst_object_unref (bus);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
 static Suite *
 adder_suite (void)
 {
@@ -1268,6 +1790,12 @@ adder_suite (void)
   tcase_add_test (tc_chain, test_duration_unknown_overrides);
   tcase_add_test (tc_chain, test_loop);
   tcase_add_test (tc_chain, test_flush_start_flush_stop);
+  tcase_add_test (tc_chain, test_mix_many);
+  tcase_add_test (tc_chain, test_float_accumulator);
+  tcase_add_test (tc_chain, test_skip_silence);
+  tcase_add_test (tc_chain, test_non_interleaved);
+  tcase_add_test (tc_chain, test_live_timeout);
+  tcase_add_test (tc_chain, test_live_timeout_late_data);
 
   /* Use a longer timeout */
 #ifdef HAVE_VALGRIND
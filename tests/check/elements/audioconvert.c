@@ -22,6 +22,7 @@
  */
 
 #include <unistd.h>
+#include <string.h>
 
 #include <gst/check/gstcheck.h>
 #include <gst/audio/audio.h>
@@ -155,6 +156,15 @@ get_float_caps (guint channels, gint endianness, guint width)
   return caps;
 }
 
+/* switches the caps to non-interleaved layout, returns @caps */
+static GstCaps *
+set_non_interleaved (GstCaps * caps)
+{
+  gst_caps_set_simple (caps, "layout", G_TYPE_STRING, "non-interleaved", NULL);
+
+  return caps;
+}
+
 /* Copied from vorbis; the particular values used don't matter */
 static GstAudioChannelPosition channelpositions[][6] = {
   {                             /* Mono */
@@ -556,6 +566,26 @@ GST_START_TEST (test_float32)
         in, get_float_caps (1, G_BYTE_ORDER, 32),
         out, get_float_caps (2, G_BYTE_ORDER, 32));
   }
+  /* endianness swap, with and without mixing */
+  {
+    gfloat in[] = { 0.015625, -0.03125 };
+    gfloat swapped[] = { 0.015625, -0.03125 };
+    gfloat out[] = { 0.015625, 0.015625, -0.03125, -0.03125 };
+    guint i;
+
+    for (i = 0; i < G_N_ELEMENTS (swapped); i++)
+      swapped[i] = GFLOAT_SWAP_LE_BE (swapped[i]);
+
+    RUN_CONVERSION ("float32 swap endianness",
+        in, get_float_caps (1, G_BYTE_ORDER, 32),
+        swapped, get_float_caps (1,
+            G_BYTE_ORDER == G_LITTLE_ENDIAN ? G_BIG_ENDIAN : G_LITTLE_ENDIAN,
+            32));
+    RUN_CONVERSION ("float32 swapped mono to stereo",
+        swapped, get_float_caps (1,
+            G_BYTE_ORDER == G_LITTLE_ENDIAN ? G_BIG_ENDIAN : G_LITTLE_ENDIAN,
+            32), out, get_float_caps (2, G_BYTE_ORDER, 32));
+  }
 }
 
 GST_END_TEST;
@@ -976,6 +1006,24 @@ GST_START_TEST (test_multichannel_conversion)
 
     RUN_CONVERSION ("5.1 to 2 channels", in, in_caps, out, out_caps);
   }
+  {
+    /* rear channels are mixed into the fronts at half the level and the
+     * result is normalized, the last frame is clipped */
+    gfloat in[] = { 0.75, -0.75, 0.0, 0.0, 0.0, 0.0, 0.75, -0.75,
+      1.0, 1.0, 1.0, 1.0
+    };
+    gfloat out[] = { 0.5, -0.5, 0.25, -0.25, 1.0, 1.0 };
+    GstAudioChannelPosition in_layout[4] = {
+      GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+      GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+      GST_AUDIO_CHANNEL_POSITION_REAR_LEFT,
+      GST_AUDIO_CHANNEL_POSITION_REAR_RIGHT
+    };
+    GstCaps *in_caps = get_float_mc_caps (4, G_BYTE_ORDER, 32, in_layout);
+    GstCaps *out_caps = get_float_caps (2, G_BYTE_ORDER, 32);
+
+    RUN_CONVERSION ("4 channels to 2", in, in_caps, out, out_caps);
+  }
   {
     gint16 in[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     gint16 out[] = { 0, 0 };
@@ -1504,6 +1552,179 @@ GST_START_TEST (test_preserve_width)
 
 GST_END_TEST;
 
+GST_START_TEST (test_non_interleaved)
+{
+  /* layout change only */
+  {
+    gint16 in[] = { 1, 2, 3, 10, 20, 30 };
+    gint16 out[] = { 1, 10, 2, 20, 3, 30 };
+
+    RUN_CONVERSION ("int16 non-interleaved to interleaved",
+        in, set_non_interleaved (get_int_caps (2, G_BYTE_ORDER, 16, 16, TRUE)),
+        out, get_int_caps (2, G_BYTE_ORDER, 16, 16, TRUE));
+    RUN_CONVERSION ("int16 interleaved to non-interleaved",
+        out, get_int_caps (2, G_BYTE_ORDER, 16, 16, TRUE),
+        in, set_non_interleaved (get_int_caps (2, G_BYTE_ORDER, 16, 16,
+                TRUE)));
+  }
+  /* sample conversion on the planes */
+  {
+    gint16 in[] = { 1, 2, -1, -2 };
+    gint32 out[] = { 65536, 131072, -65536, -131072 };
+
+    RUN_CONVERSION ("int16 to int32 non-interleaved",
+        in, set_non_interleaved (get_int_caps (2, G_BYTE_ORDER, 16, 16, TRUE)),
+        out, set_non_interleaved (get_int_caps (2, G_BYTE_ORDER, 32, 32,
+                TRUE)));
+  }
+  /* stereo to mono */
+  {
+    gint16 in[] = { 16384, 1024, -256, 1024 };
+    gint16 out[] = { 8064, 1024 };
+
+    RUN_CONVERSION ("int16 non-interleaved stereo to mono",
+        in, set_non_interleaved (get_int_caps (2, G_BYTE_ORDER, 16, 16, TRUE)),
+        out, get_int_caps (1, G_BYTE_ORDER, 16, 16, TRUE));
+  }
+  /* mono to stereo */
+  {
+    gfloat in[] = { 0.015625, 0.03125 };
+    gfloat out[] = { 0.015625, 0.03125, 0.015625, 0.03125 };
+
+    RUN_CONVERSION ("float32 mono to non-interleaved stereo",
+        in, get_float_caps (1, G_BYTE_ORDER, 32),
+        out, set_non_interleaved (get_float_caps (2, G_BYTE_ORDER, 32)));
+  }
+}
+
+GST_END_TEST;
+
+/* converts @n_samples samples of @channels channels of doubles to 16 bit
+ * integers with the given dithering and noise shaping */
+static GstBuffer *
+convert_quantized (gdouble * in, gint channels, gint n_samples, gint dithering,
+    gint noise_shaping)
+{
+  GstElement *audioconvert;
+  GstCaps *incaps, *outcaps;
+  GstBuffer *inbuffer, *outbuffer;
+
+  incaps = get_float_caps (channels, G_BYTE_ORDER, 64);
+  outcaps = get_int_caps (channels, G_BYTE_ORDER, 16, 16, TRUE);
+  audioconvert = setup_audioconvert (outcaps);
+  gst_caps_unref (outcaps);
+
+  g_object_set (G_OBJECT (audioconvert), "dithering", dithering,
+      "noise-shaping", noise_shaping, NULL);
+
+  fail_unless (gst_element_set_state (audioconvert,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+  gst_check_setup_events (mysrcpad, audioconvert, incaps, GST_FORMAT_TIME);
+  gst_caps_unref (incaps);
+
+  inbuffer = gst_buffer_new_and_alloc (channels * n_samples * sizeof (gdouble));
+  gst_buffer_fill (inbuffer, 0, in, channels * n_samples * sizeof (gdouble));
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+
+  fail_unless (g_list_length (buffers) == 1);
+  outbuffer = GST_BUFFER (buffers->data);
+  buffers = g_list_remove (buffers, outbuffer);
+
+  fail_unless (gst_element_set_state (audioconvert,
+          GST_STATE_NULL) == GST_STATE_CHANGE_SUCCESS, "could not set to null");
+  cleanup_audioconvert (audioconvert);
+
+  return outbuffer;
+}
+
+GST_START_TEST (test_dither_reproducible)
+{
+  gdouble in[1024];
+  GstBuffer *out1, *out2;
+  GstMapInfo map1, map2;
+  gint16 *samples;
+  gint i;
+
+  for (i = 0; i < G_N_ELEMENTS (in); i++)
+    in[i] = (i % 256) / 256.0 - 0.5;
+
+  /* the dither noise is generated from a fixed seed for every conversion,
+   * so converting the same input twice gives the same output */
+  out1 = convert_quantized (in, 1, G_N_ELEMENTS (in), 2, 4);
+  out2 = convert_quantized (in, 1, G_N_ELEMENTS (in), 2, 4);
+
+  gst_buffer_map (out1, &map1, GST_MAP_READ);
+  gst_buffer_map (out2, &map2, GST_MAP_READ);
+  fail_unless_equals_int (map1.size, G_N_ELEMENTS (in) * sizeof (gint16));
+  fail_unless_equals_int (map2.size, map1.size);
+  fail_unless (memcmp (map1.data, map2.data, map1.size) == 0);
+
+  /* dither and noise shaping only add a few LSB of noise */
+  samples = (gint16 *) map1.data;
+  for (i = 0; i < G_N_ELEMENTS (in); i++)
+    fail_unless (ABS (samples[i] - in[i] * 32767) < 64);
+
+  gst_buffer_unmap (out2, &map2);
+  gst_buffer_unmap (out1, &map1);
+  gst_buffer_unref (out2);
+  gst_buffer_unref (out1);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_noise_shaping_channels)
+{
+  gdouble left[512], right[512], in[2 * 512];
+  GstBuffer *out, *out_left, *out_right;
+  GstMapInfo map, map_left, map_right;
+  gint16 *samples, *samples_left, *samples_right;
+  gint ns, i;
+
+  /* two different signals, so mixing up the errors of the channels would
+   * change the result */
+  for (i = 0; i < G_N_ELEMENTS (left); i++) {
+    left[i] = (i % 64) / 64.0 - 0.5 + 1.0 / 3.0 / 32768.0;
+    right[i] = 0.25 - (i % 100) / 200.0 + 2.0 / 3.0 / 32768.0;
+    in[2 * i] = left[i];
+    in[2 * i + 1] = right[i];
+  }
+
+  /* without dithering every channel of a stereo stream must come out as if
+   * it was converted on its own, for all noise shaping methods */
+  for (ns = 1; ns <= 4; ns++) {
+    out = convert_quantized (in, 2, G_N_ELEMENTS (left), 0, ns);
+    out_left = convert_quantized (left, 1, G_N_ELEMENTS (left), 0, ns);
+    out_right = convert_quantized (right, 1, G_N_ELEMENTS (right), 0, ns);
+
+    gst_buffer_map (out, &map, GST_MAP_READ);
+    gst_buffer_map (out_left, &map_left, GST_MAP_READ);
+    gst_buffer_map (out_right, &map_right, GST_MAP_READ);
+    fail_unless_equals_int (map.size, 2 * G_N_ELEMENTS (left) *
+        sizeof (gint16));
+    fail_unless_equals_int (map_left.size, G_N_ELEMENTS (left) *
+        sizeof (gint16));
+    fail_unless_equals_int (map_right.size, map_left.size);
+
+    samples = (gint16 *) map.data;
+    samples_left = (gint16 *) map_left.data;
+    samples_right = (gint16 *) map_right.data;
+    for (i = 0; i < G_N_ELEMENTS (left); i++) {
+      fail_unless_equals_int (samples[2 * i], samples_left[i]);
+      fail_unless_equals_int (samples[2 * i + 1], samples_right[i]);
+    }
+
+    gst_buffer_unmap (out_right, &map_right);
+    gst_buffer_unmap (out_left, &map_left);
+    gst_buffer_unmap (out, &map);
+    gst_buffer_unref (out_right);
+    gst_buffer_unref (out_left);
+    gst_buffer_unref (out);
+  }
+}
+
+GST_END_TEST;
+
 static Suite *
 audioconvert_suite (void)
 {
@@ -1519,6 +1740,9 @@ audioconvert_suite (void)
   tcase_add_test (tc_chain, test_caps_negotiation);
   tcase_add_test (tc_chain, test_convert_undefined_multichannel);
   tcase_add_test (tc_chain, test_preserve_width);
+  tcase_add_test (tc_chain, test_non_interleaved);
+  tcase_add_test (tc_chain, test_dither_reproducible);
+  tcase_add_test (tc_chain, test_noise_shaping_channels);
 
   return s;
 }
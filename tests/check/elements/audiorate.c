@@ -452,6 +452,92 @@ GST_START_TEST (test_large_discont)
 
 GST_END_TEST;
 
+/* gaps are filled with GAP buffers of at most a second that share one
+ * read-only memory with silence */
+GST_START_TEST (test_gap_fill)
+{
+  GstElement *audiorate;
+  GstCaps *caps;
+  GstPad *srcpad, *sinkpad;
+  GstBuffer *buf;
+  GstMemory *silence = NULL;
+  GstClockTime next_ts;
+  GList *l;
+  guint n_gap = 0;
+
+  audiorate = gst_check_setup_element ("audiorate");
+  caps = gst_caps_new_simple ("audio/x-raw",
+      "format", G_TYPE_STRING, GST_AUDIO_NE (F32),
+      "layout", G_TYPE_STRING, "interleaved",
+      "channels", G_TYPE_INT, 1, "rate", G_TYPE_INT, 44100, NULL);
+
+  srcpad = gst_check_setup_src_pad (audiorate, &srctemplate);
+  sinkpad = gst_check_setup_sink_pad (audiorate, &sinktemplate);
+
+  gst_pad_set_active (srcpad, TRUE);
+
+  gst_check_setup_events (srcpad, audiorate, caps, GST_FORMAT_TIME);
+
+  gst_pad_set_active (sinkpad, TRUE);
+
+  fail_unless (gst_element_set_state (audiorate,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "failed to set audiorate playing");
+
+  buf = gst_buffer_new_and_alloc (4);
+  gst_buffer_memset (buf, 0, 0xff, 4);
+  GST_BUFFER_TIMESTAMP (buf) = 0;
+  gst_pad_push (srcpad, buf);
+
+  buf = gst_buffer_new_and_alloc (4);
+  gst_buffer_memset (buf, 0, 0xff, 4);
+  GST_BUFFER_TIMESTAMP (buf) = 5 * GST_SECOND / 2;
+  gst_pad_push (srcpad, buf);
+  /* the buffers plus fill buffers of 1, 1 and 0.5 seconds */
+  fail_unless_equals_int (g_list_length (buffers), 5);
+
+  /* a GAP event is filled too */
+  next_ts = 5 * GST_SECOND / 2 + gst_util_uint64_scale_int (1, GST_SECOND,
+      44100);
+  fail_unless (gst_pad_push_event (srcpad, gst_event_new_gap (next_ts,
+              GST_SECOND)));
+  fail_unless_equals_int (g_list_length (buffers), 6);
+
+  for (l = buffers; l; l = l->next) {
+    GstMapInfo map;
+    GstMemory *mem;
+
+    buf = l->data;
+    if (!GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_GAP))
+      continue;
+
+    n_gap++;
+    fail_unless (gst_buffer_get_size (buf) <= 44100 * 4);
+    fail_unless_equals_int (gst_buffer_n_memory (buf), 1);
+    mem = gst_buffer_peek_memory (buf, 0);
+    fail_if (mem->parent == NULL);
+    if (silence == NULL)
+      silence = mem->parent;
+    fail_unless (mem->parent == silence);
+
+    gst_buffer_map (buf, &map, GST_MAP_READ);
+    fail_unless (((gfloat *) map.data)[0] == 0.0);
+    fail_unless (((gfloat *) map.data)[map.size / 4 - 1] == 0.0);
+    gst_buffer_unmap (buf, &map);
+  }
+  fail_unless_equals_int (n_gap, 4);
+
+  gst_element_set_state (audiorate, GST_STATE_NULL);
+  gst_caps_unref (caps);
+
+  gst_check_teardown_sink_pad (audiorate);
+  gst_check_teardown_src_pad (audiorate);
+
+  gst_object_unref (audiorate);
+}
+
+GST_END_TEST;
+
 static Suite *
 audiorate_suite (void)
 {
@@ -468,6 +554,7 @@ audiorate_suite (void)
   tcase_add_test (tc_chain, test_perfect_stream_inject90);
   tcase_add_test (tc_chain, test_perfect_stream_drop45_inject25);
   tcase_add_test (tc_chain, test_large_discont);
+  tcase_add_test (tc_chain, test_gap_fill);
 
   return s;
 }
@@ -0,0 +1,154 @@
+/* GStreamer
+ *
+ * unit tests for the sinc table cache of the audioresample resampler
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/check/gstcheck.h>
+
+/* build the float resampler into the test to get at the cache */
+#define FLOATING_POINT
+#define OUTSIDE_SPEEX
+#define RANDOM_PREFIX resample_cache_test
+
+#include "resample.c"
+
+static SpeexResamplerState *
+new_resampler (spx_uint32_t channels, spx_uint32_t in_rate,
+    spx_uint32_t out_rate, int quality, SpeexResamplerSincFilterMode mode)
+{
+  SpeexResamplerState *st;
+  int err = RESAMPLER_ERR_SUCCESS;
+
+  st = speex_resampler_init (channels, in_rate, out_rate, quality, mode,
+      RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT, &err);
+  fail_unless (st != NULL);
+  fail_unless_equals_int (err, RESAMPLER_ERR_SUCCESS);
+  fail_unless (st->sinc_entry != NULL);
+  fail_unless (st->sinc_table == st->sinc_entry->table);
+
+  return st;
+}
+
+static gboolean
+is_cached (SincTableEntry * entry)
+{
+  gboolean cached;
+
+  G_LOCK (sinc_table_cache);
+  cached = g_slist_find (sinc_table_cache, entry) != NULL;
+  G_UNLOCK (sinc_table_cache);
+
+  return cached;
+}
+
+static void
+check_sharing (SpeexResamplerSincFilterMode mode)
+{
+  SpeexResamplerState *st1, *st2, *st3;
+  SincTableEntry *entry;
+
+  /* the number of channels is not part of the table */
+  st1 = new_resampler (2, 48000, 44100, 4, mode);
+  st2 = new_resampler (1, 48000, 44100, 4, mode);
+  entry = st1->sinc_entry;
+
+  fail_unless (st2->sinc_entry == entry);
+  fail_unless (st2->sinc_table == st1->sinc_table);
+  fail_unless_equals_int (entry->ref_count, 2);
+  fail_unless (is_cached (entry));
+
+  /* another quality needs another table */
+  st3 = new_resampler (2, 48000, 44100, 8, mode);
+  fail_unless (st3->sinc_entry != entry);
+  fail_unless (st3->sinc_table != st1->sinc_table);
+  fail_unless_equals_int (entry->ref_count, 2);
+
+  /* the table stays until the last resampler using it is freed */
+  speex_resampler_destroy (st1);
+  fail_unless (is_cached (entry));
+  fail_unless_equals_int (entry->ref_count, 1);
+
+  speex_resampler_destroy (st2);
+  fail_unless (!is_cached (entry));
+
+  entry = st3->sinc_entry;
+  speex_resampler_destroy (st3);
+  fail_unless (!is_cached (entry));
+}
+
+GST_START_TEST (test_shared_table)
+{
+  check_sharing (RESAMPLER_SINC_FILTER_FULL);
+  check_sharing (RESAMPLER_SINC_FILTER_INTERPOLATED);
+}
+
+GST_END_TEST;
+
+/* a resampler that changes its ratio releases the table of the old one */
+GST_START_TEST (test_release_on_update)
+{
+  SpeexResamplerState *st1, *st2;
+  SincTableEntry *entry;
+
+  st1 = new_resampler (1, 48000, 44100, 4, RESAMPLER_SINC_FILTER_FULL);
+  st2 = new_resampler (1, 48000, 44100, 4, RESAMPLER_SINC_FILTER_FULL);
+  entry = st1->sinc_entry;
+  fail_unless (st2->sinc_entry == entry);
+
+  /* setting the same rate keeps the table */
+  fail_unless_equals_int (speex_resampler_set_rate (st1, 48000, 44100),
+      RESAMPLER_ERR_SUCCESS);
+  fail_unless (st1->sinc_entry == entry);
+  fail_unless_equals_int (entry->ref_count, 2);
+
+  fail_unless_equals_int (speex_resampler_set_rate (st1, 48000, 32000),
+      RESAMPLER_ERR_SUCCESS);
+  fail_unless (st1->sinc_entry != entry);
+  fail_unless_equals_int (entry->ref_count, 1);
+
+  fail_unless_equals_int (speex_resampler_set_rate (st2, 48000, 32000),
+      RESAMPLER_ERR_SUCCESS);
+  fail_unless (!is_cached (entry));
+  fail_unless (st2->sinc_entry == st1->sinc_entry);
+
+  entry = st1->sinc_entry;
+  speex_resampler_destroy (st1);
+  speex_resampler_destroy (st2);
+  fail_unless (!is_cached (entry));
+}
+
+GST_END_TEST;
+
+static Suite *
+audioresample_cache_suite (void)
+{
+  Suite *s = suite_create ("audioresample-cache");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_shared_table);
+  tcase_add_test (tc_chain, test_release_on_update);
+
+  return s;
+}
+
+GST_CHECK_MAIN (audioresample_cache);
@@ -22,10 +22,15 @@
  */
 
 #include <unistd.h>
+#include <string.h>
+#include <math.h>
 
 #include <gst/check/gstcheck.h>
 
 #include <gst/audio/audio.h>
+#include <gst/base/gstbasetransform.h>
+#include <gst/controller/gstinterpolationcontrolsource.h>
+#include <gst/controller/gstdirectcontrolbinding.h>
 
 #include <gst/fft/gstfft.h>
 #include <gst/fft/gstffts16.h>
@@ -49,11 +54,11 @@ static GstPad *mysrcpad, *mysinkpad;
     "format = (string) "FORMATS", "     \
     "channels = (int) [ 1, MAX ], "     \
     "rate = (int) [ 1,  MAX ], "        \
-    "layout = (string) interleaved"
+    "layout = (string) { interleaved, non-interleaved }"
 
 static GstElement *
-setup_audioresample (int channels, guint64 mask, int inrate, int outrate,
-    const gchar * format)
+setup_audioresample_full (int channels, guint64 mask, int inrate, int outrate,
+    const gchar * format, const gchar * layout)
 {
   GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
       GST_PAD_SINK,
@@ -77,6 +82,7 @@ setup_audioresample (int channels, guint64 mask, int inrate, int outrate,
   structure = gst_caps_get_structure (caps, 0);
   gst_structure_set (structure, "channels", G_TYPE_INT, channels,
       "rate", G_TYPE_INT, inrate, "format", G_TYPE_STRING, format,
+      "layout", G_TYPE_STRING, layout,
       "channel-mask", GST_TYPE_BITMASK, mask, NULL);
   fail_unless (gst_caps_is_fixed (caps));
 
@@ -92,7 +98,8 @@ setup_audioresample (int channels, guint64 mask, int inrate, int outrate,
   caps = gst_caps_from_string (RESAMPLE_CAPS);
   structure = gst_caps_get_structure (caps, 0);
   gst_structure_set (structure, "channels", G_TYPE_INT, channels,
-      "rate", G_TYPE_INT, outrate, "format", G_TYPE_STRING, format, NULL);
+      "rate", G_TYPE_INT, outrate, "format", G_TYPE_STRING, format,
+      "layout", G_TYPE_STRING, layout, NULL);
   fail_unless (gst_caps_is_fixed (caps));
   caps_str = gst_caps_to_string (caps);
   sinktemplate.static_caps.string = caps_str;
@@ -109,6 +116,14 @@ setup_audioresample (int channels, guint64 mask, int inrate, int outrate,
   return audioresample;
 }
 
+static GstElement *
+setup_audioresample (int channels, guint64 mask, int inrate, int outrate,
+    const gchar * format)
+{
+  return setup_audioresample_full (channels, mask, inrate, outrate, format,
+      "interleaved");
+}
+
 static void
 cleanup_audioresample (GstElement * audioresample)
 {
@@ -401,6 +416,385 @@ GST_START_TEST (test_reuse)
 
 GST_END_TEST;
 
+static guint
+push_rate_adjust_buffers (gint rate, gint samples, gint numbuffers,
+    guint64 * offset)
+{
+  GstBuffer *inbuffer, *outbuffer;
+  guint out_samples = 0;
+  int j;
+
+  for (j = 0; j < numbuffers; j++) {
+    inbuffer = gst_buffer_new_and_alloc (samples * sizeof (gfloat));
+    gst_buffer_memset (inbuffer, 0, 0, samples * sizeof (gfloat));
+    GST_BUFFER_DURATION (inbuffer) = GST_FRAMES_TO_CLOCK_TIME (samples, rate);
+    GST_BUFFER_TIMESTAMP (inbuffer) =
+        GST_FRAMES_TO_CLOCK_TIME (*offset, rate);
+    GST_BUFFER_OFFSET (inbuffer) = *offset;
+    *offset += samples;
+    GST_BUFFER_OFFSET_END (inbuffer) = *offset;
+
+    fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  }
+
+  while (buffers) {
+    outbuffer = GST_BUFFER (buffers->data);
+    out_samples += gst_buffer_get_size (outbuffer) / sizeof (gfloat);
+    buffers = g_list_delete_link (buffers, buffers);
+    gst_buffer_unref (outbuffer);
+  }
+
+  return out_samples;
+}
+
+/* this tests that changing the rate adjustment takes effect on a running
+ * stream, also with equal input and output rates */
+GST_START_TEST (test_rate_adjust)
+{
+  GstElement *audioresample;
+  guint64 offset = 0;
+  guint out_samples;
+
+  audioresample = setup_audioresample (1, 0, 48000, 48000, GST_AUDIO_NE (F32));
+  g_object_set (audioresample, "rate-adjust", 1.25, NULL);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  /* 1 second of input results in 0.8 seconds of output, minus the filter
+   * latency in the first buffer */
+  out_samples = push_rate_adjust_buffers (48000, 4800, 10, &offset);
+  GST_DEBUG ("%u output samples with adjustment 1.25", out_samples);
+  fail_unless (out_samples > 38400 - 64 && out_samples <= 38400 + 1);
+
+  /* no filter reset, so the output continues without latency */
+  g_object_set (audioresample, "rate-adjust", 0.8, NULL);
+  out_samples = push_rate_adjust_buffers (48000, 4800, 10, &offset);
+  GST_DEBUG ("%u output samples with adjustment 0.8", out_samples);
+  fail_unless (out_samples >= 60000 - 2 && out_samples <= 60000 + 2);
+
+  /* back to the exact ratio, which for equal rates is passthrough again */
+  g_object_set (audioresample, "rate-adjust", 1.0, NULL);
+  out_samples = push_rate_adjust_buffers (48000, 4800, 10, &offset);
+  GST_DEBUG ("%u output samples without adjustment", out_samples);
+  fail_unless_equals_int (out_samples, 48000);
+  fail_unless (gst_base_transform_is_passthrough (GST_BASE_TRANSFORM
+          (audioresample)));
+
+  cleanup_audioresample (audioresample);
+}
+
+GST_END_TEST;
+
+/* this tests that going back to no adjustment restores the exact ratio */
+GST_START_TEST (test_rate_adjust_reset)
+{
+  GstElement *audioresample;
+  guint64 offset = 0;
+  guint out_samples;
+
+  audioresample = setup_audioresample (1, 0, 48000, 44100, GST_AUDIO_NE (F32));
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_object_set (audioresample, "rate-adjust", 1.1, NULL);
+  push_rate_adjust_buffers (48000, 4800, 10, &offset);
+
+  /* every output buffer must have been allocated large enough for the
+   * output of the exact ratio */
+  g_object_set (audioresample, "rate-adjust", 1.0, NULL);
+  out_samples = push_rate_adjust_buffers (48000, 4800, 10, &offset);
+  GST_DEBUG ("%u output samples without adjustment", out_samples);
+  fail_unless (out_samples >= 44100 - 1 && out_samples <= 44100 + 1);
+  fail_if (gst_base_transform_is_passthrough (GST_BASE_TRANSFORM
+          (audioresample)));
+
+  cleanup_audioresample (audioresample);
+}
+
+GST_END_TEST;
+
+/* this tests that a control binding on rate-adjust is synced per buffer */
+GST_START_TEST (test_rate_adjust_controller)
+{
+  GstControlSource *cs;
+  GstTimedValueControlSource *tvcs;
+  GstElement *audioresample;
+  guint64 offset = 0;
+  guint out_samples;
+
+  audioresample = setup_audioresample (1, 0, 48000, 48000, GST_AUDIO_NE (F32));
+
+  cs = gst_interpolation_control_source_new ();
+  g_object_set (cs, "mode", GST_INTERPOLATION_MODE_NONE, NULL);
+  gst_object_add_control_binding (GST_OBJECT_CAST (audioresample),
+      gst_direct_control_binding_new (GST_OBJECT_CAST (audioresample),
+          "rate-adjust", cs));
+
+  /* control values are normalized to the 0.5 ... 2.0 range of the property,
+   * so this is 1.25 for the first and 0.8 for the second half second */
+  tvcs = (GstTimedValueControlSource *) cs;
+  gst_timed_value_control_source_set (tvcs, 0 * GST_SECOND,
+      (1.25 - 0.5) / 1.5);
+  gst_timed_value_control_source_set (tvcs, GST_SECOND / 2, (0.8 - 0.5) / 1.5);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  /* 0.4 seconds plus 0.625 seconds of output, minus the filter latency */
+  out_samples = push_rate_adjust_buffers (48000, 4800, 10, &offset);
+  GST_DEBUG ("%u output samples with controlled adjustment", out_samples);
+  fail_unless (out_samples > 49200 - 64 && out_samples <= 49200 + 2);
+
+  gst_object_unref (cs);
+  cleanup_audioresample (audioresample);
+}
+
+GST_END_TEST;
+
+#define NI_CHANNELS 3
+#define NI_SAMPLES 4800
+
+/* resamples a different sine on every channel in the given layout and
+ * returns the output deinterleaved, one plane per channel */
+static gdouble *
+run_layout_test (const gchar * format, const gchar * layout, guint * n_out)
+{
+  GstElement *audioresample;
+  GstBuffer *inbuffer, *outbuffer;
+  GstAudioInfo info;
+  GstCaps *caps;
+  GstMapInfo map;
+  gdouble *out, *result;
+  guint out_samples = 0, c, i, bps;
+  gboolean planar = !strcmp (layout, "non-interleaved");
+
+  audioresample = setup_audioresample_full (NI_CHANNELS, 0, 48000, 44100,
+      format, layout);
+  caps = gst_pad_get_current_caps (mysrcpad);
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  gst_caps_unref (caps);
+  bps = GST_AUDIO_INFO_WIDTH (&info) / 8;
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (NI_SAMPLES * NI_CHANNELS * bps);
+  GST_BUFFER_DURATION (inbuffer) = GST_FRAMES_TO_CLOCK_TIME (NI_SAMPLES, 48000);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  GST_BUFFER_OFFSET (inbuffer) = 0;
+  GST_BUFFER_OFFSET_END (inbuffer) = NI_SAMPLES;
+
+  gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+  for (c = 0; c < NI_CHANNELS; c++) {
+    for (i = 0; i < NI_SAMPLES; i++) {
+      gdouble v = 0.5 * sin (2.0 * G_PI * 500.0 * (c + 1) * i / 48000.0);
+      guint idx = planar ? c * NI_SAMPLES + i : i * NI_CHANNELS + c;
+
+      if (GST_AUDIO_INFO_IS_FLOAT (&info))
+        ((gfloat *) map.data)[idx] = v;
+      else
+        ((gint16 *) map.data)[idx] = v * G_MAXINT16;
+    }
+  }
+  gst_buffer_unmap (inbuffer, &map);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+
+  outbuffer = GST_BUFFER (buffers->data);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  out_samples = map.size / (NI_CHANNELS * bps);
+  out = result = g_new (gdouble, out_samples * NI_CHANNELS);
+  for (c = 0; c < NI_CHANNELS; c++) {
+    for (i = 0; i < out_samples; i++) {
+      guint idx = planar ? c * out_samples + i : i * NI_CHANNELS + c;
+
+      if (GST_AUDIO_INFO_IS_FLOAT (&info))
+        *out++ = ((gfloat *) map.data)[idx];
+      else
+        *out++ = ((gint16 *) map.data)[idx];
+    }
+  }
+  gst_buffer_unmap (outbuffer, &map);
+
+  cleanup_audioresample (audioresample);
+
+  *n_out = out_samples;
+  return result;
+}
+
+static void
+test_non_interleaved_instance (const gchar * format, gdouble tolerance)
+{
+  gdouble *interleaved, *non_interleaved;
+  guint n_interleaved, n_non_interleaved, i;
+
+  interleaved = run_layout_test (format, "interleaved", &n_interleaved);
+  non_interleaved =
+      run_layout_test (format, "non-interleaved", &n_non_interleaved);
+
+  fail_unless_equals_int (n_interleaved, n_non_interleaved);
+  fail_unless (n_interleaved > 0);
+
+  for (i = 0; i < n_interleaved * NI_CHANNELS; i++) {
+    fail_unless (fabs (interleaved[i] - non_interleaved[i]) <= tolerance,
+        "%s sample %u of channel %u differs: %f != %f", format,
+        i % n_interleaved, i / n_interleaved, interleaved[i],
+        non_interleaved[i]);
+  }
+
+  g_free (interleaved);
+  g_free (non_interleaved);
+}
+
+/* this tests that every plane of non-interleaved audio is resampled like
+ * the corresponding channel of interleaved audio */
+GST_START_TEST (test_non_interleaved)
+{
+  test_non_interleaved_instance (GST_AUDIO_NE (F32), 1e-6);
+  test_non_interleaved_instance (GST_AUDIO_NE (S16), 1.0);
+}
+
+GST_END_TEST;
+
+#define MC_SAMPLES 4800
+
+/* resamples @channels channels with the full sinc table, channel c carries
+ * the sine number @first + c. Returns the output deinterleaved, one plane
+ * per channel */
+static gdouble *
+run_channels_test (const gchar * format, guint channels, guint first,
+    guint * n_out)
+{
+  GstElement *audioresample;
+  GstBuffer *inbuffer, *outbuffer;
+  GstAudioInfo info;
+  GstCaps *caps;
+  GstMapInfo map;
+  gdouble *result;
+  guint out_samples, c, i, bps;
+  GstAudioFormat fmt;
+
+  audioresample = setup_audioresample (channels, 0, 48000, 44100, format);
+  gst_util_set_object_arg (G_OBJECT (audioresample), "sinc-filter-mode",
+      "full");
+  caps = gst_pad_get_current_caps (mysrcpad);
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  gst_caps_unref (caps);
+  bps = GST_AUDIO_INFO_WIDTH (&info) / 8;
+  fmt = GST_AUDIO_INFO_FORMAT (&info);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (MC_SAMPLES * channels * bps);
+  GST_BUFFER_DURATION (inbuffer) = GST_FRAMES_TO_CLOCK_TIME (MC_SAMPLES, 48000);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  GST_BUFFER_OFFSET (inbuffer) = 0;
+  GST_BUFFER_OFFSET_END (inbuffer) = MC_SAMPLES;
+
+  gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+  for (i = 0; i < MC_SAMPLES; i++) {
+    for (c = 0; c < channels; c++) {
+      gdouble v = 0.5 * sin (2.0 * G_PI * 500.0 * (first + c + 1) * i /
+          48000.0);
+      guint idx = i * channels + c;
+
+      if (fmt == GST_AUDIO_FORMAT_F32)
+        ((gfloat *) map.data)[idx] = v;
+      else if (fmt == GST_AUDIO_FORMAT_F64)
+        ((gdouble *) map.data)[idx] = v;
+      else if (fmt == GST_AUDIO_FORMAT_S32)
+        ((gint32 *) map.data)[idx] = v * G_MAXINT32;
+      else
+        ((gint16 *) map.data)[idx] = v * G_MAXINT16;
+    }
+  }
+  gst_buffer_unmap (inbuffer, &map);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+
+  outbuffer = GST_BUFFER (buffers->data);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  out_samples = map.size / (channels * bps);
+  result = g_new (gdouble, out_samples * channels);
+  for (c = 0; c < channels; c++) {
+    for (i = 0; i < out_samples; i++) {
+      guint idx = i * channels + c;
+      gdouble v;
+
+      if (fmt == GST_AUDIO_FORMAT_F32)
+        v = ((gfloat *) map.data)[idx];
+      else if (fmt == GST_AUDIO_FORMAT_F64)
+        v = ((gdouble *) map.data)[idx];
+      else if (fmt == GST_AUDIO_FORMAT_S32)
+        v = ((gint32 *) map.data)[idx];
+      else
+        v = ((gint16 *) map.data)[idx];
+      result[c * out_samples + i] = v;
+    }
+  }
+  gst_buffer_unmap (outbuffer, &map);
+
+  cleanup_audioresample (audioresample);
+
+  *n_out = out_samples;
+  return result;
+}
+
+static void
+test_multichannel_instance (const gchar * format, guint channels,
+    gdouble tolerance)
+{
+  gdouble *multi, *single;
+  guint n_multi, n_single, c, i;
+
+  multi = run_channels_test (format, channels, 0, &n_multi);
+  fail_unless (n_multi > 0);
+
+  for (c = 0; c < channels; c++) {
+    single = run_channels_test (format, 1, c, &n_single);
+    fail_unless_equals_int (n_multi, n_single);
+
+    for (i = 0; i < n_single; i++) {
+      fail_unless (fabs (multi[c * n_multi + i] - single[i]) <= tolerance,
+          "%s sample %u of channel %u/%u differs: %f != %f", format, i, c,
+          channels, multi[c * n_multi + i], single[i]);
+    }
+    g_free (single);
+  }
+
+  g_free (multi);
+}
+
+/* this tests that resampling all channels of interleaved audio together
+ * gives the same result as resampling every channel on its own. The channel
+ * counts cover the 4 channel blocks of the kernels and their remainders.
+ * Float results may differ in the rounding of the sums, integer results by
+ * one LSB */
+GST_START_TEST (test_multichannel)
+{
+  static const guint channels[] = { 2, 3, 4, 5, 8, 9 };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (channels); i++) {
+    test_multichannel_instance (GST_AUDIO_NE (F32), channels[i], 1e-5);
+    test_multichannel_instance (GST_AUDIO_NE (F64), channels[i], 1e-12);
+    test_multichannel_instance (GST_AUDIO_NE (S16), channels[i], 1.0);
+    test_multichannel_instance (GST_AUDIO_NE (S32), channels[i], 1.0);
+  }
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_shutdown)
 {
   GstElement *pipeline, *src, *cf1, *ar, *cf2, *sink;
@@ -671,6 +1065,177 @@ GST_START_TEST (test_pipelines)
 
 GST_END_TEST;
 
+static GstClockTime
+get_pipeline_latency (const gchar * filter_phase)
+{
+  GstElement *pipeline;
+  GstQuery *query;
+  GError *error = NULL;
+  gchar *pipe_str;
+  GstClockTime min, max;
+  gboolean live;
+
+  pipe_str =
+      g_strdup_printf
+      ("audiotestsrc is-live=true ! audio/x-raw,format=%s,rate=44100,channels=1 ! audioresample quality=4 filter-phase=%s ! audio/x-raw,rate=48000 ! fakesink",
+      GST_AUDIO_NE (S16), filter_phase);
+
+  pipeline = gst_parse_launch (pipe_str, &error);
+  fail_unless (pipeline != NULL, "Error parsing pipeline: %s",
+      error ? error->message : "(invalid error)");
+  g_free (pipe_str);
+
+  fail_unless (gst_element_set_state (pipeline,
+          GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+  fail_unless (gst_element_get_state (pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE) != GST_STATE_CHANGE_FAILURE);
+
+  query = gst_query_new_latency ();
+  fail_unless (gst_element_query (pipeline, query));
+  gst_query_parse_latency (query, &live, &min, &max);
+  fail_unless (live);
+  gst_query_unref (query);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+
+  return min;
+}
+
+GST_START_TEST (test_minimum_phase_latency)
+{
+  GstClockTime linear, minimum;
+
+  linear = get_pipeline_latency ("linear");
+  minimum = get_pipeline_latency ("minimum");
+
+  GST_DEBUG ("linear-phase latency %" GST_TIME_FORMAT ", minimum-phase %"
+      GST_TIME_FORMAT, GST_TIME_ARGS (linear), GST_TIME_ARGS (minimum));
+
+  /* half of the 64 taps for linear-phase, a few samples for minimum-phase */
+  fail_unless (minimum < linear);
+  fail_unless (linear - minimum >= gst_util_uint64_scale (24, GST_SECOND,
+          44100));
+}
+
+GST_END_TEST;
+
+#define GAP_SAMPLES 4410
+
+/* pushes 0.1 s of a sine, 0.1 s of either silence or a GAP buffer, and the
+ * sine again, collects the output in out and returns the number of samples */
+static guint
+run_gap_stream (const gchar * phase, gboolean gap, gfloat * out,
+    guint * out_before_second, guint * out_before_third)
+{
+  GstElement *audioresample;
+  GstBuffer *inbuffer, *outbuffer;
+  GstMapInfo map;
+  guint64 offset = 0;
+  guint out_samples = 0;
+  gfloat *p;
+  gint i, j;
+
+  audioresample = setup_audioresample (1, 0, 44100, 48000, GST_AUDIO_NE (F32));
+  gst_util_set_object_arg (G_OBJECT (audioresample), "filter-phase", phase);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  for (j = 0; j < 3; j++) {
+    inbuffer = gst_buffer_new_and_alloc (GAP_SAMPLES * sizeof (gfloat));
+    GST_BUFFER_DURATION (inbuffer) =
+        GST_FRAMES_TO_CLOCK_TIME (GAP_SAMPLES, 44100);
+    GST_BUFFER_TIMESTAMP (inbuffer) = GST_FRAMES_TO_CLOCK_TIME (offset, 44100);
+    GST_BUFFER_OFFSET (inbuffer) = offset;
+    offset += GAP_SAMPLES;
+    GST_BUFFER_OFFSET_END (inbuffer) = offset;
+
+    gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+    p = (gfloat *) map.data;
+    for (i = 0; i < GAP_SAMPLES; i++)
+      p[i] = (j == 1) ? 0.0 : sin (2.0 * G_PI * 1000.0 * i / 44100.0);
+    gst_buffer_unmap (inbuffer, &map);
+
+    if (j == 1 && gap)
+      GST_BUFFER_FLAG_SET (inbuffer, GST_BUFFER_FLAG_GAP);
+
+    if (j == 1)
+      *out_before_second = out_samples;
+    else if (j == 2)
+      *out_before_third = out_samples;
+
+    fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+
+    while (buffers) {
+      outbuffer = GST_BUFFER (buffers->data);
+      gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+      memcpy (out + out_samples, map.data, map.size);
+      out_samples += map.size / sizeof (gfloat);
+      gst_buffer_unmap (outbuffer, &map);
+      buffers = g_list_delete_link (buffers, buffers);
+      gst_buffer_unref (outbuffer);
+    }
+  }
+
+  cleanup_audioresample (audioresample);
+
+  return out_samples;
+}
+
+static void
+test_gap_instance (const gchar * phase)
+{
+  gfloat *out_silence, *out_gap;
+  guint n_silence, n_gap, before_silence, before_gap;
+  guint start_silence, start_gap;
+  gfloat diff = 0.0;
+  guint i;
+
+  out_silence = g_new0 (gfloat, 4 * GAP_SAMPLES);
+  out_gap = g_new0 (gfloat, 4 * GAP_SAMPLES);
+
+  n_silence = run_gap_stream (phase, FALSE, out_silence, &start_silence,
+      &before_silence);
+  n_gap = run_gap_stream (phase, TRUE, out_gap, &start_gap, &before_gap);
+
+  GST_DEBUG ("%s-phase: %u/%u/%u samples with silence, %u/%u/%u with GAP",
+      phase, start_silence, before_silence, n_silence, start_gap, before_gap,
+      n_gap);
+
+  /* a GAP buffer results in the same amount of output as the silence */
+  fail_unless_equals_int (start_gap, start_silence);
+  fail_unless (before_gap + 1 >= before_silence
+      && before_gap <= before_silence + 1);
+  fail_unless (n_gap + 1 >= n_silence && n_gap <= n_silence + 1);
+
+  /* the tail of the signal before the GAP is not cut off */
+  for (i = start_silence; i < MIN (before_silence, before_gap); i++)
+    diff = MAX (diff, fabs (out_silence[i] - out_gap[i]));
+  GST_DEBUG ("%s-phase: maximum difference in the gap %f", phase, diff);
+  fail_unless (diff < 1e-4);
+
+  /* and the signal after the GAP comes out as after the silence */
+  diff = 0.0;
+  for (i = 0; i < MIN (n_silence - before_silence, n_gap - before_gap); i++)
+    diff = MAX (diff, fabs (out_silence[before_silence + i] -
+            out_gap[before_gap + i]));
+  GST_DEBUG ("%s-phase: maximum difference after the gap %f", phase, diff);
+  fail_unless (diff < 1e-4);
+
+  g_free (out_silence);
+  g_free (out_gap);
+}
+
+GST_START_TEST (test_gap)
+{
+  test_gap_instance ("linear");
+  test_gap_instance ("minimum");
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_preference_passthrough)
 {
   GstStateChangeReturn ret;
@@ -1100,6 +1665,11 @@ audioresample_suite (void)
   tcase_add_test (tc_chain, test_perfect_stream);
   tcase_add_test (tc_chain, test_discont_stream);
   tcase_add_test (tc_chain, test_reuse);
+  tcase_add_test (tc_chain, test_rate_adjust);
+  tcase_add_test (tc_chain, test_rate_adjust_reset);
+  tcase_add_test (tc_chain, test_rate_adjust_controller);
+  tcase_add_test (tc_chain, test_non_interleaved);
+  tcase_add_test (tc_chain, test_multichannel);
   tcase_add_test (tc_chain, test_shutdown);
   tcase_add_test (tc_chain, test_live_switch);
   tcase_add_test (tc_chain, test_timestamp_drift);
@@ -1109,6 +1679,8 @@ audioresample_suite (void)
   tcase_set_timeout (tc_chain, 360);
   tcase_add_test (tc_chain, test_pipelines);
   tcase_add_test (tc_chain, test_preference_passthrough);
+  tcase_add_test (tc_chain, test_minimum_phase_latency);
+  tcase_add_test (tc_chain, test_gap);
 #endif
 
   return s;
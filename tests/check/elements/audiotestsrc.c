@@ -112,6 +112,203 @@ GST_START_TEST (test_all_waves)
 
 GST_END_TEST;
 
+/* largest difference between two consecutive samples of the mono S16 buffers
+ * that arrived on the sink pad */
+static gint
+get_max_jump (void)
+{
+  GList *l;
+  gint prev = 0, max_jump = 0;
+  gboolean first = TRUE;
+
+  for (l = buffers; l; l = l->next) {
+    GstMapInfo map;
+    const gint16 *samples;
+    gsize i;
+
+    gst_buffer_map (GST_BUFFER (l->data), &map, GST_MAP_READ);
+    samples = (const gint16 *) map.data;
+    for (i = 0; i < map.size / sizeof (gint16); i++) {
+      if (!first)
+        max_jump = MAX (max_jump, ABS (samples[i] - prev));
+      prev = samples[i];
+      first = FALSE;
+    }
+    gst_buffer_unmap (GST_BUFFER (l->data), &map);
+  }
+
+  return max_jump;
+}
+
+GST_START_TEST (test_band_limited)
+{
+  GstElement *audiotestsrc;
+  const gchar *waves[] = { "square", "saw" };
+  /* the naive waves jump by twice the amplitude */
+  const gint full_jump = 2 * 0.8 * 32767;
+  guint i;
+  gint j;
+
+  audiotestsrc = setup_audiotestsrc ();
+
+  for (i = 0; i < G_N_ELEMENTS (waves); i++) {
+    for (j = 0; j < 2; j++) {
+      gint max_jump;
+
+      gst_util_set_object_arg (G_OBJECT (audiotestsrc), "wave", waves[i]);
+      g_object_set (audiotestsrc, "freq", 1000.0, "band-limited", j, NULL);
+
+      fail_unless (gst_element_set_state (audiotestsrc,
+              GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+          "could not set to playing");
+
+      g_mutex_lock (&check_mutex);
+      while (g_list_length (buffers) < 4)
+        g_cond_wait (&check_cond, &check_mutex);
+      g_mutex_unlock (&check_mutex);
+
+      gst_element_set_state (audiotestsrc, GST_STATE_READY);
+
+      /* the band-limited waves spread the jumps over two samples */
+      max_jump = get_max_jump ();
+      GST_DEBUG ("%s band-limited=%d: max jump %d", waves[i], j, max_jump);
+      if (j)
+        fail_unless (max_jump < full_jump * 8 / 10, "%s jumps by %d", waves[i],
+            max_jump);
+      else
+        fail_unless (max_jump > full_jump * 9 / 10, "%s jumps by %d", waves[i],
+            max_jump);
+
+      g_list_foreach (buffers, (GFunc) gst_mini_object_unref, NULL);
+      g_list_free (buffers);
+      buffers = NULL;
+    }
+  }
+
+  /* cleanup */
+  cleanup_audiotestsrc (audiotestsrc);
+}
+
+GST_END_TEST;
+
+#define TEST_RATE 44100
+#define TEST_FREQ 1000.0
+
+/* runs audiotestsrc with @wave at TEST_FREQ and returns the first buffer of
+ * @n_frames S16 frames with @channels channels */
+static gint16 *
+get_frames (const gchar * wave, gboolean band_limited, gint channels,
+    gint n_frames)
+{
+  GstStaticPadTemplate template = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK,
+      GST_PAD_ALWAYS,
+      GST_STATIC_CAPS_ANY);
+  GstElement *audiotestsrc;
+  GstMapInfo map;
+  gchar *caps_str;
+  gint16 *frames;
+
+  caps_str = g_strdup_printf ("audio/x-raw, format = (string) %s, "
+      "channels = (int) %d, rate = (int) %d", GST_AUDIO_NE (S16), channels,
+      TEST_RATE);
+  template.static_caps.string = caps_str;
+
+  audiotestsrc = gst_check_setup_element ("audiotestsrc");
+  mysinkpad = gst_check_setup_sink_pad (audiotestsrc, &template);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  gst_util_set_object_arg (G_OBJECT (audiotestsrc), "wave", wave);
+  g_object_set (audiotestsrc, "freq", TEST_FREQ, "band-limited", band_limited,
+      "samplesperbuffer", n_frames, NULL);
+
+  fail_unless (gst_element_set_state (audiotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 1)
+    g_cond_wait (&check_cond, &check_mutex);
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (audiotestsrc, GST_STATE_READY);
+
+  gst_buffer_map (GST_BUFFER (buffers->data), &map, GST_MAP_READ);
+  fail_unless_equals_int (map.size, n_frames * channels * sizeof (gint16));
+  frames = g_memdup (map.data, map.size);
+  gst_buffer_unmap (GST_BUFFER (buffers->data), &map);
+
+  cleanup_audiotestsrc (audiotestsrc);
+  g_free (caps_str);
+
+  return frames;
+}
+
+GST_START_TEST (test_band_limited_triangle)
+{
+  /* the naive triangle changes its slope by 8 * dt of the amplitude at the
+   * corners, all within one sample */
+  const gdouble full_bend = 8.0 * TEST_FREQ / TEST_RATE * 0.8 * 32767;
+  const gint n_frames = TEST_RATE / 10;
+  gint j;
+
+  for (j = 0; j < 2; j++) {
+    gint16 *frames;
+    gint i, max_bend = 0;
+
+    frames = get_frames ("triangle", j, 1, n_frames);
+    for (i = 1; i + 1 < n_frames; i++)
+      max_bend = MAX (max_bend,
+          ABS (frames[i + 1] - 2 * frames[i] + frames[i - 1]));
+    g_free (frames);
+
+    /* PolyBLAMP spreads the bend over the samples around the corner, which
+     * leaves at most two thirds of it for one sample */
+    GST_DEBUG ("triangle band-limited=%d: max bend %d of %f", j, max_bend,
+        full_bend);
+    if (j)
+      fail_unless (max_bend < full_bend * 0.75, "triangle bends by %d",
+          max_bend);
+    else
+      fail_unless (max_bend > full_bend * 0.9, "triangle bends by %d",
+          max_bend);
+  }
+}
+
+GST_END_TEST;
+
+/* every channel of multichannel output has to be the mono output */
+GST_START_TEST (test_multichannel)
+{
+  const gchar *waves[] = { "sine", "square", "saw", "triangle", "sine-table",
+    "ticks"
+  };
+  const gint channels[] = { 2, 5, 8 };
+  const gint n_frames = 1000;
+  guint i, k;
+  gint j, n, c;
+
+  for (i = 0; i < G_N_ELEMENTS (waves); i++) {
+    for (j = 0; j < 2; j++) {
+      gint16 *mono = get_frames (waves[i], j, 1, n_frames);
+
+      for (k = 0; k < G_N_ELEMENTS (channels); k++) {
+        gint16 *frames = get_frames (waves[i], j, channels[k], n_frames);
+
+        for (n = 0; n < n_frames; n++) {
+          for (c = 0; c < channels[k]; c++) {
+            fail_unless_equals_int (frames[n * channels[k] + c], mono[n]);
+          }
+        }
+        g_free (frames);
+      }
+      g_free (mono);
+    }
+  }
+}
+
+GST_END_TEST;
+
 static Suite *
 audiotestsrc_suite (void)
 {
@@ -120,6 +317,9 @@ audiotestsrc_suite (void)
 
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_all_waves);
+  tcase_add_test (tc_chain, test_band_limited);
+  tcase_add_test (tc_chain, test_band_limited_triangle);
+  tcase_add_test (tc_chain, test_multichannel);
 
   return s;
 }
@@ -60,6 +60,20 @@ static GstPad *mysrcpad, *mysinkpad;
     "framerate = (fraction) 999/7 , "	\
     "format = (string) I420"
 
+#define VIDEO_CAPS_BLEND_IN_STRING     \
+    "video/x-raw, "                 \
+    "width = (int) 4, "                 \
+    "height = (int) 2, "                \
+    "framerate = (fraction) 25/1 , "    \
+    "format = (string) GRAY8"
+
+#define VIDEO_CAPS_BLEND_OUT_STRING    \
+    "video/x-raw, "                 \
+    "width = (int) 4, "                 \
+    "height = (int) 2, "                \
+    "framerate = (fraction) 50/1 , "    \
+    "format = (string) GRAY8"
+
 static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
@@ -71,6 +85,12 @@ GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_ALWAYS,
     GST_STATIC_CAPS (VIDEO_CAPS_STRING)
     );
+static GstStaticPadTemplate blendsinktemplate =
+GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (VIDEO_CAPS_BLEND_OUT_STRING)
+    );
 static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
@@ -1133,6 +1153,147 @@ GST_START_TEST (test_rate)
 
 GST_END_TEST;
 
+GST_START_TEST (test_duplicate_no_copy)
+{
+  GstElement *videorate;
+  GstBuffer *first, *second;
+  GstMemory *mem, *no_share_mem;
+  GstCaps *caps;
+  GList *l;
+
+  videorate = setup_videorate ();
+  fail_unless (gst_element_set_state (videorate,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  caps = gst_caps_from_string (VIDEO_CAPS_STRING);
+  gst_check_setup_events (mysrcpad, videorate, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+
+  /* one memory that can be shared and one that may not be shared, like the
+   * memory of a buffer pool */
+  first = gst_buffer_new_and_alloc (4);
+  gst_buffer_memset (first, 0, 1, 4);
+  mem = gst_buffer_peek_memory (first, 0);
+  no_share_mem = gst_allocator_alloc (NULL, 4, NULL);
+  GST_MINI_OBJECT_FLAG_SET (no_share_mem, GST_MEMORY_FLAG_NO_SHARE);
+  gst_buffer_append_memory (first, no_share_mem);
+  gst_buffer_memset (first, 4, 3, 4);
+  GST_BUFFER_TIMESTAMP (first) = 0;
+  gst_buffer_ref (first);
+  fail_unless (gst_pad_push (mysrcpad, first) == GST_FLOW_OK);
+
+  second = gst_buffer_new_and_alloc (4);
+  gst_buffer_memset (second, 0, 2, 4);
+  GST_BUFFER_TIMESTAMP (second) = GST_SECOND * 3 / 25;
+  fail_unless (gst_pad_push (mysrcpad, second) == GST_FLOW_OK);
+
+  /* the first frame and its duplicate are pushed out */
+  assert_videorate_stats (videorate, "second buffer", 2, 2, 0, 1);
+  fail_unless_equals_int (g_list_length (buffers), 2);
+
+  for (l = buffers; l; l = l->next) {
+    GstBuffer *outbuf = l->data;
+    guint8 byte = 0;
+
+    /* new buffers that share the memory that can be shared and have a
+     * copy of the other one */
+    fail_if (outbuf == first);
+    fail_unless_equals_int (gst_buffer_n_memory (outbuf), 2);
+    fail_unless (gst_buffer_peek_memory (outbuf, 0) == mem);
+    fail_unless (gst_buffer_peek_memory (outbuf, 1) != no_share_mem);
+    fail_unless_equals_int (buffer_get_byte (outbuf, 0), 1);
+    fail_unless_equals_int (gst_buffer_extract (outbuf, 4, &byte, 1), 1);
+    fail_unless_equals_int (byte, 3);
+  }
+  fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buffers->data), 0);
+  fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buffers->next->data),
+      GST_SECOND / 25);
+  fail_unless (GST_BUFFER_FLAG_IS_SET (buffers->next->data,
+          GST_BUFFER_FLAG_GAP));
+
+  cleanup_videorate (videorate);
+
+  ASSERT_BUFFER_REFCOUNT (first, "first", 1);
+  gst_buffer_unref (first);
+}
+
+GST_END_TEST;
+
+static GstBuffer *
+create_blend_buffer (GstClockTime ts, guint8 value)
+{
+  GstBuffer *buf;
+
+  buf = gst_buffer_new_and_alloc (8);
+  gst_buffer_memset (buf, 0, value, 8);
+  GST_BUFFER_TIMESTAMP (buf) = ts;
+
+  return buf;
+}
+
+GST_START_TEST (test_blend)
+{
+  GstElement *videorate;
+  GstCaps *caps;
+  GList *l;
+  guint threads;
+
+  /* upconvert 25 to 50 fps, every other frame must be an average of its
+   * neighbours; check the threaded path gives the same result */
+  for (threads = 1; threads <= 2; threads++) {
+    videorate = setup_videorate_full (&srctemplate, &blendsinktemplate);
+    g_object_set (videorate, "interpolation", 1, "n-threads", threads, NULL);
+    fail_unless (gst_element_set_state (videorate,
+            GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+        "could not set to playing");
+
+    caps = gst_caps_from_string (VIDEO_CAPS_BLEND_IN_STRING);
+    gst_check_setup_events (mysrcpad, videorate, caps, GST_FORMAT_TIME);
+    gst_caps_unref (caps);
+
+    fail_unless (gst_pad_push (mysrcpad,
+            create_blend_buffer (0, 0)) == GST_FLOW_OK);
+    fail_unless_equals_int (g_list_length (buffers), 0);
+
+    fail_unless (gst_pad_push (mysrcpad,
+            create_blend_buffer (GST_SECOND / 25, 200)) == GST_FLOW_OK);
+    fail_unless_equals_int (g_list_length (buffers), 2);
+    assert_videorate_stats (videorate, "blend", 2, 2, 0, 0);
+
+    fail_unless (gst_pad_push (mysrcpad,
+            create_blend_buffer (GST_SECOND * 2 / 25, 100)) == GST_FLOW_OK);
+    fail_unless_equals_int (g_list_length (buffers), 4);
+    assert_videorate_stats (videorate, "blend", 3, 4, 0, 0);
+
+    l = buffers;
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (l->data), 0);
+    fail_unless_equals_int (buffer_get_byte (l->data, 0), 0);
+    fail_if (GST_BUFFER_FLAG_IS_SET (l->data, GST_BUFFER_FLAG_GAP));
+
+    l = g_list_next (l);
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (l->data), GST_SECOND / 50);
+    fail_unless_equals_int (buffer_get_byte (l->data, 0), 100);
+    fail_unless_equals_int (buffer_get_byte (l->data, 7), 100);
+    fail_if (GST_BUFFER_FLAG_IS_SET (l->data, GST_BUFFER_FLAG_GAP));
+
+    l = g_list_next (l);
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (l->data),
+        GST_SECOND * 2 / 50);
+    fail_unless_equals_int (buffer_get_byte (l->data, 0), 200);
+
+    l = g_list_next (l);
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (l->data),
+        GST_SECOND * 3 / 50);
+    fail_unless_equals_int (buffer_get_byte (l->data, 0), 150);
+    fail_unless_equals_int (buffer_get_byte (l->data, 7), 150);
+
+    cleanup_videorate (videorate);
+  }
+}
+
+GST_END_TEST;
+
 static Suite *
 videorate_suite (void)
 {
@@ -1152,6 +1313,8 @@ videorate_suite (void)
   tcase_add_loop_test (tc_chain, test_caps_negotiation,
       0, G_N_ELEMENTS (caps_negotiation_tests));
   tcase_add_test (tc_chain, test_rate);
+  tcase_add_test (tc_chain, test_duplicate_no_copy);
+  tcase_add_test (tc_chain, test_blend);
 
   return s;
 }
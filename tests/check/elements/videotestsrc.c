@@ -30,6 +30,7 @@
 #endif
 
 #include <unistd.h>
+#include <string.h>
 
 #include <gst/check/gstcheck.h>
 
@@ -119,6 +120,129 @@ GST_START_TEST (test_all_patterns)
 
 GST_END_TEST;
 
+GST_START_TEST (test_cache_static)
+{
+  GstElement *videotestsrc;
+  GstBuffer *buf1, *buf2, *buf3;
+
+  videotestsrc = setup_videotestsrc ();
+  g_object_set (videotestsrc, "cache-static", TRUE, NULL);
+
+  fail_unless (gst_element_set_state (videotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 3) {
+    GST_DEBUG_OBJECT (videotestsrc, "Waiting for more buffers");
+    g_cond_wait (&check_cond, &check_mutex);
+  }
+  buf1 = GST_BUFFER (g_list_nth_data (buffers, 0));
+  buf2 = GST_BUFFER (g_list_nth_data (buffers, 1));
+  buf3 = GST_BUFFER (g_list_nth_data (buffers, 2));
+  g_mutex_unlock (&check_mutex);
+
+  /* the smpte pattern is rendered once and shared by all buffers */
+  fail_unless_equals_int (gst_buffer_n_memory (buf2), 1);
+  fail_unless (gst_buffer_peek_memory (buf1, 0) ==
+      gst_buffer_peek_memory (buf2, 0));
+  fail_unless (gst_buffer_peek_memory (buf2, 0) ==
+      gst_buffer_peek_memory (buf3, 0));
+
+  /* but every buffer has its own timestamps */
+  fail_unless (GST_BUFFER_PTS (buf1) < GST_BUFFER_PTS (buf2));
+  fail_unless (GST_BUFFER_PTS (buf2) < GST_BUFFER_PTS (buf3));
+  fail_unless (GST_BUFFER_OFFSET (buf1) + 1 == GST_BUFFER_OFFSET (buf2));
+
+  gst_element_set_state (videotestsrc, GST_STATE_READY);
+  gst_check_drop_buffers ();
+
+  /* moving patterns are rendered for every frame */
+  gst_util_set_object_arg (G_OBJECT (videotestsrc), "pattern", "ball");
+  fail_unless (gst_element_set_state (videotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 2) {
+    GST_DEBUG_OBJECT (videotestsrc, "Waiting for more buffers");
+    g_cond_wait (&check_cond, &check_mutex);
+  }
+  buf1 = GST_BUFFER (g_list_nth_data (buffers, 0));
+  buf2 = GST_BUFFER (g_list_nth_data (buffers, 1));
+  fail_if (gst_buffer_peek_memory (buf1, 0) ==
+      gst_buffer_peek_memory (buf2, 0));
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (videotestsrc, GST_STATE_READY);
+  gst_check_drop_buffers ();
+
+  /* cleanup */
+  cleanup_videotestsrc (videotestsrc);
+}
+
+GST_END_TEST;
+
+static GstBuffer *
+render_first_frame (const gchar * pattern, guint n_threads)
+{
+  GstElement *videotestsrc;
+  GstBuffer *buf;
+
+  videotestsrc = setup_videotestsrc ();
+  gst_util_set_object_arg (G_OBJECT (videotestsrc), "pattern", pattern);
+  g_object_set (videotestsrc, "n-threads", n_threads, "kx2", 20, "ky2", 20,
+      "kxy", 4, "ky", 3, "kt", 1, "num-buffers", 1, NULL);
+
+  fail_unless (gst_element_set_state (videotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 1) {
+    GST_DEBUG_OBJECT (videotestsrc, "Waiting for more buffers");
+    g_cond_wait (&check_cond, &check_mutex);
+  }
+  buf = gst_buffer_ref (GST_BUFFER (buffers->data));
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (videotestsrc, GST_STATE_NULL);
+  cleanup_videotestsrc (videotestsrc);
+
+  return buf;
+}
+
+GST_START_TEST (test_threads)
+{
+  const gchar *patterns[] = { "zone-plate", "chroma-zone-plate", "circular",
+    "gamut"
+  };
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (patterns); i++) {
+    GstBuffer *buf1, *buf4;
+    GstMapInfo map1, map4;
+
+    GST_DEBUG ("testing pattern %s", patterns[i]);
+
+    /* rendering in bands gives the same image as rendering on one thread */
+    buf1 = render_first_frame (patterns[i], 1);
+    buf4 = render_first_frame (patterns[i], 4);
+
+    gst_buffer_map (buf1, &map1, GST_MAP_READ);
+    gst_buffer_map (buf4, &map4, GST_MAP_READ);
+    fail_unless_equals_int (map1.size, map4.size);
+    fail_unless (memcmp (map1.data, map4.data, map1.size) == 0);
+    gst_buffer_unmap (buf4, &map4);
+    gst_buffer_unmap (buf1, &map1);
+
+    gst_buffer_unref (buf1);
+    gst_buffer_unref (buf4);
+  }
+}
+
+GST_END_TEST;
+
 static guint32
 right_shift_colour (guint32 mask, guint32 pixel)
 {
@@ -386,6 +510,8 @@ videotestsrc_suite (void)
 
   tcase_add_test (tc_chain, test_all_patterns);
   tcase_add_test (tc_chain, test_rgb_formats);
+  tcase_add_test (tc_chain, test_cache_static);
+  tcase_add_test (tc_chain, test_threads);
 
   return s;
 }
@@ -58,7 +58,7 @@ static GstPad *mysrcpad, *mysinkpad;
     "format = (string) "FORMATS1", "    \
     "channels = (int) [ 1, MAX ], "     \
     "rate = (int) [ 1,  MAX ], "        \
-    "layout = (string) interleaved"
+    "layout = (string) { interleaved, non-interleaved }"
 
 #define VOLUME_CAPS_STRING_S8           \
     "audio/x-raw, "                     \
@@ -74,6 +74,13 @@ static GstPad *mysrcpad, *mysinkpad;
     "rate = (int) 44100,"               \
     "layout = (string) interleaved"
 
+#define VOLUME_CAPS_STRING_S16_NON_INTERLEAVED  \
+    "audio/x-raw, "                     \
+    "format = (string) "FORMATS3", "   \
+    "channels = (int) 2, "              \
+    "rate = (int) 44100,"               \
+    "layout = (string) non-interleaved"
+
 #define VOLUME_CAPS_STRING_S24          \
     "audio/x-raw, "                     \
     "format = (string) "FORMATS4", "   \
@@ -1862,6 +1869,141 @@ GST_START_TEST (test_controller_defaults_at_ts0)
 
 GST_END_TEST;
 
+GST_START_TEST (test_controller_non_interleaved)
+{
+  GstControlSource *cs;
+  GstTimedValueControlSource *tvcs;
+  GstElement *volume;
+  GstBuffer *inbuffer, *outbuffer;
+  GstCaps *caps;
+  gint16 in[4] = { 1000, 2000, 3000, 4000 };
+  gint16 out[4] = { 500, 2000, 1500, 4000 };
+  GstMapInfo map;
+  GstSegment seg;
+
+  volume = setup_volume ();
+
+  cs = gst_interpolation_control_source_new ();
+  g_object_set (cs, "mode", GST_INTERPOLATION_MODE_NONE, NULL);
+  gst_object_add_control_binding (GST_OBJECT_CAST (volume),
+      gst_direct_control_binding_new (GST_OBJECT_CAST (volume), "volume", cs));
+
+  /* half volume for the first frame, unity for the second one, the values
+   * are divided by 10 as the value range for volume is 0.0 ... 10.0 */
+  tvcs = (GstTimedValueControlSource *) cs;
+  gst_timed_value_control_source_set (tvcs, 0, 0.05);
+  gst_timed_value_control_source_set (tvcs,
+      gst_util_uint64_scale_int (1, GST_SECOND, 44100), 0.1);
+
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  /* two frames of two channels, one plane per channel */
+  inbuffer = gst_buffer_new_and_alloc (8);
+  gst_buffer_fill (inbuffer, 0, in, 8);
+  caps = gst_caps_from_string (VOLUME_CAPS_STRING_S16_NON_INTERLEAVED);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  gst_caps_unref (caps);
+
+  gst_segment_init (&seg, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_segment (&seg)) == TRUE);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, out, 8) == 0);
+  gst_buffer_unmap (outbuffer, &map);
+
+  gst_object_unref (cs);
+  cleanup_volume (volume);
+}
+
+GST_END_TEST;
+
+
+static void
+check_controller_ramp (const gchar * ramp)
+{
+  GstControlSource *cs;
+  GstTimedValueControlSource *tvcs;
+  GstElement *volume;
+  GstBuffer *inbuffer, *outbuffer;
+  GstCaps *caps;
+  GstClockTime interval;
+  GstMapInfo map;
+  GstSegment seg;
+  gint16 *out;
+  gint i;
+
+  volume = setup_volume ();
+  gst_util_set_object_arg (G_OBJECT (volume), "ramp", ramp);
+
+  cs = gst_interpolation_control_source_new ();
+  g_object_set (cs, "mode", GST_INTERPOLATION_MODE_LINEAR, NULL);
+  gst_object_add_control_binding (GST_OBJECT_CAST (volume),
+      gst_direct_control_binding_new (GST_OBJECT_CAST (volume), "volume", cs));
+
+  /* volume from 0.1 to 1.0 over 256 samples, the values are divided by 10
+   * as the value range for volume is 0.0 ... 10.0 */
+  interval = gst_util_uint64_scale_int (1, GST_SECOND, 44100);
+  tvcs = (GstTimedValueControlSource *) cs;
+  gst_timed_value_control_source_set (tvcs, 0, 0.01);
+  gst_timed_value_control_source_set (tvcs, 256 * interval, 0.1);
+
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (256 * sizeof (gint16));
+  gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+  for (i = 0; i < 256; i++)
+    ((gint16 *) map.data)[i] = 10000;
+  gst_buffer_unmap (inbuffer, &map);
+  caps = gst_caps_from_string (VOLUME_CAPS_STRING_S16);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  gst_caps_unref (caps);
+
+  gst_segment_init (&seg, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_segment (&seg)) == TRUE);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  out = (gint16 *) map.data;
+  for (i = 0; i < 256; i++) {
+    gint expected = 1000 + 9000 * i / 256;
+
+    /* the exponential ramp only meets the control curve every 64 samples
+     * and stays below it in between */
+    if (strcmp (ramp, "linear") == 0 || i % 64 == 0)
+      fail_unless (ABS (out[i] - expected) <= 2, "sample %d: %d != %d", i,
+          out[i], expected);
+    else
+      fail_unless (out[i] <= expected + 2 && out[i] > out[i - 1],
+          "sample %d: %d", i, out[i]);
+  }
+  gst_buffer_unmap (outbuffer, &map);
+
+  gst_object_unref (cs);
+  cleanup_volume (volume);
+}
+
+/* with a ramp the controlled volume is interpolated between blocks */
+GST_START_TEST (test_controller_ramp)
+{
+  check_controller_ramp ("linear");
+  check_controller_ramp ("exponential");
+}
+
+GST_END_TEST;
+
 
 static Suite *
 volume_suite (void)
@@ -1906,6 +2048,8 @@ volume_suite (void)
   tcase_add_test (tc_chain, test_controller_usability);
   tcase_add_test (tc_chain, test_controller_processing);
   tcase_add_test (tc_chain, test_controller_defaults_at_ts0);
+  tcase_add_test (tc_chain, test_controller_non_interleaved);
+  tcase_add_test (tc_chain, test_controller_ramp);
 
   return s;
 }
@@ -591,6 +591,178 @@ GST_START_TEST (test_audio_info)
 
 GST_END_TEST;
 
+/* a ringbuffer with a device thread that consumes one segment of 1 ms
+ * every ms, like a sound card would */
+#define TEST_RATE 48000
+#define TEST_SEGMENT_SAMPLES (TEST_RATE / 1000)
+#define TEST_SEGMENTS 1000
+
+typedef struct
+{
+  GstAudioRingBuffer parent;
+
+  gint running;
+  guint segments;
+  guint glitches;
+  guint errors;
+} TestRingBuffer;
+
+typedef GstAudioRingBufferClass TestRingBufferClass;
+
+GType test_ring_buffer_get_type (void);
+
+G_DEFINE_TYPE (TestRingBuffer, test_ring_buffer, GST_TYPE_AUDIO_RING_BUFFER);
+
+static gboolean
+test_ring_buffer_acquire (GstAudioRingBuffer * buf,
+    GstAudioRingBufferSpec * spec)
+{
+  buf->size = spec->segtotal * spec->segsize;
+  buf->memory = g_malloc0 (buf->size);
+
+  return TRUE;
+}
+
+static gboolean
+test_ring_buffer_release (GstAudioRingBuffer * buf)
+{
+  g_free (buf->memory);
+  buf->memory = NULL;
+
+  return TRUE;
+}
+
+static void
+test_ring_buffer_class_init (TestRingBufferClass * klass)
+{
+  klass->acquire = test_ring_buffer_acquire;
+  klass->release = test_ring_buffer_release;
+}
+
+static void
+test_ring_buffer_init (TestRingBuffer * tbuf)
+{
+}
+
+static gpointer
+test_ring_buffer_thread (TestRingBuffer * tbuf)
+{
+  GstAudioRingBuffer *buf = GST_AUDIO_RING_BUFFER_CAST (tbuf);
+  guint32 expected = 1;
+  gint64 deadline, now;
+
+  deadline = g_get_monotonic_time ();
+  while (tbuf->segments < TEST_SEGMENTS) {
+    guint8 *readptr;
+    gint segment, len;
+    guint32 first;
+
+    deadline += 1000;
+    now = g_get_monotonic_time ();
+    if (deadline > now)
+      g_usleep (deadline - now);
+
+    /* not started yet */
+    if (!gst_audio_ring_buffer_prepare_read (buf, &segment, &readptr, &len))
+      continue;
+
+    /* the writer was too late for this segment when it is silent */
+    first = ((guint32 *) readptr)[0];
+    if (first == 0)
+      tbuf->glitches++;
+    else if (first != expected)
+      tbuf->errors++;
+    expected += len / sizeof (guint32);
+    tbuf->segments++;
+
+    gst_audio_ring_buffer_clear (buf, segment);
+    gst_audio_ring_buffer_advance (buf, 1);
+  }
+
+  return NULL;
+}
+
+static guint
+run_ring_buffer_stress (gboolean lock_free)
+{
+  GstAudioRingBuffer *buf;
+  TestRingBuffer *tbuf;
+  GstAudioRingBufferSpec *spec;
+  GThread *thread;
+  guint32 data[TEST_SEGMENT_SAMPLES];
+  guint32 counter = 1;
+  guint64 sample = 0;
+  gint accum = 0;
+  guint glitches;
+  gint i, j;
+
+  tbuf = g_object_new (test_ring_buffer_get_type (), NULL);
+  buf = GST_AUDIO_RING_BUFFER_CAST (tbuf);
+
+  gst_audio_ring_buffer_set_lock_free (buf, lock_free);
+#if defined (HAVE_LINUX_FUTEX_H) && defined (HAVE_SYS_SYSCALL_H)
+  fail_unless_equals_int (gst_audio_ring_buffer_is_lock_free (buf), lock_free);
+#endif
+
+  spec = &buf->spec;
+  gst_audio_info_set_format (&spec->info, GST_AUDIO_FORMAT_S32, TEST_RATE, 1,
+      NULL);
+  spec->type = GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW;
+  spec->latency_time = 1000;
+  spec->buffer_time = 4000;
+  spec->segsize = TEST_SEGMENT_SAMPLES * sizeof (guint32);
+  spec->segtotal = 4;
+  spec->seglatency = -1;
+
+  fail_unless (gst_audio_ring_buffer_open_device (buf));
+  fail_unless (gst_audio_ring_buffer_acquire (buf, spec));
+  gst_audio_ring_buffer_set_flushing (buf, FALSE);
+  gst_audio_ring_buffer_may_start (buf, TRUE);
+
+  thread = g_thread_new ("test-ringbuffer",
+      (GThreadFunc) test_ring_buffer_thread, tbuf);
+
+  /* the writer is much faster than the device and blocks on a full
+   * ringbuffer, so it only glitches when it is woken up too late */
+  for (i = 0; i < TEST_SEGMENTS; i++) {
+    for (j = 0; j < TEST_SEGMENT_SAMPLES; j++)
+      data[j] = counter++;
+    fail_unless_equals_int (gst_audio_ring_buffer_commit (buf, &sample,
+            (guint8 *) data, TEST_SEGMENT_SAMPLES, TEST_SEGMENT_SAMPLES,
+            &accum), TEST_SEGMENT_SAMPLES);
+  }
+  g_thread_join (thread);
+
+  GST_INFO ("lock-free %d: %u glitches in %u segments", lock_free,
+      tbuf->glitches, tbuf->segments);
+  fail_unless_equals_int (tbuf->errors, 0);
+
+  fail_unless (gst_audio_ring_buffer_stop (buf));
+  fail_unless (gst_audio_ring_buffer_release (buf));
+  fail_unless (gst_audio_ring_buffer_close_device (buf));
+  glitches = tbuf->glitches;
+  gst_object_unref (buf);
+
+  return glitches;
+}
+
+GST_START_TEST (test_ring_buffer_stress)
+{
+  guint locked, lock_free;
+
+  locked = run_ring_buffer_stress (FALSE);
+  lock_free = run_ring_buffer_stress (TRUE);
+
+  GST_INFO ("glitches with 1 ms segments: %u locked, %u lock-free", locked,
+      lock_free);
+
+  /* with 4 ms of headroom a loaded machine may still glitch now and then */
+  fail_unless (locked < TEST_SEGMENTS / 10);
+  fail_unless (lock_free < TEST_SEGMENTS / 10);
+}
+
+GST_END_TEST;
+
 static Suite *
 audio_suite (void)
 {
@@ -604,6 +776,7 @@ audio_suite (void)
   tcase_add_test (tc_chain, test_buffer_clipping_samples);
   tcase_add_test (tc_chain, test_multichannel_checks);
   tcase_add_test (tc_chain, test_multichannel_reorder);
+  tcase_add_test (tc_chain, test_ring_buffer_stress);
 
   return s;
 }
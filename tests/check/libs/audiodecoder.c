@@ -0,0 +1,355 @@
+/* GStreamer
+ *
+ * unit tests for the audio decoder base class
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/check/gstcheck.h>
+
+#include <gst/audio/audio.h>
+#include <gst/audio/gstaudiodecoder.h>
+#include <string.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+
+#define TEST_RATE 8000
+/* 2.5 ms frames of S16 mono */
+#define TEST_FRAME_SAMPLES 20
+#define TEST_FRAME_SIZE (TEST_FRAME_SAMPLES * 2)
+#define TEST_FRAME_DURATION \
+    gst_util_uint64_scale_int (TEST_FRAME_SAMPLES, GST_SECOND, TEST_RATE)
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+        ", rate = (int) 8000, channels = (int) 1, "
+        "layout = (string) interleaved"));
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("audio/x-test"));
+
+/* a decoder for a codec whose frames are plain samples, it decodes them
+ * into the output regions of the base class or into buffers of their own */
+typedef struct _GstAudioDecoderTester GstAudioDecoderTester;
+typedef struct _GstAudioDecoderTesterClass GstAudioDecoderTesterClass;
+
+struct _GstAudioDecoderTester
+{
+  GstAudioDecoder parent;
+
+  gboolean use_region;
+};
+
+struct _GstAudioDecoderTesterClass
+{
+  GstAudioDecoderClass parent_class;
+};
+
+static GType gst_audio_decoder_tester_get_type (void);
+G_DEFINE_TYPE (GstAudioDecoderTester, gst_audio_decoder_tester,
+    GST_TYPE_AUDIO_DECODER);
+
+static gboolean
+gst_audio_decoder_tester_set_format (GstAudioDecoder * dec, GstCaps * caps)
+{
+  GstAudioInfo info;
+
+  gst_audio_info_init (&info);
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_S16, TEST_RATE, 1, NULL);
+
+  return gst_audio_decoder_set_output_format (dec, &info);
+}
+
+static GstFlowReturn
+gst_audio_decoder_tester_handle_frame (GstAudioDecoder * dec,
+    GstBuffer * buffer)
+{
+  GstAudioDecoderTester *tester = (GstAudioDecoderTester *) dec;
+  gsize size;
+  guint8 *data;
+  GstBuffer *out;
+  GstMapInfo map;
+
+  /* nothing to drain */
+  if (buffer == NULL)
+    return GST_FLOW_OK;
+
+  size = gst_buffer_get_size (buffer);
+
+  if (tester->use_region) {
+    data = gst_audio_decoder_get_output_region (dec, size);
+    fail_unless (data != NULL);
+    gst_buffer_extract (buffer, 0, data, size);
+    return gst_audio_decoder_finish_frame_region (dec, size, 1);
+  }
+
+  out = gst_audio_decoder_allocate_output_buffer (dec, size);
+  gst_buffer_map (out, &map, GST_MAP_WRITE);
+  gst_buffer_extract (buffer, 0, map.data, size);
+  gst_buffer_unmap (out, &map);
+  return gst_audio_decoder_finish_frame (dec, out, 1);
+}
+
+static void
+gst_audio_decoder_tester_class_init (GstAudioDecoderTesterClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAudioDecoderClass *audiodecoder_class = GST_AUDIO_DECODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-test"));
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+          ", rate = (int) 8000, channels = (int) 1, "
+          "layout = (string) interleaved"));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_static_metadata (element_class,
+      "AudioDecoderTester", "Decoder/Audio", "yep", "me");
+
+  audiodecoder_class->set_format = gst_audio_decoder_tester_set_format;
+  audiodecoder_class->handle_frame = gst_audio_decoder_tester_handle_frame;
+}
+
+static void
+gst_audio_decoder_tester_init (GstAudioDecoderTester * tester)
+{
+}
+
+/* the decoder only aggregates output when upstream is not live */
+static gboolean
+src_pad_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  if (GST_QUERY_TYPE (query) == GST_QUERY_LATENCY) {
+    gst_query_set_latency (query, FALSE, 0, GST_CLOCK_TIME_NONE);
+    return TRUE;
+  }
+  return gst_pad_query_default (pad, parent, query);
+}
+
+static GstElement *
+setup_audiodecodertester (gboolean use_region, GstClockTime min_latency)
+{
+  GstElement *dec;
+  GstCaps *caps;
+
+  dec = g_object_new (gst_audio_decoder_tester_get_type (), NULL);
+  ((GstAudioDecoderTester *) dec)->use_region = use_region;
+  g_object_set (dec, "min-latency", (gint64) min_latency, NULL);
+
+  mysrcpad = gst_check_setup_src_pad (dec, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (dec, &sinktemplate);
+  gst_pad_set_query_function (mysrcpad, src_pad_query);
+
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  fail_unless (gst_element_set_state (dec,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  caps = gst_caps_new_empty_simple ("audio/x-test");
+  gst_check_setup_events (mysrcpad, dec, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+
+  return dec;
+}
+
+static void
+cleanup_audiodecodertester (GstElement * dec)
+{
+  gst_element_set_state (dec, GST_STATE_NULL);
+
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (dec);
+  gst_check_teardown_sink_pad (dec);
+  gst_check_teardown_element (dec);
+
+  gst_check_drop_buffers ();
+}
+
+/* pushes @n frames with a ramp of samples, frames from @gap_at on are
+ * timestamped one second later */
+static void
+push_frames (guint n, guint gap_at)
+{
+  guint i, j;
+
+  for (i = 0; i < n; i++) {
+    GstBuffer *buf;
+    GstMapInfo map;
+    gint16 *samples;
+
+    buf = gst_buffer_new_and_alloc (TEST_FRAME_SIZE);
+    gst_buffer_map (buf, &map, GST_MAP_WRITE);
+    samples = (gint16 *) map.data;
+    for (j = 0; j < TEST_FRAME_SAMPLES; j++)
+      samples[j] = i * TEST_FRAME_SAMPLES + j;
+    gst_buffer_unmap (buf, &map);
+
+    GST_BUFFER_TIMESTAMP (buf) = i * TEST_FRAME_DURATION;
+    if (i >= gap_at)
+      GST_BUFFER_TIMESTAMP (buf) += GST_SECOND;
+    GST_BUFFER_DURATION (buf) = TEST_FRAME_DURATION;
+
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+  }
+
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+}
+
+/* checks that the output holds the ramp of @n frames, returns the number
+ * of output buffers */
+static guint
+check_output (guint n, guint gap_at)
+{
+  GList *walk;
+  guint sample = 0;
+
+  for (walk = buffers; walk; walk = walk->next) {
+    GstBuffer *buf = walk->data;
+    GstClockTime ts;
+    GstMapInfo map;
+    gint16 *samples;
+    guint i, count;
+
+    gst_buffer_map (buf, &map, GST_MAP_READ);
+    samples = (gint16 *) map.data;
+    count = map.size / 2;
+
+    ts = gst_util_uint64_scale_int (sample, GST_SECOND, TEST_RATE);
+    if (sample >= gap_at * TEST_FRAME_SAMPLES)
+      ts += GST_SECOND;
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buf), ts);
+    fail_unless_equals_uint64 (GST_BUFFER_DURATION (buf),
+        gst_util_uint64_scale_int (sample + count, GST_SECOND, TEST_RATE) -
+        gst_util_uint64_scale_int (sample, GST_SECOND, TEST_RATE));
+
+    for (i = 0; i < count; i++)
+      fail_unless_equals_int (samples[i], sample + i);
+    gst_buffer_unmap (buf, &map);
+
+    sample += count;
+  }
+  fail_unless_equals_int (sample, n * TEST_FRAME_SAMPLES);
+
+  return g_list_length (buffers);
+}
+
+GST_START_TEST (test_output_region)
+{
+  GstElement *dec;
+
+  /* no aggregation, every region goes out on its own */
+  dec = setup_audiodecodertester (TRUE, 0);
+  push_frames (80, G_MAXUINT);
+  fail_unless_equals_int (check_output (80, G_MAXUINT), 80);
+  cleanup_audiodecodertester (dec);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_output_region_aggregation)
+{
+  GstElement *dec;
+  GList *walk;
+
+  /* aggregates are sent once they exceed 20 ms, after 9 frames of 2.5 ms */
+  dec = setup_audiodecodertester (TRUE, 20 * GST_MSECOND);
+  push_frames (80, G_MAXUINT);
+  fail_unless_equals_int (check_output (80, G_MAXUINT), 9);
+  for (walk = buffers; walk->next; walk = walk->next)
+    fail_unless_equals_int (gst_buffer_get_size (walk->data),
+        9 * TEST_FRAME_SIZE);
+  fail_unless_equals_int (gst_buffer_get_size (walk->data),
+      8 * TEST_FRAME_SIZE);
+  cleanup_audiodecodertester (dec);
+
+  /* the same as aggregating regular buffers */
+  dec = setup_audiodecodertester (FALSE, 20 * GST_MSECOND);
+  push_frames (80, G_MAXUINT);
+  fail_unless_equals_int (check_output (80, G_MAXUINT), 9);
+  cleanup_audiodecodertester (dec);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_output_region_gap)
+{
+  GstElement *dec;
+
+  /* the gap ends the aggregate after 3 frames, the remaining 77 frames
+   * make up 8 complete aggregates and a partial one */
+  dec = setup_audiodecodertester (TRUE, 20 * GST_MSECOND);
+  push_frames (80, 3);
+  fail_unless_equals_int (check_output (80, 3), 10);
+  cleanup_audiodecodertester (dec);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_independent_frames)
+{
+  GstElement *dec;
+
+  /* decoded in batches on several threads, but pushed in order */
+  dec = setup_audiodecodertester (FALSE, 0);
+  gst_audio_decoder_set_independent_frames (GST_AUDIO_DECODER (dec), TRUE);
+  g_object_set (dec, "n-threads", 4, NULL);
+  push_frames (83, G_MAXUINT);
+  fail_unless_equals_int (check_output (83, G_MAXUINT), 83);
+  cleanup_audiodecodertester (dec);
+
+  /* regions of frames decoded in parallel are still aggregated */
+  dec = setup_audiodecodertester (TRUE, 20 * GST_MSECOND);
+  gst_audio_decoder_set_independent_frames (GST_AUDIO_DECODER (dec), TRUE);
+  g_object_set (dec, "n-threads", 4, NULL);
+  push_frames (80, 3);
+  fail_unless_equals_int (check_output (80, 3), 10);
+  cleanup_audiodecodertester (dec);
+}
+
+GST_END_TEST;
+
+static Suite *
+audiodecoder_suite (void)
+{
+  Suite *s = suite_create ("audiodecoder");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_output_region);
+  tcase_add_test (tc_chain, test_output_region_aggregation);
+  tcase_add_test (tc_chain, test_output_region_gap);
+  tcase_add_test (tc_chain, test_independent_frames);
+
+  return s;
+}
+
+GST_CHECK_MAIN (audiodecoder);
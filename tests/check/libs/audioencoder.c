@@ -0,0 +1,411 @@
+/* GStreamer
+ *
+ * unit tests for the audio encoder base class
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/check/gstcheck.h>
+
+#include <gst/audio/audio.h>
+#include <gst/audio/gstaudioencoder.h>
+#include <string.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+
+#define TEST_RATE 8000
+/* 20 ms frames of S16 mono */
+#define TEST_FRAME_SAMPLES 160
+#define TEST_SAMPLES_TO_TIME(s) \
+    gst_util_uint64_scale_int (s, GST_SECOND, TEST_RATE)
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("audio/x-test"));
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+        ", rate = (int) 8000, channels = (int) 1, "
+        "layout = (string) interleaved"));
+
+/* an encoder whose packets hold the first input sample of every frame,
+ * it keeps track of how many samples it is handed per call */
+typedef struct _GstAudioEncoderTester GstAudioEncoderTester;
+typedef struct _GstAudioEncoderTesterClass GstAudioEncoderTesterClass;
+
+struct _GstAudioEncoderTester
+{
+  GstAudioEncoder parent;
+
+  gint frame_batch;
+  gint lookahead;
+
+  GArray *calls;
+};
+
+struct _GstAudioEncoderTesterClass
+{
+  GstAudioEncoderClass parent_class;
+};
+
+static GType gst_audio_encoder_tester_get_type (void);
+G_DEFINE_TYPE (GstAudioEncoderTester, gst_audio_encoder_tester,
+    GST_TYPE_AUDIO_ENCODER);
+
+static gboolean
+gst_audio_encoder_tester_set_format (GstAudioEncoder * enc, GstAudioInfo * info)
+{
+  GstAudioEncoderTester *tester = (GstAudioEncoderTester *) enc;
+  GstCaps *caps;
+  gboolean res;
+
+  gst_audio_encoder_set_frame_samples_min (enc, TEST_FRAME_SAMPLES);
+  gst_audio_encoder_set_frame_samples_max (enc, TEST_FRAME_SAMPLES);
+  gst_audio_encoder_set_frame_batch (enc, tester->frame_batch);
+  gst_audio_encoder_set_lookahead (enc, tester->lookahead);
+
+  caps = gst_caps_new_empty_simple ("audio/x-test");
+  res = gst_audio_encoder_set_output_format (enc, caps);
+  gst_caps_unref (caps);
+
+  return res;
+}
+
+static GstFlowReturn
+gst_audio_encoder_tester_handle_frame (GstAudioEncoder * enc,
+    GstBuffer * buffer)
+{
+  GstAudioEncoderTester *tester = (GstAudioEncoderTester *) enc;
+  gint16 first[64];
+  guint samples, n_frames, i;
+  GstFlowReturn ret = GST_FLOW_OK;
+
+  /* nothing to drain */
+  if (buffer == NULL)
+    return GST_FLOW_OK;
+
+  samples = gst_buffer_get_size (buffer) / 2;
+  g_array_append_val (tester->calls, samples);
+
+  /* finishing a frame may invalidate the input, so read it all first */
+  n_frames = (samples + TEST_FRAME_SAMPLES - 1) / TEST_FRAME_SAMPLES;
+  fail_unless (n_frames <= G_N_ELEMENTS (first));
+  for (i = 0; i < n_frames; i++)
+    gst_buffer_extract (buffer, i * TEST_FRAME_SAMPLES * 2, &first[i], 2);
+
+  for (i = 0; i < n_frames && ret == GST_FLOW_OK; i++) {
+    GstBuffer *out = gst_buffer_new_and_alloc (2);
+
+    gst_buffer_fill (out, 0, &first[i], 2);
+    ret = gst_audio_encoder_finish_frame (enc, out,
+        MIN (samples - i * TEST_FRAME_SAMPLES, TEST_FRAME_SAMPLES));
+  }
+
+  return ret;
+}
+
+static void
+gst_audio_encoder_tester_finalize (GObject * object)
+{
+  GstAudioEncoderTester *tester = (GstAudioEncoderTester *) object;
+
+  g_array_free (tester->calls, TRUE);
+
+  G_OBJECT_CLASS (gst_audio_encoder_tester_parent_class)->finalize (object);
+}
+
+static void
+gst_audio_encoder_tester_class_init (GstAudioEncoderTesterClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAudioEncoderClass *audioencoder_class = GST_AUDIO_ENCODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+          ", rate = (int) 8000, channels = (int) 1, "
+          "layout = (string) interleaved"));
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-test"));
+
+  gobject_class->finalize = gst_audio_encoder_tester_finalize;
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_static_metadata (element_class,
+      "AudioEncoderTester", "Encoder/Audio", "yep", "me");
+
+  audioencoder_class->set_format = gst_audio_encoder_tester_set_format;
+  audioencoder_class->handle_frame = gst_audio_encoder_tester_handle_frame;
+}
+
+static void
+gst_audio_encoder_tester_init (GstAudioEncoderTester * tester)
+{
+  tester->calls = g_array_new (FALSE, FALSE, sizeof (guint));
+}
+
+static GstElement *
+setup_audioencodertester (gint frame_batch, gint lookahead,
+    gboolean perfect_timestamp)
+{
+  GstElement *enc;
+  GstCaps *caps;
+
+  enc = g_object_new (gst_audio_encoder_tester_get_type (), NULL);
+  ((GstAudioEncoderTester *) enc)->frame_batch = frame_batch;
+  ((GstAudioEncoderTester *) enc)->lookahead = lookahead;
+  g_object_set (enc, "perfect-timestamp", perfect_timestamp, NULL);
+
+  mysrcpad = gst_check_setup_src_pad (enc, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (enc, &sinktemplate);
+
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  fail_unless (gst_element_set_state (enc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  caps = gst_caps_new_simple ("audio/x-raw",
+      "format", G_TYPE_STRING, GST_AUDIO_NE (S16),
+      "rate", G_TYPE_INT, TEST_RATE, "channels", G_TYPE_INT, 1,
+      "layout", G_TYPE_STRING, "interleaved", NULL);
+  gst_check_setup_events (mysrcpad, enc, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+
+  return enc;
+}
+
+static void
+cleanup_audioencodertester (GstElement * enc)
+{
+  gst_element_set_state (enc, GST_STATE_NULL);
+
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (enc);
+  gst_check_teardown_sink_pad (enc);
+  gst_check_teardown_element (enc);
+
+  gst_check_drop_buffers ();
+}
+
+/* input timestamp of @sample when the input jumps one second ahead at
+ * @gap_at */
+static GstClockTime
+sample_time (guint sample, guint gap_at)
+{
+  return TEST_SAMPLES_TO_TIME (sample) + (sample >= gap_at ? GST_SECOND : 0);
+}
+
+/* pushes @n_samples of a ramp in buffers of @per_buffer samples */
+static void
+push_samples (guint n_samples, guint per_buffer, guint gap_at)
+{
+  guint sample = 0, i;
+
+  while (sample < n_samples) {
+    guint n = MIN (per_buffer, n_samples - sample);
+    GstBuffer *buf;
+    GstMapInfo map;
+    gint16 *samples;
+
+    buf = gst_buffer_new_and_alloc (n * 2);
+    gst_buffer_map (buf, &map, GST_MAP_WRITE);
+    samples = (gint16 *) map.data;
+    for (i = 0; i < n; i++)
+      samples[i] = sample + i;
+    gst_buffer_unmap (buf, &map);
+
+    GST_BUFFER_TIMESTAMP (buf) = sample_time (sample, gap_at);
+    GST_BUFFER_DURATION (buf) = TEST_SAMPLES_TO_TIME (n);
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+
+    sample += n;
+  }
+
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+}
+
+static void
+check_calls (GstElement * enc, const guint * samples, guint n_calls)
+{
+  GArray *calls = ((GstAudioEncoderTester *) enc)->calls;
+  guint i;
+
+  fail_unless_equals_int (calls->len, n_calls);
+  for (i = 0; i < n_calls; i++)
+    fail_unless_equals_int (g_array_index (calls, guint, i), samples[i]);
+}
+
+/* every packet holds the first sample of its frame and is timestamped
+ * where that frame started */
+static void
+check_packets (guint n_samples, guint gap_at)
+{
+  GList *walk;
+  guint frame = 0;
+
+  fail_unless_equals_int (g_list_length (buffers),
+      (n_samples + TEST_FRAME_SAMPLES - 1) / TEST_FRAME_SAMPLES);
+
+  for (walk = buffers; walk; walk = walk->next, frame++) {
+    GstBuffer *buf = walk->data;
+    guint start = frame * TEST_FRAME_SAMPLES;
+    guint end = MIN (start + TEST_FRAME_SAMPLES, n_samples);
+    gint16 first;
+
+    gst_buffer_extract (buf, 0, &first, 2);
+    fail_unless_equals_int (first, (gint16) start);
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buf),
+        sample_time (start, gap_at));
+    fail_unless_equals_uint64 (GST_BUFFER_DURATION (buf),
+        TEST_SAMPLES_TO_TIME (end) - TEST_SAMPLES_TO_TIME (start));
+  }
+}
+
+GST_START_TEST (test_frame_batch)
+{
+  GstElement *enc;
+  const guint single[] = { 160, 160, 160, 160, 160, 160, 40 };
+  const guint batched[] = { 640, 320, 40 };
+
+  /* 6 frames and a remainder, handed over one by one */
+  enc = setup_audioencodertester (0, 0, TRUE);
+  push_samples (1000, 100, G_MAXUINT);
+  check_calls (enc, single, G_N_ELEMENTS (single));
+  check_packets (1000, G_MAXUINT);
+  cleanup_audioencodertester (enc);
+
+  /* in complete batches of 4, fewer only when draining */
+  enc = setup_audioencodertester (4, 0, TRUE);
+  push_samples (1000, 100, G_MAXUINT);
+  check_calls (enc, batched, G_N_ELEMENTS (batched));
+  check_packets (1000, G_MAXUINT);
+  cleanup_audioencodertester (enc);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_frame_batch_timestamps)
+{
+  GstElement *enc;
+  const guint batched[] = { 640, 320, 40 };
+
+  /* upstream jumps ahead inside the first batch, the packets of the frames
+   * after the jump follow it */
+  enc = setup_audioencodertester (4, 0, FALSE);
+  push_samples (1000, 100, 300);
+  check_calls (enc, batched, G_N_ELEMENTS (batched));
+  check_packets (1000, 300);
+  cleanup_audioencodertester (enc);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_frame_batch_lookahead)
+{
+  GstElement *enc;
+  GList *walk;
+  guint frame = 0;
+
+  /* output lags the input by the lookahead, but does not start before
+   * the input did */
+  enc = setup_audioencodertester (4, 80, TRUE);
+  push_samples (960, 120, G_MAXUINT);
+  fail_unless_equals_int (g_list_length (buffers), 6);
+  for (walk = buffers; walk; walk = walk->next, frame++) {
+    GstBuffer *buf = walk->data;
+    guint start = frame * TEST_FRAME_SAMPLES;
+    guint end = start + TEST_FRAME_SAMPLES;
+
+    start = frame > 0 ? start - 80 : 0;
+    end -= 80;
+    fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (buf),
+        TEST_SAMPLES_TO_TIME (start));
+    fail_unless_equals_uint64 (GST_BUFFER_DURATION (buf),
+        TEST_SAMPLES_TO_TIME (end) - TEST_SAMPLES_TO_TIME (start));
+  }
+  cleanup_audioencodertester (enc);
+}
+
+GST_END_TEST;
+
+static guint
+encode_timed (gint frame_batch, guint n_samples, GstClockTime * elapsed)
+{
+  GstElement *enc;
+  GstClockTime start;
+  guint n_calls;
+
+  enc = setup_audioencodertester (frame_batch, 0, TRUE);
+  start = gst_util_get_timestamp ();
+  push_samples (n_samples, 80, G_MAXUINT);
+  *elapsed = gst_util_get_timestamp () - start;
+  n_calls = ((GstAudioEncoderTester *) enc)->calls->len;
+  check_packets (n_samples, G_MAXUINT);
+  cleanup_audioencodertester (enc);
+
+  return n_calls;
+}
+
+GST_START_TEST (test_frame_batch_calls)
+{
+  GstClockTime single_time, batched_time;
+  guint single_calls, batched_calls;
+
+  /* a minute of audio in 10 ms buffers */
+  single_calls = encode_timed (0, 60 * TEST_RATE, &single_time);
+  batched_calls = encode_timed (16, 60 * TEST_RATE, &batched_time);
+
+  GST_INFO ("one frame per call: %u calls in %" GST_TIME_FORMAT,
+      single_calls, GST_TIME_ARGS (single_time));
+  GST_INFO ("16 frames per call: %u calls in %" GST_TIME_FORMAT,
+      batched_calls, GST_TIME_ARGS (batched_time));
+
+  fail_unless_equals_int (single_calls, 3000);
+  fail_unless_equals_int (batched_calls, 188);
+}
+
+GST_END_TEST;
+
+static Suite *
+audioencoder_suite (void)
+{
+  Suite *s = suite_create ("audioencoder");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_add_test (tc_chain, test_frame_batch);
+  tcase_add_test (tc_chain, test_frame_batch_timestamps);
+  tcase_add_test (tc_chain, test_frame_batch_lookahead);
+  tcase_add_test (tc_chain, test_frame_batch_calls);
+
+  return s;
+}
+
+GST_CHECK_MAIN (audioencoder);
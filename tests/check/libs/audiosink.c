@@ -0,0 +1,463 @@
+/* GStreamer
+ *
+ * unit tests for the audio sink base classes
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/check/gstcheck.h>
+
+#include <gst/audio/audio.h>
+#include <gst/audio/gstaudiosink.h>
+#include <math.h>
+
+#define TEST_RATE 44100
+#define TEST_FREQ 441.0
+/* the fake device and the master clock run this many times faster than
+ * real time so that the slaving settles within a reasonable test time */
+#define TEST_SPEEDUP 4
+/* the master clock runs 0.2% faster than the device */
+#define TEST_SKEW_NUM 1002
+#define TEST_SKEW_DEN 1000
+/* seconds of media that are played */
+#define TEST_SECONDS 30
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+        ", rate = (int) 44100, channels = (int) 1, "
+        "layout = (string) interleaved"));
+
+/* a device that consumes samples at TEST_SPEEDUP times real time and keeps
+ * everything that was written to it */
+typedef struct _GstTestAudioSink GstTestAudioSink;
+typedef struct _GstTestAudioSinkClass GstTestAudioSinkClass;
+
+struct _GstTestAudioSink
+{
+  GstAudioSink parent;
+
+  GArray *samples;
+  gint64 start_time;
+  guint64 played;
+};
+
+struct _GstTestAudioSinkClass
+{
+  GstAudioSinkClass parent_class;
+};
+
+static GType gst_test_audio_sink_get_type (void);
+
+G_DEFINE_TYPE (GstTestAudioSink, gst_test_audio_sink, GST_TYPE_AUDIO_SINK);
+
+static gboolean
+gst_test_audio_sink_open (GstAudioSink * asink)
+{
+  return TRUE;
+}
+
+static gboolean
+gst_test_audio_sink_prepare (GstAudioSink * asink,
+    GstAudioRingBufferSpec * spec)
+{
+  GstTestAudioSink *sink = (GstTestAudioSink *) asink;
+
+  sink->start_time = 0;
+  sink->played = 0;
+
+  return TRUE;
+}
+
+static gboolean
+gst_test_audio_sink_unprepare (GstAudioSink * asink)
+{
+  return TRUE;
+}
+
+static gboolean
+gst_test_audio_sink_close (GstAudioSink * asink)
+{
+  return TRUE;
+}
+
+static gint
+gst_test_audio_sink_write (GstAudioSink * asink, gpointer data, guint length)
+{
+  GstTestAudioSink *sink = (GstTestAudioSink *) asink;
+  guint frames = length / sizeof (gint16);
+  gint64 deadline, now;
+
+  g_array_append_vals (sink->samples, data, frames);
+
+  now = g_get_monotonic_time ();
+  if (sink->start_time == 0)
+    sink->start_time = now;
+  sink->played += frames;
+
+  /* sleep until the device played everything, against an absolute deadline
+   * so that the average rate is exact */
+  deadline = sink->start_time + gst_util_uint64_scale (sink->played,
+      G_USEC_PER_SEC, TEST_RATE * TEST_SPEEDUP);
+  if (deadline > now)
+    g_usleep (deadline - now);
+
+  return length;
+}
+
+static guint
+gst_test_audio_sink_delay (GstAudioSink * asink)
+{
+  return 0;
+}
+
+static void
+gst_test_audio_sink_reset (GstAudioSink * asink)
+{
+}
+
+static void
+gst_test_audio_sink_finalize (GObject * object)
+{
+  GstTestAudioSink *sink = (GstTestAudioSink *) object;
+
+  g_array_free (sink->samples, TRUE);
+
+  G_OBJECT_CLASS (gst_test_audio_sink_parent_class)->finalize (object);
+}
+
+static void
+gst_test_audio_sink_class_init (GstTestAudioSinkClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAudioSinkClass *audiosink_class = GST_AUDIO_SINK_CLASS (klass);
+
+  gobject_class->finalize = gst_test_audio_sink_finalize;
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sinktemplate));
+  gst_element_class_set_static_metadata (element_class, "Test audio sink",
+      "Sink/Audio", "Plays samples into memory", "GStreamer");
+
+  audiosink_class->open = gst_test_audio_sink_open;
+  audiosink_class->prepare = gst_test_audio_sink_prepare;
+  audiosink_class->unprepare = gst_test_audio_sink_unprepare;
+  audiosink_class->close = gst_test_audio_sink_close;
+  audiosink_class->write = gst_test_audio_sink_write;
+  audiosink_class->delay = gst_test_audio_sink_delay;
+  audiosink_class->reset = gst_test_audio_sink_reset;
+}
+
+static void
+gst_test_audio_sink_init (GstTestAudioSink * sink)
+{
+  sink->samples = g_array_new (FALSE, FALSE, sizeof (gint16));
+}
+
+/* a system clock that runs TEST_SPEEDUP times faster than real time and
+ * skewed against the fake device by TEST_SKEW_NUM / TEST_SKEW_DEN */
+typedef GstSystemClock GstTestSkewedClock;
+typedef GstSystemClockClass GstTestSkewedClockClass;
+
+static GType gst_test_skewed_clock_get_type (void);
+
+G_DEFINE_TYPE (GstTestSkewedClock, gst_test_skewed_clock,
+    GST_TYPE_SYSTEM_CLOCK);
+
+static GstClockTime
+gst_test_skewed_clock_get_internal_time (GstClock * clock)
+{
+  GstClockTime time;
+
+  time = GST_CLOCK_CLASS (gst_test_skewed_clock_parent_class)->
+      get_internal_time (clock);
+
+  return gst_util_uint64_scale (time, TEST_SPEEDUP * TEST_SKEW_NUM,
+      TEST_SKEW_DEN);
+}
+
+static void
+gst_test_skewed_clock_class_init (GstTestSkewedClockClass * klass)
+{
+  GstClockClass *clock_class = GST_CLOCK_CLASS (klass);
+
+  clock_class->get_internal_time = gst_test_skewed_clock_get_internal_time;
+}
+
+static void
+gst_test_skewed_clock_init (GstTestSkewedClock * clock)
+{
+}
+
+static GstCaps *
+get_test_caps (void)
+{
+  return gst_caps_new_simple ("audio/x-raw",
+      "format", G_TYPE_STRING, GST_AUDIO_NE (S16),
+      "rate", G_TYPE_INT, TEST_RATE, "channels", G_TYPE_INT, 1,
+      "layout", G_TYPE_STRING, "interleaved", NULL);
+}
+
+static GstMessage *
+run_until_eos (GstElement * pipeline)
+{
+  GstMessage *msg;
+  GstBus *bus;
+
+  bus = gst_element_get_bus (pipeline);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  gst_object_unref (bus);
+
+  return msg;
+}
+
+GST_START_TEST (test_properties)
+{
+  GstElement *pipeline, *src, *sink;
+  GstAudioRingBufferThreadPolicy policy;
+  gint priority;
+  guint64 affinity;
+  gboolean lock_memory;
+  guint underruns;
+  GstMessage *msg;
+
+  sink = g_object_new (gst_test_audio_sink_get_type (), NULL);
+
+  g_object_get (sink, "thread-policy", &policy, "thread-priority", &priority,
+      "thread-affinity", &affinity, "lock-memory", &lock_memory,
+      "underruns", &underruns, NULL);
+  fail_unless_equals_int (policy, GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL);
+  fail_unless (affinity == 0);
+  fail_unless (!lock_memory);
+  fail_unless_equals_int (underruns, 0);
+
+  g_object_set (sink, "thread-policy", GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO,
+      "thread-priority", 50, "thread-affinity", G_GUINT64_CONSTANT (1),
+      "lock-memory", TRUE, NULL);
+  g_object_get (sink, "thread-policy", &policy, "thread-priority", &priority,
+      "thread-affinity", &affinity, "lock-memory", &lock_memory, NULL);
+  fail_unless_equals_int (policy, GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO);
+  fail_unless_equals_int (priority, 50);
+  fail_unless (affinity == 1);
+  fail_unless (lock_memory);
+
+  /* the sink has to play even when realtime scheduling or locking the
+   * memory is not permitted */
+  pipeline = gst_pipeline_new (NULL);
+  src = gst_element_factory_make ("audiotestsrc", NULL);
+  fail_unless (src != NULL);
+  g_object_set (src, "num-buffers", 10, NULL);
+  gst_bin_add_many (GST_BIN (pipeline), src, sink, NULL);
+  fail_unless (gst_element_link (src, sink));
+
+  fail_unless (gst_element_set_state (pipeline, GST_STATE_PLAYING) !=
+      GST_STATE_CHANGE_FAILURE);
+  msg = run_until_eos (pipeline);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+  fail_unless (((GstTestAudioSink *) sink)->samples->len > 0);
+
+  gst_object_unref (pipeline);
+}
+
+GST_END_TEST;
+
+static void
+push_silence (GstElement * src, gint n)
+{
+  GstBuffer *buffer;
+  GstFlowReturn ret;
+  gsize size = TEST_RATE / 10 * sizeof (gint16);
+
+  buffer = gst_buffer_new_allocate (NULL, size, NULL);
+  gst_buffer_memset (buffer, 0, 0, size);
+  GST_BUFFER_TIMESTAMP (buffer) = n * GST_SECOND / 10;
+  GST_BUFFER_DURATION (buffer) = GST_SECOND / 10;
+
+  g_signal_emit_by_name (src, "push-buffer", buffer, &ret);
+  fail_unless_equals_int (ret, GST_FLOW_OK);
+  gst_buffer_unref (buffer);
+}
+
+/* data that arrives after the device played its position counts as
+ * underruns */
+GST_START_TEST (test_underruns)
+{
+  GstElement *pipeline, *src, *sink;
+  GstFlowReturn ret;
+  GstMessage *msg;
+  GstCaps *caps;
+  guint underruns;
+  gint i;
+
+  pipeline = gst_pipeline_new (NULL);
+  src = gst_element_factory_make ("appsrc", NULL);
+  fail_unless (src != NULL);
+  caps = get_test_caps ();
+  g_object_set (src, "caps", caps, "format", GST_FORMAT_TIME, NULL);
+  gst_caps_unref (caps);
+  sink = g_object_new (gst_test_audio_sink_get_type (), NULL);
+
+  gst_bin_add_many (GST_BIN (pipeline), src, sink, NULL);
+  fail_unless (gst_element_link (src, sink));
+
+  fail_unless (gst_element_set_state (pipeline, GST_STATE_PLAYING) !=
+      GST_STATE_CHANGE_FAILURE);
+  push_silence (src, 0);
+  fail_unless_equals_int (gst_element_get_state (pipeline, NULL, NULL,
+          GST_CLOCK_TIME_NONE), GST_STATE_CHANGE_SUCCESS);
+
+  /* let the device play two seconds ahead of the data */
+  g_usleep (2 * G_USEC_PER_SEC / TEST_SPEEDUP);
+  for (i = 1; i < 5; i++)
+    push_silence (src, i);
+  g_signal_emit_by_name (src, "end-of-stream", &ret);
+
+  msg = run_until_eos (pipeline);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+
+  g_object_get (sink, "underruns", &underruns, NULL);
+  GST_DEBUG ("%u underruns", underruns);
+  fail_unless (underruns > 0);
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+  gst_object_unref (pipeline);
+}
+
+GST_END_TEST;
+
+/* position of the rising zero crossing between sample @i and @i + 1 */
+static gdouble
+rising_crossing (const gint16 * data, guint i)
+{
+  return i + (gdouble) - data[i] / (data[i + 1] - data[i]);
+}
+
+GST_START_TEST (test_slave_interpolate)
+{
+  GstElement *pipeline, *src, *capsfilter, *sink;
+  GstTestAudioSink *tsink;
+  GstClock *clock;
+  GstCaps *caps;
+  GstMessage *msg;
+  const gint16 *data;
+  guint start, end, i, n_crossings;
+  gdouble max_step, first = 0.0, last = 0.0, ratio, expected;
+
+  pipeline = gst_pipeline_new (NULL);
+  src = gst_element_factory_make ("audiotestsrc", NULL);
+  fail_unless (src != NULL);
+  g_object_set (src, "num-buffers", TEST_SECONDS * 100,
+      "samplesperbuffer", TEST_RATE / 100, "freq", TEST_FREQ, NULL);
+  capsfilter = gst_element_factory_make ("capsfilter", NULL);
+  caps = get_test_caps ();
+  g_object_set (capsfilter, "caps", caps, NULL);
+  gst_caps_unref (caps);
+  sink = g_object_new (gst_test_audio_sink_get_type (), NULL);
+  gst_util_set_object_arg (G_OBJECT (sink), "slave-method", "interpolate");
+
+  gst_bin_add_many (GST_BIN (pipeline), src, capsfilter, sink, NULL);
+  fail_unless (gst_element_link_many (src, capsfilter, sink, NULL));
+
+  /* force the skewed clock as master so that the sink is slaved to it */
+  clock = g_object_new (gst_test_skewed_clock_get_type (), NULL);
+  gst_pipeline_use_clock (GST_PIPELINE (pipeline), clock);
+
+  fail_unless (gst_element_set_state (pipeline, GST_STATE_PLAYING) !=
+      GST_STATE_CHANGE_FAILURE);
+
+  msg = run_until_eos (pipeline);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+
+  tsink = (GstTestAudioSink *) sink;
+  data = (const gint16 *) tsink->samples->data;
+
+  /* skip the silence the device played before and after the stream and the
+   * first and last period where the filter settles */
+  for (start = 0; start < tsink->samples->len && data[start] == 0; start++);
+  for (end = tsink->samples->len; end > start && data[end - 1] == 0; end--);
+  fail_unless (end - start > (TEST_SECONDS - 1) * TEST_RATE,
+      "only %u samples played", end - start);
+  start += TEST_RATE / TEST_FREQ;
+  end -= TEST_RATE / TEST_FREQ;
+
+  /* the output has to be a continuous sine, without gaps or jumps, the
+   * default volume of audiotestsrc is 0.8 */
+  max_step = 1.1 * 0.8 * 32767 * 2.0 * sin (G_PI * TEST_FREQ / TEST_RATE) + 2;
+  for (i = start; i + 1 < end; i++) {
+    fail_unless (ABS (data[i + 1] - data[i]) <= max_step,
+        "discontinuity at sample %u: %d -> %d", i, data[i], data[i + 1]);
+    fail_if (data[i] == 0 && data[i + 1] == 0, "gap at sample %u", i);
+  }
+
+  /* the length of the periods in the last seconds tells the rate the sink
+   * converged to, it has to play fewer samples than it receives because the
+   * master clock is faster */
+  n_crossings = 0;
+  for (i = end - 6 * TEST_RATE; i + 1 < end; i++) {
+    if (data[i] < 0 && data[i + 1] >= 0) {
+      last = rising_crossing (data, i);
+      if (n_crossings == 0)
+        first = last;
+      n_crossings++;
+    }
+  }
+  fail_unless (n_crossings > 100);
+
+  ratio = (last - first) / (n_crossings - 1) * TEST_FREQ / TEST_RATE;
+  expected = (gdouble) TEST_SKEW_DEN / TEST_SKEW_NUM;
+  GST_DEBUG ("converged to ratio %.6f, expected %.6f", ratio, expected);
+  fail_unless (fabs (ratio - expected) < 5e-4,
+      "converged to ratio %.6f, expected %.6f", ratio, expected);
+
+  gst_object_unref (clock);
+  gst_object_unref (pipeline);
+}
+
+GST_END_TEST;
+
+static Suite *
+audiosink_suite (void)
+{
+  Suite *s = suite_create ("audiosink");
+  TCase *tc_chain = tcase_create ("general");
+
+  suite_add_tcase (s, tc_chain);
+  tcase_set_timeout (tc_chain, 120);
+  tcase_add_test (tc_chain, test_properties);
+  tcase_add_test (tc_chain, test_underruns);
+  tcase_add_test (tc_chain, test_slave_interpolate);
+
+  return s;
+}
+
+GST_CHECK_MAIN (audiosink);
@@ -251,6 +251,27 @@ gst_audio_ring_buffer_state_get_type (void)
   return g_define_type_id__volatile;
 }
 
+GType
+gst_audio_ring_buffer_thread_policy_get_type (void)
+{
+  static volatile gsize g_define_type_id__volatile = 0;
+  if (g_once_init_enter (&g_define_type_id__volatile)) {
+    static const GEnumValue values[] = {
+      {GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL,
+          "GST_AUDIO_RING_BUFFER_THREAD_POLICY_NORMAL", "normal"},
+      {GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO,
+          "GST_AUDIO_RING_BUFFER_THREAD_POLICY_FIFO", "fifo"},
+      {GST_AUDIO_RING_BUFFER_THREAD_POLICY_RR,
+          "GST_AUDIO_RING_BUFFER_THREAD_POLICY_RR", "rr"},
+      {0, NULL, NULL}
+    };
+    GType g_define_type_id =
+        g_enum_register_static ("GstAudioRingBufferThreadPolicy", values);
+    g_once_init_leave (&g_define_type_id__volatile, g_define_type_id);
+  }
+  return g_define_type_id__volatile;
+}
+
 GType
 gst_audio_ring_buffer_format_type_get_type (void)
 {
@@ -29,6 +29,8 @@ GType gst_audio_layout_get_type (void);
 /* enumerations from "gstaudioringbuffer.h" */
 GType gst_audio_ring_buffer_state_get_type (void);
 #define GST_TYPE_AUDIO_RING_BUFFER_STATE (gst_audio_ring_buffer_state_get_type())
+GType gst_audio_ring_buffer_thread_policy_get_type (void);
+#define GST_TYPE_AUDIO_RING_BUFFER_THREAD_POLICY (gst_audio_ring_buffer_thread_policy_get_type())
 GType gst_audio_ring_buffer_format_type_get_type (void);
 #define GST_TYPE_AUDIO_RING_BUFFER_FORMAT_TYPE (gst_audio_ring_buffer_format_type_get_type())
 G_END_DECLS